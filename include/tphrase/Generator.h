@@ -39,12 +39,17 @@
 #define TPHRASE_GENERATOR_H_
 
 #include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "common/InputIterator.h"
+#include "common/config.h"
 #include "common/ext_context.h"
 #include "common/gsub_func.h"
+#include "common/memory_usage.h"
 #include "common/random_func.h"
 #include "common/syntax_id.h"
 
@@ -57,6 +62,11 @@ namespace tphrase {
     public:
         /** The default constructor. */
         Generator();
+        /** The constructor to create an empty instance with a configuration.
+            \param [in] config The configuration.
+            \note The random function is created by config.random_creator if it's not empty.
+        */
+        explicit Generator(const Config_t &config);
         /** The constructor to create an instance that has a syntax.
             \param [in] syntax The phrase syntax.
             \note Only the phrase syntax that contains the nonterminal "main" can add.
@@ -64,6 +74,7 @@ namespace tphrase {
             \note All the errors in syntax is added.
             \note get_error_message() will return an empty string if no errors are detected.
             \note An empty generator is created if some errors are detected.
+            \note The configuration of the syntax is used.
         */
         explicit Generator(const Syntax &syntax);
         /** The constructor to create an instance that has a syntax.
@@ -73,6 +84,7 @@ namespace tphrase {
             \note All the errors in syntax is moved.
             \note get_error_message() will return an empty vector if no errors are detected and moved.
             \note An empty generator is created if some errors are detected.
+            \note The configuration of the syntax is used.
         */
         explicit Generator(Syntax &&syntax);
         /** The constructor to create an instance that has a syntax.
@@ -83,6 +95,7 @@ namespace tphrase {
             \note All the errors in syntax is added.
             \note get_error_message() will return an empty vector if no errors are detected.
             \note An empty generator is created if some errors are detected.
+            \note The configuration of the syntax is used.
         */
         Generator(const Syntax &syntax, const std::string &start_condition);
         /** The constructor to create an instance that has a syntax.
@@ -93,6 +106,7 @@ namespace tphrase {
             \note All the errors in syntax is moved.
             \note get_error_message() will return an empty vector if no errors are detected and moved.
             \note An empty generator is created if some errors are detected.
+            \note The configuration of the syntax is used.
         */
         Generator(Syntax &&syntax, const std::string &start_condition);
         /** The copy constructor.
@@ -188,6 +202,16 @@ namespace tphrase {
             \note The ID for the removed phrase syntax may be reused by add().
         */
         bool remove(SyntaxID_t id);
+        /** Replace a phrase syntax with its later revision.
+            \param [in] id ID for the phrase syntax.
+            \param [in] syntax The phrase syntax to be copied.
+            \return true if the phrase syntax is replaced.
+            \note The start condition and the syntax ID are not changed.
+            \note If the phrase syntax for id was copied from the previous revision of syntax, which Syntax::update() has updated, only the changed assignments are copied and only the production rules affected by them are bound again. Otherwise, the whole syntax is copied and bound.
+            \note All the errors in syntax is added.
+            \note The phrase syntax for id is removed if some errors are detected or added.
+        */
+        bool update(SyntaxID_t id, const Syntax &syntax);
 
         /** Get the error messages.
             \return The error messages that have been generated after creating the instance or clearing the previous error messages.
@@ -204,6 +228,11 @@ namespace tphrase {
         */
         void equalize_chance(bool enable = true);
 
+        /** Get the configuration.
+            \return The configuration.
+        */
+        const Config_t &get_config() const;
+
         /** Get the number of the syntaxes in the instance.
             \return The number of the syntaxes in the instance.
         */
@@ -216,6 +245,50 @@ namespace tphrase {
             \return The the number of the possible phrases generated by the instance.
         */
         std::size_t get_combination_number() const;
+        /** Get the report of the gsubs eliminated because they can't match.
+            \return The messages for the eliminated gsubs, such as "The gsub with the pattern "x" in "main" is eliminated because it can't match."
+            \note A gsub is eliminated if its pattern requires a byte that the text to be substituted can't contain. The eliminated gsubs cost nothing at the generation.
+            \note Only the gsubs created by the built-in gsub creators (including tphrase::create_utf8_gsub) are eliminated. The text that contains an expansion of the external context can contain any bytes, so it prevents the elimination.
+        */
+        std::vector<std::string> get_eliminated_gsub_report() const;
+        /** Share the identical production rules among the phrase syntaxes, and release the unused ones.
+            \return The estimated number of the bytes released.
+            \note The production rules assigned to the same nonterminal in some phrase syntaxes are shared if they are identical, including the literals, the gsubs, and the production rules that they refer to. The production rules unreachable from the start condition are released.
+            \note The generated phrases, the weights, and the numbers of the combination are not changed.
+            \note The copies of the instance made before the call are not changed.
+            \note The next update() for a compacted phrase syntax binds the whole syntax, and get_eliminated_gsub_report() doesn't report the gsubs in the shared production rules.
+        */
+        std::size_t compact();
+        /** Get the breakdown of the memory held by the instance.
+            \return The estimated numbers of the bytes.
+            \note The phrase syntaxes and the production rules shared by the copies of the instance are counted in each copy. The linked libraries are counted once.
+            \note The numbers of the gsub functions are estimated from the patterns if they are created by the built-in gsub creators (including tphrase::create_utf8_gsub). Only the function objects are counted for other gsub creators.
+        */
+        MemoryUsage_t memory_usage() const;
+
+        /** Write the phrase syntaxes into a binary snapshot.
+            \param [inout] os The output stream. It should be opened in the binary mode.
+            \return true if the snapshot is written without errors of the stream.
+            \note The snapshot contains the production rules, the weights given in the phrase syntaxes, the syntax IDs, and the parameters of the gsubs. It doesn't contain the error messages, the configuration, and the gsub functions themselves.
+            \note The snapshot is portable among the platforms that use IEEE 754 floating point numbers.
+        */
+        bool save(std::ostream &os) const;
+        /** Replace the phrase syntaxes with the ones in a binary snapshot.
+            \param [inout] is The input stream. It should be opened in the binary mode.
+            \return true if the snapshot is read successfully.
+            \note The snapshot must be written by save() of the same version of the library. The phrase syntaxes aren't parsed again, but they are bound again to check the snapshot and to calculate the weights.
+            \note The gsub functions are created by the gsub creator in the configuration of this, or the process-wide one, as well as parsing the source text, so it should be the same as the one used for the saved generator. They are shared via the process-wide cache, and created at the first use if the configuration enables lazy_gsub.
+            \note The syntax IDs are the same as the ones in the saved generator. The error messages in this are kept, and an error message is added if the snapshot is broken.
+            \note An empty generator is left if some errors are detected.
+        */
+        bool load(std::istream &is);
+        /** Write the phrase syntaxes into a flat image for GeneratorImage.
+            \param [inout] os The output stream. It should be opened in the binary mode.
+            \return true if the image is written without errors of the stream.
+            \note The image has no pointers, and GeneratorImage generates a phrase directly on it. The production rules shared by the expansions are written only once.
+            \note The image is in the native byte order, so it can be used only on the platforms with the same byte order.
+        */
+        bool save_image(std::ostream &os) const;
 
         /** Set the function to create the gsub functions.
             \param [in] creator The function to create the gsub functions.
@@ -224,6 +297,7 @@ namespace tphrase {
             \note It causes a parse error that the creator function throw an std::runtime_error at creating a gsub function. The exception handles and suppresses by the parser.
             \note The generator doesn't catch the exception that the created gsub function throws. (The default gsub function doesn't throw the std::runtime_error and generates an error string.)
             \note You should tell the phrase creators that you changed the gsub creator function because it affects the grammar of the gsub.
+            \note The syntax created with a configuration that has a gsub creator doesn't use it.
         */
         static void set_gsub_function_creator(const GsubFuncCreator_t &creator);
         /** Get the current gsub function creator.
@@ -231,11 +305,28 @@ namespace tphrase {
         */
         static GsubFuncCreator_t get_gsub_function_creator();
 
+        /** Set the maximum number of the gsub functions in the process-wide cache.
+            \param [in] capacity The maximum number. The cache is disabled if it's zero.
+            \note The gsub functions created by a gsub creator that is a plain function (including the default one and tphrase::create_utf8_gsub) are cached with the pattern, the replacement, and the global parameter, so the syntaxes share the gsub function instead of creating it again.
+            \note The cached gsub functions must not have any mutable state, because they are shared among the threads.
+            \note The least recently used gsub function is removed from the cache if it's full. The default capacity is 1024.
+        */
+        static void set_gsub_cache_capacity(std::size_t capacity);
+        /** Get the statistics of the process-wide cache of the gsub functions.
+            \return The statistics.
+        */
+        static GsubCacheStats_t get_gsub_cache_stats();
+        /** Clear the process-wide cache of the gsub functions and its statistics.
+            \note The gsub functions used by the existing syntaxes are not released until the syntaxes are destroyed.
+        */
+        static void clear_gsub_cache();
+
         /** Set the function to create the random numbers.
             \param [in] rand The random function that generate a real value [ 0.0 1.0).
             \note It's used when generating the phrase.
             \note The default random function uses std::default_random_engine and std::uniform_real_distribution.
             \note This function is useful for a unit test.
+            \note The generator created with a configuration that has a random function creator doesn't use it.
         */
         static void set_random_function(const RandomFunc_t &rand);
         /** Get the current random function.
@@ -251,6 +342,13 @@ namespace tphrase {
 
 
     class DataSyntax;
+    class SyntaxLibrary;
+
+    /** The type of the function to receive an assignment from Syntax::parse_each().
+
+        The arguments are the nonterminal and a phrase syntax that has only the assignment. It returns false to stop parsing.
+    */
+    using AssignmentSink_t = std::function<bool(const std::string &nonterminal, Syntax &&assignment)>;
 
     /** The phrase syntax class
 
@@ -258,9 +356,15 @@ namespace tphrase {
     */
     class Syntax {
         friend class Generator;
+        friend class SyntaxLibrary;
     public:
         /** The default constructor. */
         Syntax();
+        /** The constructor to create an empty instance with a configuration.
+            \param [in] config The configuration.
+            \note The gsub functions in the source texts added by add() are created by config.gsub_creator if it's not empty.
+        */
+        explicit Syntax(const Config_t &config);
         /** The constructor to create an instance that has a syntax.
             \tparam T The type of an input iterator. The dereference of a value of T can be convertible to a value of char.
             \tparam S The type of the end for T.
@@ -354,6 +458,96 @@ namespace tphrase {
             \note If the source syntax has the nonterminal that this already contains, then: (1) the nonterminal in the source syntax overwrites it, (2) an error message is added to this, (3) true is returned unless some parse errors are detected.
         */
         bool add(const char *src);
+        /** Add the assignments from a phrase syntax in a file.
+            \param [in] path The path of the file.
+            \return true if no parse errors are detected and the file can be read.
+            \note The regular file is parsed directly from the read-only memory mapping, and the other files are read as a stream.
+            \note The error messages added by the function begin with the path, such as "syntax.txt: Line#1, Column#11: A text is expected."
+            \note No phrase syntax is added if some parse errors are detected.
+            \note If the source syntax has the nonterminal that this already contains, then: (1) the nonterminal in the source syntax overwrites it, (2) an error message is added to this, (3) true is returned unless some parse errors are detected.
+        */
+        bool add_file(const std::string &path);
+
+        /** Create an instance that has a phrase syntax in a file.
+            \param [in] path The path of the file.
+            \param [in] config The configuration.
+            \return The instance.
+            \note It's equivalent to add_file() on an instance created with config.
+            \note An empty phrase syntax is created if some errors are detected.
+        */
+        static Syntax from_file(const std::string &path, const Config_t &config = Config_t{});
+
+        /** Parse a phrase syntax, and pass each assignment to a function as soon as it's parsed.
+            \tparam T The type of an input iterator. The dereference of a value of T can be convertible to a value of char.
+            \tparam S The type of the end for T.
+            \param [inout] begin The iterator to point the beginning of the source text of a phrase syntax. (Universal reference; accessed by the reference or moved)
+            \param [inout] end The end iterator. (Universal reference; accessed by the reference or moved)
+            \param [in] sink The function to receive the assignments.
+            \param [inout] err_msg The error messages are added if some errors are detected.
+            \param [in] config The configuration of the syntaxes passed to sink.
+            \return true if no parse errors are detected.
+            \note Neither the whole source text nor the whole phrase syntax is kept, so the assignments can be filtered or distributed while parsing a large source text.
+            \note The local nonterminals are not passed to sink. The syntax passed to sink has the local nonterminals that the assignment refers to, so a local nonterminal must be assigned before it's used.
+            \note The assignment that has an error is skipped in the same way as the constructors, and the following assignments are passed to sink.
+            \note The redefinition of a nonterminal is detected when the syntaxes passed to sink are added into a Syntax.
+        */
+        template<typename T, typename S> REQUIRES_CharInputIteratorConcept(T, S)
+        static bool parse_each(T &&begin, S &&end, const AssignmentSink_t &sink,
+                               std::vector<std::string> &err_msg, const Config_t &config = Config_t{});
+        /** Parse a phrase syntax in a stream, and pass each assignment to a function as soon as it's parsed.
+            \param [inout] is The input stream.
+            \param [in] sink The function to receive the assignments.
+            \param [inout] err_msg The error messages are added if some errors are detected.
+            \param [in] config The configuration of the syntaxes passed to sink.
+            \return true if no parse errors are detected.
+            \note It's equivalent to parse_each() with std::istreambuf_iterator<char> of is.
+        */
+        static bool parse_each(std::istream &is, const AssignmentSink_t &sink,
+                               std::vector<std::string> &err_msg, const Config_t &config = Config_t{});
+
+        /** Replace the assignments with a phrase syntax, parsing only the changed assignments.
+            \param [in] src The source text of a phrase syntax.
+            \return true if no parse errors are detected.
+            \note The result is the same as Syntax(src) with the configuration of this, and the previous error messages are cleared.
+            \note The instance keeps a copy of src. The next call compares the new source text with it, and parses only the assignments in the changed range if possible. The first call, and the call after the other functions modify the instance, parse the whole text.
+            \note The whole text is also parsed if the changed range includes a local nonterminal, or some errors are detected.
+            \note Generator::update() binds only the production rules affected by the change, if the generator has the previous revision of this.
+        */
+        bool update(const std::string &src);
+
+        /** Link a library, which the nonterminals not assigned in this refer to.
+            \param [in] library The library. (shared)
+            \return true if the library has no errors.
+            \note The production rules in the library are referred by the syntaxes linked with it, not copied, and they have been bound when the library is created. The library is kept alive by the syntaxes and the generators that refer to it.
+            \note The assignments in this take precedence over the ones in the library. The libraries are searched in the order of linking.
+            \note The library that has some errors isn't linked, and its error messages are added to this.
+            \note The links are kept by update() and add() on this, and add() also links the libraries of the source syntax.
+        */
+        bool link(const std::shared_ptr<const SyntaxLibrary> &library);
+
+        /** Write the assignments into a binary snapshot.
+            \param [inout] os The output stream. It should be opened in the binary mode.
+            \return true if the snapshot is written without errors of the stream.
+            \note The snapshot doesn't contain the error messages, the configuration, and the gsub functions themselves.
+            \note The linked libraries are written with the assignments, and load() reads them as the libraries only for the instance.
+        */
+        bool save(std::ostream &os) const;
+        /** Replace the assignments with the ones in a binary snapshot.
+            \param [inout] is The input stream. It should be opened in the binary mode.
+            \return true if the snapshot is read successfully.
+            \note The snapshot must be written by save() of the same version of the library.
+            \note The gsub functions are created by the gsub creator in the configuration of this, or the process-wide one, as well as parsing the source text.
+            \note The error messages in this are kept, and an error message is added if the snapshot is broken. An empty phrase syntax is left in this case.
+        */
+        bool load(std::istream &is);
+
+        /** Get the breakdown of the memory held by the instance.
+            \return The estimated numbers of the bytes.
+            \note The assignments shared by the copies of the instance are counted in each copy. The linked libraries are counted too.
+            \note The source text kept for update() is counted in MemoryUsage_t::others.
+            \note See Generator::memory_usage() for the gsub functions.
+        */
+        MemoryUsage_t memory_usage() const;
 
         /** Get the error messages.
             \return The error messages that have been generated after creating the instance or clearing the previous error messages.
@@ -365,6 +559,12 @@ namespace tphrase {
         /** Clear the syntaxes and the error messages. */
         void clear();
 
+        /** Get the configuration.
+            \return The configuration.
+            \note The configuration is not changed by the assignment from another syntax by add().
+        */
+        const Config_t &get_config() const;
+
     private:
         /** The constructor to create an instance that has a syntax.
             \param [inout] it InputIterator of the source text of a phrase syntax.
@@ -382,6 +582,15 @@ namespace tphrase {
             \note If the source syntax has the nonterminal that this already contains, then: (1) the nonterminal in the source syntax overwrites it, (2) an error message is added to this, (3) true is returned unless some parse errors are detected.
         */
         bool add(InputIteratorBase &it);
+        /** Parse a phrase syntax, and pass each assignment to a function as soon as it's parsed.
+            \param [inout] it InputIterator of the source text of a phrase syntax.
+            \param [in] sink The function to receive the assignments.
+            \param [inout] err_msg The error messages are added if some errors are detected.
+            \param [in] config The configuration of the syntaxes passed to sink.
+            \return true if no parse errors are detected.
+        */
+        static bool parse_each(InputIteratorBase &it, const AssignmentSink_t &sink,
+                               std::vector<std::string> &err_msg, const Config_t &config);
 
         /** The function used by Generator.
             \return An instance of a type not to be published for the library users.
@@ -403,6 +612,50 @@ namespace tphrase {
         Impl *pimpl;
     };
 
+    /** The immutable phrase syntax shared by the syntaxes linked with it.
+
+        The production rules are bound when the instance is created, so their weights and numbers of the combinations are computed only once for all the linked syntaxes.
+    */
+    class SyntaxLibrary {
+        friend class Syntax;
+    public:
+        /** The constructor to create a library from a syntax.
+            \param [in] syntax The source syntax.
+            \note The error messages in syntax are copied, and some binding errors may be detected.
+            \note get_error_message() will return an empty vector if no errors are detected.
+            \note An empty library is created if some errors are detected.
+        */
+        explicit SyntaxLibrary(const Syntax &syntax);
+        /** The constructor to create a library from a syntax.
+            \param [inout] syntax The source syntax. (moved)
+            \note The error messages in syntax are moved, and some binding errors may be detected.
+            \note get_error_message() will return an empty vector if no errors are detected.
+            \note An empty library is created if some errors are detected.
+        */
+        explicit SyntaxLibrary(Syntax &&syntax);
+        SyntaxLibrary(const SyntaxLibrary &) = delete;
+        SyntaxLibrary &operator=(const SyntaxLibrary &) = delete;
+
+        /** The destructor. */
+        ~SyntaxLibrary() noexcept;
+
+        /** Get the error messages.
+            \return The error messages detected when the instance is created.
+        */
+        const std::vector<std::string> &get_error_message() const;
+
+    private:
+        /** The function used by Syntax.
+            \return An instance of a type not to be published for the library users.
+        */
+        const DataSyntax &get_library_data() const;
+
+    private:
+        struct Impl;
+        /** The private data. */
+        Impl *pimpl;
+    };
+
     template<typename T, typename S> REQUIRES_CharInputIteratorConcept(T, S)
     Syntax::Syntax(T &&begin, S &&end)
     {
@@ -418,6 +671,14 @@ namespace tphrase {
         InputIterator<T, S> it{begin, end};
         return add(it);
     }
+
+    template<typename T, typename S> REQUIRES_CharInputIteratorConcept(T, S)
+    bool Syntax::parse_each(T &&begin, S &&end, const AssignmentSink_t &sink,
+                            std::vector<std::string> &err_msg, const Config_t &config)
+    {
+        InputIterator<T, S> it{begin, end};
+        return parse_each(it, sink, err_msg, config);
+    }
 }
 
 #endif // TPHRASE_GENERATOR_H_
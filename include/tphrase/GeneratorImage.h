@@ -0,0 +1,131 @@
+/** The read-only phrase generator on a flat image.
+    \file GeneratorImage.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_GENERATORIMAGE_H_
+#define TPHRASE_GENERATORIMAGE_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "common/ext_context.h"
+
+namespace tphrase {
+    /** A read-only phrase generator that generates directly on a flat image.
+
+        The image is made by Generator::save_image(). It has no pointers, so it can be placed in a file or a shared memory segment, and the processes that map it share one physical copy.
+
+        \note The instance doesn't copy the production rules, the texts, and the weights from the image. Only the gsub functions are created in each process.
+    */
+    class GeneratorImage {
+    public:
+        /** The default constructor to create an empty instance. */
+        GeneratorImage();
+        /** The constructor to create an instance on an image in the memory.
+            \param [in] begin The beginning of the image.
+            \param [in] end The end of the image.
+            \param [in] config The configuration.
+            \note The caller must keep the image alive and unchanged until the instance is destroyed.
+            \note The gsub functions are created by config.gsub_creator, or the process-wide one if it's empty, as well as Generator::load(). The random function is created by config.random_creator if it's not empty.
+            \note An empty instance is created and an error message is added if the image is broken.
+        */
+        GeneratorImage(const char *begin, const char *end, const Config_t &config = Config_t{});
+        GeneratorImage(const GeneratorImage &a) = delete;
+        /** The move constructor.
+            \param [inout] a The source. (moved)
+        */
+        GeneratorImage(GeneratorImage &&a);
+
+        /** The destructor. */
+        ~GeneratorImage() noexcept;
+
+        GeneratorImage &operator=(const GeneratorImage &a) = delete;
+        /** The move assignment.
+            \param [inout] a The source. (moved)
+            \return *this
+        */
+        GeneratorImage &operator=(GeneratorImage &&a);
+
+        /** Create an instance on an image in a file.
+            \param [in] path The path of the file.
+            \param [in] config The configuration.
+            \return The instance.
+            \note The regular file is mapped read-only, so the processes that map the same file share the pages. The other files are read into the memory.
+            \note The error messages begin with the path, such as "image.bin: The file can't be opened."
+        */
+        static GeneratorImage from_file(const std::string &path, const Config_t &config = Config_t{});
+
+        /** Generate a phrase.
+            \return A phrase.
+            \note The empty instance returns "nil".
+            \note The result is the same as Generator::generate() of the generator that made the image, with the same random numbers.
+        */
+        std::string generate() const;
+        /** Generate a phrase.
+            \param [in] ext_context The external context that has some nonterminals and the substitutions.
+            \return A phrase.
+            \note The empty instance returns "nil".
+        */
+        std::string generate(const ExtContext_t &ext_context) const;
+
+        /** Get the error messages.
+            \return The error messages that have been generated after creating the instance.
+        */
+        const std::vector<std::string> &get_error_message() const;
+
+        /** Get the number of the syntaxes in the instance.
+            \return The number of the syntaxes in the instance.
+        */
+        std::size_t get_number_of_syntax() const;
+        /** Get the sum of the weight of the syntaxes in the instance.
+            \return The sum of the weight of the syntaxes in the instance.
+        */
+        double get_weight() const;
+        /** Get the number of the possible phrases generated by the instance.
+            \return The the number of the possible phrases generated by the instance.
+        */
+        std::size_t get_combination_number() const;
+
+    private:
+        struct Impl;
+        /** The private data. */
+        Impl *pimpl;
+    };
+}
+
+#endif // TPHRASE_GENERATORIMAGE_H_
@@ -39,6 +39,13 @@
 #ifndef TPHRASE_COMMON_INPUTITERATOR_H_
 #define TPHRASE_COMMON_INPUTITERATOR_H_
 
+#include <string>
+#include <type_traits>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
 #ifdef __cpp_concepts
 #include <concepts>
 #include <iterator>
@@ -66,6 +73,42 @@ namespace tphrase {
             \return the position is at the end.
         */
         virtual bool is_end() const = 0;
+        /** Consume the rest of the source if it's stored in a contiguous memory.
+            \param [out] begin The pointer to the beginning of the rest of the source.
+            \param [out] end The pointer to the end of the rest of the source.
+            \return true if the rest of the source is contiguous. begin and end are not changed if false is returned.
+            \note The position moves to the end if true is returned.
+        */
+        virtual bool consume_contiguous(const char *&begin, const char *&end)
+        {
+            static_cast<void>(begin);
+            static_cast<void>(end);
+            return false;
+        }
+    };
+
+    /** Is it a type of the iterator pointing to the contiguous chars?
+        \tparam T The type of an input iterator.
+        \tparam S The type of the end for T.
+        \note It's true only for the pointers to char and the iterators of std::string, std::vector<char>, and std::string_view, whose end type is the same.
+    */
+    template<typename T, typename S>
+    struct IsContiguousCharIterator {
+        /** The iterator type without the reference and the cv qualifiers. */
+        using Iter_t = typename std::remove_cv<typename std::remove_reference<T>::type>::type;
+        /** The result. */
+        static constexpr bool value
+            = std::is_same<Iter_t, typename std::remove_cv<typename std::remove_reference<S>::type>::type>::value
+            && (std::is_same<Iter_t, const char *>::value
+                || std::is_same<Iter_t, char *>::value
+                || std::is_same<Iter_t, std::string::const_iterator>::value
+                || std::is_same<Iter_t, std::string::iterator>::value
+                || std::is_same<Iter_t, std::vector<char>::const_iterator>::value
+                || std::is_same<Iter_t, std::vector<char>::iterator>::value
+#if __cplusplus >= 201703L
+                || std::is_same<Iter_t, std::string_view::const_iterator>::value
+#endif
+                );
     };
 
 #ifdef __cpp_concepts
@@ -108,8 +151,22 @@ namespace tphrase {
         virtual char operator*();
         virtual InputIterator<T, S> &operator++();
         virtual bool is_end() const;
+        virtual bool consume_contiguous(const char *&first, const char *&last);
 
     private:
+        /** consume_contiguous() for the contiguous iterators.
+            \param [out] first The pointer to the beginning of the rest of the source.
+            \param [out] last The pointer to the end of the rest of the source.
+            \return true
+        */
+        bool consume_contiguous(const char *&first, const char *&last, std::true_type);
+        /** consume_contiguous() for the other iterators.
+            \param [out] first Not used.
+            \param [out] last Not used.
+            \return false
+        */
+        bool consume_contiguous(const char *&first, const char *&last, std::false_type);
+
         T &cur; /**< The current position */
         S &end; /**< The end position */
     };
@@ -143,6 +200,34 @@ namespace tphrase {
     {
         return cur == end;
     }
+
+    template<typename T, typename S> REQUIRES_CharInputIteratorConcept(T, S)
+    bool InputIterator<T, S>::consume_contiguous(const char *&first, const char *&last)
+    {
+        return consume_contiguous(first, last, std::integral_constant<bool, IsContiguousCharIterator<T, S>::value>{});
+    }
+
+    template<typename T, typename S> REQUIRES_CharInputIteratorConcept(T, S)
+    bool InputIterator<T, S>::consume_contiguous(const char *&first, const char *&last, std::true_type)
+    {
+        if (cur == end) {
+            first = nullptr;
+            last = nullptr;
+        } else {
+            first = &*cur;
+            last = first + (end - cur);
+            cur = end;
+        }
+        return true;
+    }
+
+    template<typename T, typename S> REQUIRES_CharInputIteratorConcept(T, S)
+    bool InputIterator<T, S>::consume_contiguous(const char *&first, const char *&last, std::false_type)
+    {
+        static_cast<void>(first);
+        static_cast<void>(last);
+        return false;
+    }
 }
 
 #endif // TPHRASE_COMMON_INPUTITERATOR_H_
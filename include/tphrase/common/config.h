@@ -0,0 +1,68 @@
+/** The type of the configuration for Syntax and Generator.
+    \file config.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_COMMON_CONFIG_H_
+#define TPHRASE_COMMON_CONFIG_H_
+
+#include "gsub_func.h"
+#include "random_func.h"
+
+namespace tphrase {
+    /** The type of the configuration for Syntax and Generator.
+
+        The instance created with a configuration uses its own engines instead of the process-wide ones set by Generator::set_gsub_function_creator() and Generator::set_random_function().
+    */
+    struct Config_t {
+        /** The function to create the gsub functions at parsing the source text.
+            \note The process-wide gsub creator at parsing is used if it's empty.
+        */
+        GsubFuncCreator_t gsub_creator;
+        /** The function to create the random function for each Generator.
+            \note It's called once at creating the generator, and the copied generator has a copy of the random function of the source.
+            \note The process-wide random function at generating is used if it's empty.
+        */
+        RandomFuncCreator_t random_creator;
+        /** Create the gsub functions at the first use in generating a phrase, instead of at parsing the source text.
+            \note The errors in the gsub parameters are not detected at parsing. The gsub function that fails to be created substitutes "Gsub error: " and the error message for the text.
+            \note The literal gsubs that the library substitutes by itself are created at parsing because they are cheap.
+            \note The gsub functions are created thread-safely.
+        */
+        bool lazy_gsub{false};
+    };
+}
+
+#endif // TPHRASE_COMMON_CONFIG_H_
@@ -38,6 +38,7 @@
 #ifndef TPHRASE_COMMON_GSUB_FUNC_H_
 #define TPHRASE_COMMON_GSUB_FUNC_H_
 
+#include <cstddef>
 #include <functional>
 #include <string>
 
@@ -46,6 +47,16 @@ namespace tphrase {
     using GsubFunc_t = std::function<std::string(const std::string &)>;
     /** The type of the gsub function creator for Generator. */
     using GsubFuncCreator_t = std::function<GsubFunc_t (const std::string &, const std::string &, bool)>;
+
+    /** The type of the statistics of the process-wide cache of the gsub functions. */
+    struct GsubCacheStats_t {
+        std::size_t hits; /**< The number of the gsub functions found in the cache. */
+        std::size_t misses; /**< The number of the gsub functions created and put into the cache. */
+        std::size_t uncached; /**< The number of the gsub functions created without the cache. */
+        std::size_t evictions; /**< The number of the gsub functions removed from the full cache. */
+        std::size_t size; /**< The number of the gsub functions in the cache. */
+        std::size_t capacity; /**< The maximum number of the gsub functions in the cache. */
+    };
 }
 
 #endif // TPHRASE_COMMON_GSUB_FUNC_H_
@@ -0,0 +1,70 @@
+/** The type of the breakdown of the memory held by Syntax and Generator.
+    \file memory_usage.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_COMMON_MEMORY_USAGE_H_
+#define TPHRASE_COMMON_MEMORY_USAGE_H_
+
+#include <cstddef>
+
+namespace tphrase {
+    /** The type of the breakdown of the memory held by Syntax and Generator.
+        \note The numbers are the bytes estimated from the capacities of the containers, so they don't include the overhead of the allocator.
+        \note The objects shared by the syntaxes in the instance are counted once, but the objects shared with other instances are counted in each instance.
+    */
+    struct MemoryUsage_t {
+        std::size_t assignments{0}; /**< The bytes of the assignment tables and the syntaxes. */
+        std::size_t rules{0}; /**< The bytes of the production rules, excluding the texts and the gsubs in them. */
+        std::size_t texts{0}; /**< The bytes of the texts, excluding the parts in them. */
+        std::size_t parts{0}; /**< The bytes of the parts of the texts. */
+        std::size_t literals{0}; /**< The bytes of the strings and the names of the nonterminals in the texts. */
+        std::size_t weights{0}; /**< The bytes of the cumulative weight arrays. */
+        std::size_t gsubs{0}; /**< The bytes of the gsub parameters and the gsub functions, including an estimate for the internals of the regular expressions. */
+        std::size_t error_messages{0}; /**< The bytes of the error messages. */
+        std::size_t arena_slack{0}; /**< The bytes of the blocks of the arenas that the numbers above don't use, such as the free space and the space left by the modification. */
+        std::size_t others{0}; /**< The bytes of the others, such as the source text kept for the update. */
+
+        /** Get the total bytes.
+            \return The sum of all the numbers.
+        */
+        std::size_t total() const
+        {
+            return assignments + rules + texts + parts + literals + weights + gsubs + error_messages + arena_slack + others;
+        }
+    };
+}
+
+#endif // TPHRASE_COMMON_MEMORY_USAGE_H_
@@ -43,6 +43,8 @@
 namespace tphrase {
     /** The type of the random function for Generator. */
     using RandomFunc_t = std::function<double()>;
+    /** The type of the random function creator for Generator. */
+    using RandomFuncCreator_t = std::function<RandomFunc_t ()>;
 }
 
 #endif // TPHRASE_COMMON_RANDOM_FUNC_H_
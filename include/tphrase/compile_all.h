@@ -0,0 +1,77 @@
+/** The parallel compilation of many phrase syntaxes.
+    \file compile_all.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_COMPILE_ALL_H_
+#define TPHRASE_COMPILE_ALL_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Generator.h"
+#include "common/config.h"
+
+namespace tphrase {
+    /** Parse many independent phrase syntaxes concurrently.
+        \param [in] sources The source texts of the phrase syntaxes.
+        \param [in] threads The maximum number of the threads. If it's 0, std::thread::hardware_concurrency() is used.
+        \param [in] config The configuration for each instance.
+        \return The instances of Syntax in the order of sources. Each instance has the error messages for its source text.
+        \note It's equivalent to creating Syntax(config) and calling Syntax::add(sources[i]) for each i.
+        \note The gsub functions are created in the worker threads, so config.gsub_creator, or the process-wide gsub creator if it's empty, must be callable from multiple threads concurrently. The built-in gsub creators are thread-safe.
+        \note Generator::set_gsub_function_creator() must not be called until it returns.
+        \note If an exception is thrown in a worker thread, it's rethrown after all the threads finish.
+    */
+    extern std::vector<Syntax> compile_all(const std::vector<std::string> &sources,
+                                           std::size_t threads = 0,
+                                           const Config_t &config = Config_t{});
+
+    /** Parse and bind many independent phrase syntaxes concurrently.
+        \param [in] sources The source texts of the phrase syntaxes.
+        \param [in] threads The maximum number of the threads. If it's 0, std::thread::hardware_concurrency() is used.
+        \param [in] config The configuration for each instance.
+        \return The instances of Generator in the order of sources. Each instance has the error messages for its source text, including the errors detected at the binding, such as the recursive expansions.
+        \note It's equivalent to Generator(Syntax) for each instance created by compile_all(), so the start condition is "main".
+        \note config.random_creator, if it's not empty, is called in the worker threads.
+        \note The same restrictions as compile_all() apply.
+    */
+    extern std::vector<Generator> compile_all_generators(const std::vector<std::string> &sources,
+                                                         std::size_t threads = 0,
+                                                         const Config_t &config = Config_t{});
+}
+
+#endif // TPHRASE_COMPILE_ALL_H_
@@ -0,0 +1,67 @@
+/** The gsub function creator for UTF-8.
+    \file utf8_gsub.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_UTF8_GSUB_H_
+#define TPHRASE_UTF8_GSUB_H_
+
+#include <string>
+
+#include "common/gsub_func.h"
+
+namespace tphrase {
+    /** Create a gsub function that treats the strings as UTF-8.
+        \param [in] pattern Pattern parameter for gsub.
+        \param [in] repl Replacement parameter for gsub.
+        \param [in] global Global parameter for gsub.
+        \return The substituting function with a string to substitute.
+        \throw std::runtime_error if the pattern is invalid.
+        \note The pattern is a subset of the ECMAScript regex grammar. "." and the character classes match a code point instead of a byte.
+        \note "\p{...}" and "\P{...}" accept the general categories of Unicode, such as "\p{L}", "\p{Lu}", "\p{Letter}", and "\p{gc=Lu}".
+        \note "\d", "\w", "\b", and "\B" are for ASCII, as well as ECMAScript.
+        \note The backreference and the lookaround assertion aren't supported.
+        \note The replacement is the ECMAScript format: "$$", "$&", "$`", "$'", "$n", and "$nn".
+        \note An invalid byte in UTF-8 is treated as a code point that matches only the same byte.
+
+        Example:
+        \code
+        tphrase::Generator::set_gsub_function_creator(tphrase::create_utf8_gsub);
+        \endcode
+    */
+    extern GsubFunc_t create_utf8_gsub(const std::string &pattern, const std::string &repl, bool global);
+}
+
+#endif // TPHRASE_UTF8_GSUB_H_
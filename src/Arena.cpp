@@ -0,0 +1,152 @@
+/** The memory arena for the syntax graph.
+    \file Arena.cpp
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#include <cstdint>
+#include <new>
+
+#include "Arena.h"
+
+namespace {
+    /** The size of the first block. */
+    constexpr std::size_t first_block_size{1024};
+    /** The maximum size of the blocks, except for the allocation larger than it. */
+    constexpr std::size_t max_block_size{256 * 1024};
+
+    /** The arena of the innermost scope in the current thread. */
+    thread_local tphrase::Arena *current_arena{nullptr};
+}
+
+namespace tphrase {
+    Arena::Arena()
+        : Arena{first_block_size}
+    {
+    }
+
+    Arena::Arena(std::size_t block_size)
+        : mutex{},
+          blocks{},
+          top{nullptr},
+          end{nullptr},
+          next_block_size{block_size},
+          total_size{0}
+    {
+    }
+
+    Arena::~Arena() noexcept
+    {
+        for (auto *block : blocks) {
+            ::operator delete(block);
+        }
+    }
+
+    void *Arena::allocate(std::size_t size, std::size_t align)
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        char *p{top.load(std::memory_order_relaxed)};
+        const auto misalignment = reinterpret_cast<std::uintptr_t>(p) % align;
+        std::size_t padding{misalignment == 0 ? 0 : align - misalignment};
+        if (p == nullptr || static_cast<std::size_t>(end - p) < padding + size) {
+            std::size_t block_size{next_block_size};
+            if (block_size < size + align) {
+                // A large allocation gets its own block, and the following allocations continue in it.
+                block_size = size + align;
+            } else if (next_block_size < max_block_size) {
+                next_block_size *= 2;
+            }
+            if (next_block_size < first_block_size) {
+                // The block fitting the known size is followed by the ordinary blocks if the size is underestimated.
+                next_block_size = first_block_size;
+            }
+            blocks.reserve(blocks.size() + 1);
+            char *block{static_cast<char *>(::operator new(block_size))};
+            blocks.push_back(block);
+            total_size += block_size;
+            p = block;
+            end = block + block_size;
+            // The memory from operator new is aligned for any fundamental type.
+            padding = 0;
+        }
+        p += padding;
+        top.store(p + size, std::memory_order_relaxed);
+        return p;
+    }
+
+    void Arena::deallocate(void *p, std::size_t size) noexcept
+    {
+        // Most of the deallocations can't be rolled back, so they don't take the mutex.
+        char *last{static_cast<char *>(p) + size};
+        if (last != top.load(std::memory_order_relaxed)) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock{mutex};
+        top.compare_exchange_strong(last, static_cast<char *>(p), std::memory_order_relaxed);
+    }
+
+    std::size_t Arena::get_size() const
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        return total_size;
+    }
+
+    std::shared_ptr<Arena> Arena::get_current()
+    {
+        if (current_arena) {
+            return current_arena->shared_from_this();
+        } else {
+            return nullptr;
+        }
+    }
+
+    ArenaScope::ArenaScope()
+        : arena{std::make_shared<Arena>()},
+          outer{current_arena}
+    {
+        current_arena = arena.get();
+    }
+
+    ArenaScope::ArenaScope(std::size_t block_size)
+        : arena{std::make_shared<Arena>(block_size)},
+          outer{current_arena}
+    {
+        current_arena = arena.get();
+    }
+
+    ArenaScope::~ArenaScope() noexcept
+    {
+        current_arena = outer;
+    }
+}
@@ -0,0 +1,231 @@
+/** The memory arena for the syntax graph.
+    \file Arena.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_SRC_ARENA_H_
+#define TPHRASE_SRC_ARENA_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace tphrase {
+    /** The monotonic memory arena.
+
+        The memory is carved out of a few large blocks, and it's released all at once when the arena is destroyed. The deallocation doesn't release any memory, except that the last allocation is rolled back so that a growing vector reuses its memory.
+
+        \note The arena is shared by ArenaAllocator, so it lives while a container allocated in it lives.
+        \note The instance is thread safe.
+    */
+    class Arena : public std::enable_shared_from_this<Arena> {
+    public:
+        /** The default constructor. */
+        Arena();
+        /** The constructor with the size of the first block.
+            \param [in] block_size The size of the first block.
+            \note It's used for the arena whose size is known in advance, so it isn't wasted by the free space of the last block.
+        */
+        explicit Arena(std::size_t block_size);
+        Arena(const Arena &a) = delete;
+        Arena &operator=(const Arena &a) = delete;
+        /** The destructor. */
+        ~Arena() noexcept;
+
+        /** Allocate a memory.
+            \param [in] size The size of the memory.
+            \param [in] align The alignment of the memory.
+            \return The memory.
+            \note It throws std::bad_alloc if it runs out of the memory.
+        */
+        void *allocate(std::size_t size, std::size_t align);
+        /** Deallocate a memory.
+            \param [in] p The memory allocated by allocate().
+            \param [in] size The size of the memory.
+        */
+        void deallocate(void *p, std::size_t size) noexcept;
+        /** Get the size of the memory held by the arena.
+            \return The total size of the blocks.
+        */
+        std::size_t get_size() const;
+
+        /** Get the arena used by the containers created in the current thread.
+            \return The arena set by the innermost ArenaScope, or nullptr if no ArenaScope is in the current thread.
+        */
+        static std::shared_ptr<Arena> get_current();
+
+    private:
+        mutable std::mutex mutex; /**< The mutex for the blocks. */
+        std::vector<void *> blocks; /**< The blocks of the memory. */
+        std::atomic<char *> top; /**< The top of the free space in the last block, which can be read without the mutex. */
+        char *end; /**< The end of the last block. */
+        std::size_t next_block_size; /**< The size of the next block. */
+        std::size_t total_size; /**< The total size of the blocks. */
+    };
+
+    /** The scope in which the containers of the syntax graph are allocated in an arena.
+        \note The scopes can be nested in a thread, and the innermost scope is effective.
+    */
+    class ArenaScope {
+    public:
+        /** The constructor with a new arena. */
+        ArenaScope();
+        /** The constructor with a new arena whose first block has the specified size.
+            \param [in] block_size The size of the first block.
+        */
+        explicit ArenaScope(std::size_t block_size);
+        ArenaScope(const ArenaScope &a) = delete;
+        ArenaScope &operator=(const ArenaScope &a) = delete;
+        /** The destructor. */
+        ~ArenaScope() noexcept;
+
+    private:
+        std::shared_ptr<Arena> arena; /**< The arena of the scope. */
+        Arena *outer; /**< The arena of the outer scope. */
+    };
+
+    /** The allocator using the arena of the scope in which the container is created.
+
+        The allocator falls back on the global operator new if it's created out of any ArenaScope.
+
+        \tparam T The type of the elements.
+        \note The copied container is allocated in the arena of the scope in which it's copied, rather than the arena of the source.
+    */
+    template <typename T>
+    class ArenaAllocator {
+    public:
+        using value_type = T; /**< The type of the elements. */
+        using propagate_on_container_copy_assignment = std::false_type; /**< The destination keeps its arena. */
+        using propagate_on_container_move_assignment = std::true_type; /**< The destination takes the memory of the source. */
+        using propagate_on_container_swap = std::true_type; /**< The memories are swapped. */
+
+        /** The default constructor, which uses the arena of the current scope. */
+        ArenaAllocator()
+            : arena{Arena::get_current()}
+        {
+        }
+        /** The converting constructor.
+            \param [in] a The source.
+        */
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U> &a)
+            : arena{a.arena}
+        {
+        }
+
+        /** Allocate the memory for the elements.
+            \param [in] n The number of the elements.
+            \return The memory.
+        */
+        T *allocate(std::size_t n)
+        {
+            if (arena) {
+                return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T)));
+            } else {
+                return static_cast<T *>(::operator new(n * sizeof(T)));
+            }
+        }
+        /** Deallocate the memory for the elements.
+            \param [in] p The memory.
+            \param [in] n The number of the elements.
+        */
+        void deallocate(T *p, std::size_t n) noexcept
+        {
+            if (arena) {
+                arena->deallocate(p, n * sizeof(T));
+            } else {
+                ::operator delete(p);
+            }
+        }
+        /** Get the allocator for the copy of the container.
+            \return The allocator using the arena of the current scope.
+        */
+        ArenaAllocator select_on_container_copy_construction() const
+        {
+            return ArenaAllocator{};
+        }
+        /** Get the arena.
+            \return The arena, or nullptr if the global operator new is used.
+        */
+        const Arena *get_arena() const
+        {
+            return arena.get();
+        }
+
+        /** Compare the allocators.
+            \param [in] a The other allocator.
+            \return true if the memory allocated by one can be deallocated by the other.
+        */
+        template <typename U>
+        bool operator==(const ArenaAllocator<U> &a) const
+        {
+            return arena == a.arena;
+        }
+        /** Compare the allocators.
+            \param [in] a The other allocator.
+            \return true if the memory allocated by one can't be deallocated by the other.
+        */
+        template <typename U>
+        bool operator!=(const ArenaAllocator<U> &a) const
+        {
+            return arena != a.arena;
+        }
+
+    private:
+        template <typename U> friend class ArenaAllocator;
+
+        std::shared_ptr<Arena> arena; /**< The arena, or nullptr if the global operator new is used. */
+    };
+
+    /** The vector allocated in the arena. */
+    template <typename T>
+    using ArenaVector_t = std::vector<T, ArenaAllocator<T>>;
+
+    /** Get the size of the arena used by a copy of a vector.
+        \param [in] v The vector.
+        \return The number of the bytes of the elements, including the padding for the alignment. The objects that the elements own aren't included.
+    */
+    template <typename T>
+    std::size_t get_copy_size(const ArenaVector_t<T> &v)
+    {
+        return v.empty() ? 0 : v.size() * sizeof(T) + alignof(T) - 1;
+    }
+}
+
+#endif // TPHRASE_SRC_ARENA_H_
@@ -36,17 +36,28 @@
 */
 
 #include <cstddef>
+#include <cstring>
+#include <string>
 
 #include "CharFeeder.h"
+#include "scan.h"
 #include "tphrase/common/InputIterator.h"
 
 namespace tphrase {
     CharFeeder::CharFeeder(InputIteratorBase &it)
         : next_pos(&it),
+          pos(nullptr),
+          end(nullptr),
           num_c(0),
           line(1),
-          column(1)
+          column(1),
+          offset(0)
     {
+        if (it.consume_contiguous(pos, end)) {
+            next_pos = nullptr;
+            load_contiguous();
+            return;
+        }
         for (std::size_t i = 0; i <= LOOKAHEAD; ++i) {
             if (!next_pos->is_end()) {
                 c[i] = **next_pos;
@@ -70,6 +81,13 @@ namespace tphrase {
         } else {
             ++column;
         }
+        ++offset;
+
+        if (!next_pos) {
+            ++pos;
+            load_contiguous();
+            return;
+        }
 
         c[0] = c[1];
         if (!next_pos->is_end()) {
@@ -80,4 +98,59 @@ namespace tphrase {
             --num_c;
         }
     }
+
+    void CharFeeder::load_contiguous()
+    {
+        num_c = 0;
+        for (std::size_t i = 0; i <= LOOKAHEAD; ++i) {
+            if (static_cast<std::size_t>(end - pos) > i) {
+                c[i] = pos[i];
+                ++num_c;
+            } else {
+                c[i] = '\0';
+            }
+        }
+    }
+
+    void CharFeeder::read_until(std::string &s, const char *stops, const std::size_t num_stops)
+    {
+        if (next_pos) {
+            while (!is_end() && !std::memchr(stops, getc(), num_stops)) {
+                s += getc();
+                next();
+            }
+            return;
+        }
+
+        const char *p{pos};
+        advance_to(find_first_of(pos, end, stops, num_stops));
+        s.append(p, pos);
+    }
+
+    void CharFeeder::skip_until(const char *stops, const std::size_t num_stops)
+    {
+        if (next_pos) {
+            while (!is_end() && !std::memchr(stops, getc(), num_stops)) {
+                next();
+            }
+            return;
+        }
+
+        advance_to(find_first_of(pos, end, stops, num_stops));
+    }
+
+    void CharFeeder::advance_to(const char *p)
+    {
+        const char *last_nl{nullptr};
+        const std::size_t n{count_newlines(pos, p, last_nl)};
+        if (n == 0) {
+            column += p - pos;
+        } else {
+            line += n;
+            column = p - last_nl;
+        }
+        offset += p - pos;
+        pos = p;
+        load_contiguous();
+    }
 }
@@ -39,6 +39,7 @@
 #define TPHRASE_SRC_CHARFEEDER_H_
 
 #include <cstddef>
+#include <string>
 
 namespace tphrase {
     class InputIteratorBase;
@@ -47,6 +48,8 @@ namespace tphrase {
 
         It's able to look ahead one character.
 
+        If the source is stored in a contiguous memory, it reads the characters from the memory directly without the virtual function calls of InputIteratorBase.
+
         \note The instance doesn't own the iterator and something to be referred by it, so the users must keep the iterator and the referred object alive until the instance is unused.
     */
     class CharFeeder {
@@ -84,6 +87,30 @@ namespace tphrase {
         */
         void next();
 
+        /** Append the characters to a string while a predicate is satisfied.
+            \tparam F The type of the predicate.
+            \param [inout] s The string to which the characters are appended.
+            \param [in] pred The predicate bool(char). It stops before the first character that doesn't satisfy pred.
+            \note It stops also at the end.
+            \note It appends the run of the characters at once if the source is contiguous.
+        */
+        template<typename F>
+        void read_while(std::string &s, F pred);
+        /** Append the characters to a string until one of the stop characters.
+            \param [inout] s The string to which the characters are appended.
+            \param [in] stops The stop characters.
+            \param [in] num_stops The number of the stop characters.
+            \note It stops also at the end.
+            \note It finds the stop character with find_first_of() and appends the run at once if the source is contiguous.
+        */
+        void read_until(std::string &s, const char *stops, std::size_t num_stops);
+        /** Skip the characters until one of the stop characters.
+            \param [in] stops The stop characters.
+            \param [in] num_stops The number of the stop characters.
+            \note It stops also at the end.
+        */
+        void skip_until(const char *stops, std::size_t num_stops);
+
         /** Get the line number of the current position.
             \return The line number.
         */
@@ -93,19 +120,35 @@ namespace tphrase {
             \note The unit of the column number is byte.
         */
         std::size_t get_column_number() const;
+        /** Get the offset of the current position.
+            \return The number of the characters before the current position.
+        */
+        std::size_t get_offset() const;
 
     private:
+        /** Load the character buffer from the current position in the contiguous source. */
+        void load_contiguous();
+        /** Move the current position forward in the contiguous source.
+            \param [in] p The new position.
+            \note The line number is updated by counting the newlines between the positions.
+        */
+        void advance_to(const char *p);
+
         /** The number of the lookahead character. */
         static constexpr std::size_t LOOKAHEAD = 1;
 
         /** The iterator to point to the next position.
             \note The instance doesn't own the iterator.
+            \note It's nullptr if the source is contiguous.
         */
         InputIteratorBase *next_pos;
+        const char *pos; /**< The current position in the contiguous source. */
+        const char *end; /**< The end of the contiguous source. */
         char c[LOOKAHEAD + 1]; /**< The character buffer. */
         std::size_t num_c; /**< The number of the valid characters in c. */
         std::size_t line; /**< The line number at the current position. */
         std::size_t column; /**< The column number at the current position. */
+        std::size_t offset; /**< The offset of the current position. */
     };
 
     inline
@@ -132,6 +175,32 @@ namespace tphrase {
         return num_c == 1;
     }
 
+    template<typename F>
+    void CharFeeder::read_while(std::string &s, F pred)
+    {
+        if (next_pos) {
+            while (!is_end() && pred(getc())) {
+                s += getc();
+                next();
+            }
+            return;
+        }
+
+        const char *p{pos};
+        for (; p != end && pred(*p); ++p) {
+            if (*p == '\n') {
+                ++line;
+                column = 1;
+            } else {
+                ++column;
+            }
+        }
+        s.append(pos, p);
+        offset += p - pos;
+        pos = p;
+        load_contiguous();
+    }
+
     inline
     std::size_t CharFeeder::get_line_number() const
     {
@@ -143,6 +212,12 @@ namespace tphrase {
     {
         return column;
     }
+
+    inline
+    std::size_t CharFeeder::get_offset() const
+    {
+        return offset;
+    }
 }
 
 #endif // TPHRASE_SRC_CHARFEEDER_H_
@@ -35,10 +35,20 @@
     \endparblock
 */
 
+#include <memory>
+#include <mutex>
 #include <regex>
 #include <stdexcept>
+#include <utility>
 
+#include "tphrase/utf8_gsub.h"
 #include "DataGsubs.h"
+#include "LiteralGsubs.h"
+#include "gsub_cache.h"
+#include "heap_size.h"
+#include "pattern_analysis.h"
+#include "snapshot.h"
+#include "utf8.h"
 
 namespace {
     /** Make a substituting function out of std::regex.
@@ -68,22 +78,338 @@ namespace {
 
     /** The default function to create the gsub function. */
     tphrase::GsubFuncCreator_t gsub_creator = create_regex_gsub;
+
+    /** Is the creator a built-in one?
+        \param [in] creator The function to create the gsub functions.
+        \param [out] is_utf8 true if the creator is create_utf8_gsub().
+        \return true if the creator is create_regex_gsub() or create_utf8_gsub().
+        \note The gsub functions created by the built-in creators use the ECMAScript regex grammar, and return the source if the pattern doesn't match.
+    */
+    bool is_builtin_gsub_creator(const tphrase::GsubFuncCreator_t &creator, bool &is_utf8)
+    {
+        using Creator_t = tphrase::GsubFunc_t (*)(const std::string &, const std::string &, bool);
+        const Creator_t *f{creator.target<Creator_t>()};
+        is_utf8 = f != nullptr && *f == tphrase::create_utf8_gsub;
+        return f != nullptr && (*f == create_regex_gsub || is_utf8);
+    }
+
+    /** Get the identity of a gsub function creator.
+        \param [in] creator The function to create the gsub functions.
+        \return The plain function of the creator, or nullptr if the creator isn't a plain function.
+    */
+    tphrase::DataGsubs::CreatorID_t get_creator_id(const tphrase::GsubFuncCreator_t &creator)
+    {
+        const tphrase::DataGsubs::CreatorID_t *f{creator.target<tphrase::DataGsubs::CreatorID_t>()};
+        return f != nullptr ? *f : nullptr;
+    }
+
+    /** Can the literal gsub substitute for the gsub function made by the creator?
+        \param [in] creator The function to create the gsub functions.
+        \param [in] pattern The literal pattern.
+        \return true if the creator is create_regex_gsub(), or create_utf8_gsub() with the pattern in UTF-8.
+        \note The byte sequence of the pattern in UTF-8 matches only at the boundaries of the code points.
+    */
+    bool is_literal_gsub_creator(const tphrase::GsubFuncCreator_t &creator, const std::string &pattern)
+    {
+        bool is_utf8;
+        return is_builtin_gsub_creator(creator, is_utf8)
+            && (!is_utf8 || tphrase::is_valid_utf8(pattern));
+    }
+
+    /** The gsub function created at the first use. */
+    class LazyGsub {
+    public:
+        LazyGsub() = delete;
+        /** The constructor.
+            \param [in] creator The function to create the gsub function.
+            \param [in] pattern The pattern parameter of gsub.
+            \param [in] repl The replacement parameter of gsub.
+            \param [in] global The global parameter of gsub.
+        */
+        LazyGsub(const tphrase::GsubFuncCreator_t &creator,
+                 const std::string &pattern,
+                 const std::string &repl,
+                 bool global);
+        LazyGsub(const LazyGsub &a) = delete;
+        LazyGsub &operator=(const LazyGsub &a) = delete;
+
+        /** Substitute a string.
+            \param [in] s The source string.
+            \return Substituted string.
+            \note The gsub function is created at the first call.
+        */
+        std::string gsub(const std::string &s) const;
+
+    private:
+        tphrase::GsubFuncCreator_t creator; /**< The function to create the gsub function. */
+        std::string pattern; /**< The pattern parameter of gsub. */
+        std::string repl; /**< The replacement parameter of gsub. */
+        bool global; /**< The global parameter of gsub. */
+        mutable std::once_flag once; /**< The flag to create the gsub function. */
+        mutable std::shared_ptr<const tphrase::GsubFunc_t> func; /**< The gsub function, or nullptr before the first call. */
+    };
+
+    LazyGsub::LazyGsub(const tphrase::GsubFuncCreator_t &in_creator,
+                       const std::string &in_pattern,
+                       const std::string &in_repl,
+                       const bool in_global)
+        : creator{in_creator}, pattern{in_pattern}, repl{in_repl}, global{in_global}, once{}, func{}
+    {
+    }
+
+    std::string LazyGsub::gsub(const std::string &s) const
+    {
+        std::call_once(once, [this]() {
+            try {
+                func = tphrase::get_gsub_function(creator, pattern, repl, global);
+            } catch (const std::runtime_error &e) {
+                std::string msg{"Gsub error: "};
+                msg += e.what();
+                func = std::make_shared<const tphrase::GsubFunc_t>([msg](const std::string &) {
+                    return msg;
+                });
+            }
+        });
+        return (*func)(s);
+    }
+
+    /** Estimate the number of the bytes allocated by a gsub function created by a built-in gsub creator.
+        \param [in] pattern The pattern parameter of the gsub function.
+        \return The estimated number of the bytes.
+        \note The compiled regular expressions have a fixed overhead and a few states of tens of bytes per byte of the pattern. The constants are measured with std::regex of libstdc++, which is larger than Utf8Regex.
+    */
+    std::size_t estimate_builtin_gsub_size(const std::string &pattern)
+    {
+        return 1024 + 256 * pattern.size();
+    }
 }
 
 namespace tphrase {
 
+    DataGsubs::Step_t::Step_t(std::shared_ptr<const GsubFunc_t> &&f, std::string &&req,
+                              const std::string &pat, const std::string &rep, const bool glob, const bool builtin, const CreatorID_t id)
+        : func{std::move(f)}, literal{}, creator{id}, required{std::move(req)}, pattern{pat}, repl{rep}, global{glob}, is_builtin{builtin}, is_dead{false}
+    {
+    }
+
+    DataGsubs::Step_t::Step_t(std::shared_ptr<const LiteralGsubs> &&l)
+        : func{}, literal{std::move(l)}, creator{nullptr}, required{}, pattern{}, repl{}, global{false}, is_builtin{true}, is_dead{false}
+    {
+    }
+
     std::string DataGsubs::gsub(std::string &&s) const
     {
         std::string r{std::move(s)};
-        for (const auto &f : gsubs_f) {
-            r = f(r);
+        for (const auto &step : steps) {
+            if (step.is_dead) {
+                continue;
+            } else if (step.literal) {
+                r = step.literal->gsub(r);
+            } else if (step.required.empty() || r.find(step.required) != std::string::npos) {
+                r = (*step.func)(r);
+            }
         }
         return r;
     }
 
-    void DataGsubs::add_parameter(const std::string &pattern, const std::string &repl, const bool global)
+    void DataGsubs::add_parameter(const std::string &pattern, const std::string &repl, const bool global,
+                                  const Config_t &config)
     {
-        gsubs_f.emplace_back(gsub_creator(pattern, repl, global));
+        const GsubFuncCreator_t &creator{config.gsub_creator};
+        std::string literal_pattern;
+        std::string literal_repl;
+        if (get_literal_pattern(pattern, literal_pattern)
+            && is_literal_gsub_creator(creator, literal_pattern)
+            && get_literal_replacement(repl, literal_repl)) {
+            if (!steps.empty()
+                && steps.back().literal
+                && steps.back().literal->can_fuse(literal_pattern, global)) {
+                // The fused gsubs may be shared by the copies, so it's rebuilt.
+                std::shared_ptr<LiteralGsubs> fused{std::make_shared<LiteralGsubs>(*steps.back().literal)};
+                fused->fuse(literal_pattern, literal_repl);
+                steps.back().literal = std::move(fused);
+            } else {
+                steps.emplace_back(std::make_shared<const LiteralGsubs>(literal_pattern, literal_repl, global));
+            }
+        } else {
+            bool is_builtin;
+            std::shared_ptr<const GsubFunc_t> func{create_function(pattern, repl, global, config, is_builtin)};
+            std::string required;
+            if (is_builtin) {
+                required = get_required_literal(pattern);
+            }
+            steps.emplace_back(std::move(func), std::move(required), pattern, repl, global, is_builtin, get_creator_id(config.gsub_creator));
+        }
+    }
+
+    std::shared_ptr<const GsubFunc_t> DataGsubs::create_function(const std::string &pattern, const std::string &repl, const bool global,
+                                                                 const Config_t &config, bool &is_builtin)
+    {
+        const GsubFuncCreator_t &creator{config.gsub_creator};
+        bool is_utf8;
+        is_builtin = is_builtin_gsub_creator(creator, is_utf8);
+        if (config.lazy_gsub) {
+            const std::shared_ptr<const LazyGsub> lazy{std::make_shared<const LazyGsub>(creator, pattern, repl, global)};
+            return std::make_shared<const GsubFunc_t>([lazy](const std::string &s) {
+                return lazy->gsub(s);
+            });
+        } else {
+            return get_gsub_function(creator, pattern, repl, global);
+        }
+    }
+
+    ByteAlphabet_t DataGsubs::eliminate_dead_gsubs(const ByteAlphabet_t &input)
+    {
+        ByteAlphabet_t alphabet{input};
+        eliminated.clear();
+        for (auto it = steps.begin(); it != steps.end(); ++it) {
+            bool is_dead{false};
+            if (it->literal) {
+                is_dead = true;
+                for (const auto &pat : it->literal->get_patterns()) {
+                    is_dead = is_dead && !has_all_bytes(alphabet, pat);
+                }
+                if (is_dead) {
+                    for (const auto &pat : it->literal->get_patterns()) {
+                        eliminated.emplace_back(pat);
+                    }
+                } else {
+                    for (const auto &rep : it->literal->get_replacements()) {
+                        add_bytes(alphabet, rep);
+                    }
+                }
+            } else if (it->is_builtin) {
+                is_dead = !has_all_bytes(alphabet, it->required);
+                if (is_dead) {
+                    eliminated.emplace_back(it->pattern);
+                } else {
+                    // The replacement may copy the source, but it can't generate a new byte other than the bytes in the replacement.
+                    add_bytes(alphabet, it->repl);
+                }
+            } else {
+                alphabet.set();
+            }
+            it->is_dead = is_dead;
+        }
+        return alphabet;
+    }
+
+    const std::vector<std::string> &DataGsubs::get_eliminated_gsubs() const
+    {
+        return eliminated;
+    }
+
+    void DataGsubs::collect_creators(std::vector<CreatorID_t> &creators) const
+    {
+        for (const auto &step : steps) {
+            if (step.func) {
+                creators.emplace_back(step.creator);
+            }
+        }
+    }
+
+    void DataGsubs::count_memory(MemoryCounter &counter) const
+    {
+        MemoryUsage_t &usage{counter.usage};
+        usage.gsubs += steps.capacity() * sizeof(Step_t) + get_heap_size(eliminated);
+        for (const auto &step : steps) {
+            usage.gsubs += get_heap_size(step.required) + get_heap_size(step.pattern) + get_heap_size(step.repl);
+            // The gsub functions and the literal gsubs are shared by the copies and the process-wide cache.
+            if (step.func && counter.is_first(step.func.get())) {
+                usage.gsubs += SHARED_OBJECT_OVERHEAD + sizeof(GsubFunc_t);
+                if (step.is_builtin) {
+                    // The lazy gsub function is counted as if it's created.
+                    usage.gsubs += estimate_builtin_gsub_size(step.pattern);
+                }
+            }
+            if (step.literal && counter.is_first(step.literal.get())) {
+                usage.gsubs += SHARED_OBJECT_OVERHEAD + sizeof(LiteralGsubs) + step.literal->get_heap_size();
+            }
+        }
+    }
+
+    void DataGsubs::save(SnapshotWriter &w) const
+    {
+        w.write_size(steps.size());
+        for (const auto &step : steps) {
+            w.write_bool(static_cast<bool>(step.literal));
+            if (step.literal) {
+                const auto &patterns = step.literal->get_patterns();
+                const auto &repls = step.literal->get_replacements();
+                w.write_bool(step.literal->is_global());
+                w.write_size(patterns.size());
+                for (std::size_t i = 0; i < patterns.size(); ++i) {
+                    w.write_string(patterns[i]);
+                    w.write_string(repls[i]);
+                }
+            } else {
+                w.write_string(step.pattern);
+                w.write_string(step.repl);
+                w.write_bool(step.global);
+            }
+            w.write_bool(step.is_dead);
+        }
+        w.write_size(eliminated.size());
+        for (const auto &pattern : eliminated) {
+            w.write_string(pattern);
+        }
+    }
+
+    void DataGsubs::load(SnapshotReader &r, const Config_t &config)
+    {
+        steps.clear();
+        eliminated.clear();
+        const std::size_t num_steps{r.read_size()};
+        for (std::size_t n = 0; n < num_steps && r.good(); ++n) {
+            if (r.read_bool()) {
+                const bool global{r.read_bool()};
+                const std::size_t num_pairs{r.read_size()};
+                std::shared_ptr<LiteralGsubs> literal;
+                for (std::size_t i = 0; i < num_pairs && r.good(); ++i) {
+                    const std::string pattern{r.read_string()};
+                    const std::string repl{r.read_string()};
+                    if (pattern.empty()) {
+                        break;
+                    } else if (!literal) {
+                        literal = std::make_shared<LiteralGsubs>(pattern, repl, global);
+                    } else {
+                        literal->fuse(pattern, repl);
+                    }
+                }
+                if (!literal || literal->get_patterns().size() != num_pairs) {
+                    r.fail("The snapshot is broken.");
+                    return;
+                }
+                steps.emplace_back(std::move(literal));
+            } else {
+                const std::string pattern{r.read_string()};
+                const std::string repl{r.read_string()};
+                const bool global{r.read_bool()};
+                if (!r.good()) {
+                    return;
+                }
+                bool is_builtin;
+                std::shared_ptr<const GsubFunc_t> func;
+                try {
+                    func = create_function(pattern, repl, global, config, is_builtin);
+                } catch (const std::runtime_error &e) {
+                    std::string msg{"Gsub error: "};
+                    msg += e.what();
+                    r.fail(msg);
+                    return;
+                }
+                std::string required;
+                if (is_builtin) {
+                    required = get_required_literal(pattern);
+                }
+                steps.emplace_back(std::move(func), std::move(required), pattern, repl, global, is_builtin, get_creator_id(config.gsub_creator));
+            }
+            steps.back().is_dead = r.read_bool();
+        }
+        const std::size_t num_eliminated{r.read_size()};
+        for (std::size_t i = 0; i < num_eliminated && r.good(); ++i) {
+            eliminated.emplace_back(r.read_string());
+        }
     }
 
     void DataGsubs::set_gsub_function_creator(const GsubFuncCreator_t &creator)
@@ -39,15 +39,26 @@
 #define TPHRASE_SRC_DATAGSUBS_H_
 
 #include <cstddef>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "tphrase/common/config.h"
 #include "tphrase/common/gsub_func.h"
+#include "byte_alphabet.h"
 
 namespace tphrase {
+    class LiteralGsubs;
+    class MemoryCounter;
+    class SnapshotReader;
+    class SnapshotWriter;
+
     /** The data structure representing the set of the gsub functions. */
     class DataGsubs {
     public:
+        /** The identity of a gsub function creator, which is the plain function, or nullptr if the creator isn't a plain function. */
+        using CreatorID_t = GsubFunc_t (*)(const std::string &pattern, const std::string &repl, bool global);
+
         /** The default constructor. */
         DataGsubs() = default;
         /** The copy constructor.
@@ -75,13 +86,58 @@ namespace tphrase {
             \return Substituted string.
         */
         std::string gsub(std::string &&s) const;
+        /** Has the instance no gsubs?
+            \return true if the instance has no gsubs.
+        */
+        bool empty() const;
 
         /** Add a gsub function.
             \param [in] pattern The pattern parameter of gsub.
             \param [in] repl The replacement parameter of gsub.
             \param [in] global The global parameter of gsub.
+            \param [in] config The configuration to create the gsub functions. Its gsub_creator must not be empty.
+            \note The literal gsub is fused into the preceding literal gsubs if a built-in gsub creator is used and the result is not changed by fusing.
+            \note The gsub function created with the same parameters is shared via the process-wide cache.
+            \note The gsub function is created at the first call of gsub() if config.lazy_gsub is true.
+            \note The gsub function created by a built-in gsub creator is skipped in gsub() if the source doesn't contain the literal string that the pattern requires.
+        */
+        void add_parameter(const std::string &pattern, const std::string &repl, bool global,
+                           const Config_t &config);
+
+        /** Eliminate the gsubs that can't match.
+            \param [in] input The set of the bytes that the source string of gsub() can contain.
+            \return The set of the bytes that the substituted string can contain.
+            \note A gsub is eliminated if the pattern requires a byte that the string passed to the gsub can't contain.
+            \note The gsub functions created by a gsub creator other than the built-in ones are never eliminated, and they can generate any bytes.
+            \note The result of the previous call is discarded, so the gsubs can be revived if the input is extended.
         */
-        void add_parameter(const std::string &pattern, const std::string &repl, bool global);
+        ByteAlphabet_t eliminate_dead_gsubs(const ByteAlphabet_t &input);
+        /** Get the patterns of the eliminated gsubs.
+            \return The patterns of the gsubs eliminated by eliminate_dead_gsubs().
+        */
+        const std::vector<std::string> &get_eliminated_gsubs() const;
+        /** Add the identities of the creators of the gsub functions.
+            \param [inout] creators The identities are added in the order of the gsubs.
+            \note The literal gsubs are skipped because they don't depend on the creator.
+        */
+        void collect_creators(std::vector<CreatorID_t> &creators) const;
+        /** Count the memory allocated by the instance.
+            \param [inout] counter The bytes allocated by the instance, excluding the instance itself, are added. The shared objects already counted are skipped.
+        */
+        void count_memory(MemoryCounter &counter) const;
+
+        /** Write the instance into a snapshot.
+            \param [inout] w The writer of the snapshot.
+            \note The gsub functions are not written, but their parameters are written.
+        */
+        void save(SnapshotWriter &w) const;
+        /** Read the instance from a snapshot.
+            \param [inout] r The reader of the snapshot.
+            \param [in] config The configuration to create the gsub functions. Its gsub_creator must not be empty.
+            \note The gsub functions are created as well as add_parameter(), but the literal gsubs are restored without fusing again.
+            \note An error is recorded in r if a gsub function can't be created.
+        */
+        void load(SnapshotReader &r, const Config_t &config);
 
         /** Set the function to create the gsub functions.
             \param [in] creator The function to create the gsub functions.
@@ -95,8 +151,56 @@ namespace tphrase {
         static GsubFuncCreator_t get_gsub_function_creator();
 
     private:
-        std::vector<GsubFunc_t> gsubs_f; /**< The set of the gsub functions. */
+        /** Create a gsub function.
+            \param [in] pattern The pattern parameter of gsub.
+            \param [in] repl The replacement parameter of gsub.
+            \param [in] global The global parameter of gsub.
+            \param [in] config The configuration to create the gsub functions. Its gsub_creator must not be empty.
+            \param [out] is_builtin true if the function is created by a built-in gsub creator.
+            \return The gsub function.
+            \note It may throw an exception that the creator throws, unless config.lazy_gsub is true.
+        */
+        static std::shared_ptr<const GsubFunc_t> create_function(const std::string &pattern, const std::string &repl, bool global,
+                                                                 const Config_t &config, bool &is_builtin);
+
+        /** A step of the substitution. */
+        struct Step_t {
+            std::shared_ptr<const GsubFunc_t> func; /**< The gsub function shared by the copies and the cache, or nullptr if the step is the literal gsubs. */
+            std::shared_ptr<const LiteralGsubs> literal; /**< The literal gsubs fused into a single pass, or nullptr. */
+            CreatorID_t creator; /**< The identity of the creator of func. */
+            std::string required; /**< The string that the source must contain for func to match, or an empty string if it's unknown. */
+            std::string pattern; /**< The pattern parameter of func. */
+            std::string repl; /**< The replacement parameter of func. */
+            bool global; /**< The global parameter of func. */
+            bool is_builtin; /**< Is func created by a built-in gsub creator? */
+            bool is_dead; /**< Can't the step match the source? */
+
+            /** The constructor for a gsub function.
+                \param [inout] f The gsub function. (moved)
+                \param [inout] req The string that the source must contain for f to match. (moved)
+                \param [in] pat The pattern parameter of f.
+                \param [in] rep The replacement parameter of f.
+                \param [in] glob The global parameter of f.
+                \param [in] builtin Is f created by a built-in gsub creator?
+                \param [in] id The identity of the creator of f.
+            */
+            Step_t(std::shared_ptr<const GsubFunc_t> &&f, std::string &&req,
+                   const std::string &pat, const std::string &rep, bool glob, bool builtin, CreatorID_t id);
+            /** The constructor for the literal gsubs.
+                \param [inout] l The literal gsubs. (moved)
+            */
+            explicit Step_t(std::shared_ptr<const LiteralGsubs> &&l);
+        };
+
+        std::vector<Step_t> steps; /**< The steps of the substitution. */
+        std::vector<std::string> eliminated; /**< The patterns of the eliminated gsubs. */
     };
+
+    inline
+    bool DataGsubs::empty() const
+    {
+        return steps.empty();
+    }
 }
 
 #endif // TPHRASE_SRC_DATAGSUBS_H_
@@ -41,7 +41,10 @@
 #include "DataOptions.h"
 #include "DataSyntax.h"
 #include "DataText.h"
+#include "heap_size.h"
+#include "ImageWriter.h"
 #include "select_and_generate.h"
+#include "snapshot.h"
 
 namespace tphrase {
 
@@ -50,9 +53,9 @@ namespace tphrase {
     {
     }
 
-    std::string DataOptions::generate(const ExtContext_t &ext_context) const
+    std::string DataOptions::generate(const ExtContext_t &ext_context, const RandomFunc_t &rand) const
     {
-        return select_and_generate(texts, weights, equalized_chance, ext_context);
+        return select_and_generate(texts, weights, equalized_chance, ext_context, rand);
     }
 
     double DataOptions::get_weight() const
@@ -95,12 +98,114 @@ namespace tphrase {
         }
     }
 
+    ByteAlphabet_t DataOptions::get_output_alphabet() const
+    {
+        ByteAlphabet_t alphabet;
+        for (const auto &t : texts) {
+            alphabet |= t.get_output_alphabet();
+        }
+        return alphabet;
+    }
+
+    void DataOptions::reset_binding_epoch()
+    {
+        for (auto &t : texts) {
+            t.reset_binding_epoch();
+        }
+    }
+
+    void DataOptions::collect_expansions(std::vector<Symbol> &names) const
+    {
+        for (const auto &t : texts) {
+            t.collect_expansions(names);
+        }
+    }
+
+    void DataOptions::collect_gsub_creators(std::vector<DataGsubs::CreatorID_t> &creators) const
+    {
+        for (const auto &t : texts) {
+            t.collect_gsub_creators(creators);
+        }
+    }
+
+    void DataOptions::report_eliminated_gsubs(const std::string &nonterminal, std::vector<std::string> &report) const
+    {
+        for (const auto &t : texts) {
+            t.report_eliminated_gsubs(nonterminal, report);
+        }
+    }
+
+    void DataOptions::count_memory(MemoryCounter &counter) const
+    {
+        counter.usage.texts += counter.get_capacity_size(texts);
+        counter.usage.weights += counter.get_capacity_size(weights);
+        for (const auto &t : texts) {
+            t.count_memory(counter);
+        }
+    }
+
+    std::size_t DataOptions::get_arena_size() const
+    {
+        std::size_t size{get_copy_size(texts) + get_copy_size(weights)};
+        for (const auto &t : texts) {
+            size += t.get_arena_size();
+        }
+        return size;
+    }
+
+    void DataOptions::save(SnapshotWriter &w) const
+    {
+        w.write_bool(equalized_chance);
+        w.write_size(texts.size());
+        for (const auto &t : texts) {
+            t.save(w);
+        }
+    }
+
+    void DataOptions::load(SnapshotReader &r, const Config_t &config)
+    {
+        texts.clear();
+        weights.clear();
+        equalized_chance = r.read_bool();
+        const std::size_t num_texts{r.read_size()};
+        for (std::size_t i = 0; i < num_texts && r.good(); ++i) {
+            texts.emplace_back();
+            texts.back().load(r, config);
+            weights.emplace_back(get_weight() + texts.back().get_weight());
+        }
+    }
+
+    std::uint64_t DataOptions::write_image(ImageWriter &w) const
+    {
+        std::vector<std::uint64_t> offsets;
+        for (const auto &t : texts) {
+            offsets.emplace_back(t.write_image(w));
+        }
+        const std::uint64_t offset{w.begin_record()};
+        w.write_u64(equalized_chance ? 1 : 0);
+        w.write_u64(offsets.size());
+        for (const auto o : offsets) {
+            w.write_u64(o);
+        }
+        for (const auto weight : weights) {
+            w.write_double(weight);
+        }
+        return offset;
+    }
+
     void
-    DataOptions::fix_local_nonterminal(DataSyntax &syntax,
-                                       std::vector<std::string> &err_msg)
+    DataOptions::check_local_nonterminal(const DataSyntax &syntax,
+                                         std::vector<std::string> &err_msg) const
+    {
+        for (const auto &t : texts) {
+            t.check_local_nonterminal(syntax, err_msg);
+        }
+    }
+
+    void DataOptions::rename_expansions(const std::unordered_map<Symbol, Symbol, Symbol::Hash> &renamed)
     {
         for (auto &t : texts) {
-            t.fix_local_nonterminal(syntax, err_msg);
+            t.rename_expansions(renamed);
         }
     }
 }
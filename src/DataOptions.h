@@ -39,14 +39,22 @@
 #define TPHRASE_SRC_DATAOPTIONS_H_
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "tphrase/common/ext_context.h"
+#include "tphrase/common/random_func.h"
+#include "Arena.h"
 #include "DataText.h"
 
 namespace tphrase {
     class DataSyntax;
+    class ImageWriter;
+    class MemoryCounter;
+    class SnapshotReader;
+    class SnapshotWriter;
 
     /** The data structure representing the set of the text options.
         \note The instance bound on a syntax doesn't own the syntax, so the users must keep the syntax alive until the instance is unused.
@@ -80,9 +88,10 @@ namespace tphrase {
 
         /** Generate a text.
             \param [in] ext_context The external context that has some nonterminals and the substitutions.
+            \param [in] rand The random function.
             \return A text.
         */
-        std::string generate(const ExtContext_t &ext_context) const;
+        std::string generate(const ExtContext_t &ext_context, const RandomFunc_t &rand) const;
 
         /** Get the sum of the weight of the texts.
             \return The sum of the weight.
@@ -113,16 +122,67 @@ namespace tphrase {
                          int epoch,
                          std::vector<std::string> &err_msg);
 
-        /** Fix the reference to the local nonterminal.
-            \param [inout] syntax The syntax to be fixed.
+        /** Check the references to the local nonterminals in this and the anonymous rules.
+            \param [in] syntax The syntax that has the local nonterminals.
             \param [inout] err_msg The error messages are added if some errors are detected.
             \note An error is caused if the local nonterminal that is referred by a production rule doesn't exists.
         */
-        void fix_local_nonterminal(DataSyntax& syntax, std::vector<std::string> &err_msg);
+        void check_local_nonterminal(const DataSyntax &syntax, std::vector<std::string> &err_msg) const;
+        /** Rename the expansions in this and the anonymous rules.
+            \param [in] renamed The map from the old names to the new names.
+            \note The renamed expansions must be bound again.
+        */
+        void rename_expansions(const std::unordered_map<Symbol, Symbol, Symbol::Hash> &renamed);
+
+        /** Reset the binding epoch of the anonymous rules. */
+        void reset_binding_epoch();
+        /** Add the names of the expansions in the texts.
+            \param [inout] names The names are added.
+        */
+        void collect_expansions(std::vector<Symbol> &names) const;
+        /** Add the identities of the creators of the gsub functions in the texts.
+            \param [inout] creators The identities are added.
+        */
+        void collect_gsub_creators(std::vector<DataGsubs::CreatorID_t> &creators) const;
+
+        /** Get the set of the bytes that the generated text can contain.
+            \return The set of the bytes.
+            \note The return value is meaningful only when the instance is bound on a syntax.
+        */
+        ByteAlphabet_t get_output_alphabet() const;
+        /** Add the patterns of the gsubs eliminated in the anonymous rules.
+            \param [in] nonterminal The nonterminal that contains the instance.
+            \param [inout] report The messages for the eliminated gsubs are added.
+        */
+        void report_eliminated_gsubs(const std::string &nonterminal, std::vector<std::string> &report) const;
+        /** Count the memory allocated by the instance.
+            \param [inout] counter The bytes allocated by the instance, excluding the instance itself, are added. The shared objects already counted are skipped.
+        */
+        void count_memory(MemoryCounter &counter) const;
+        /** Get the size of the arena used by a copy of the instance.
+            \return The number of the bytes, including the padding for the alignment.
+        */
+        std::size_t get_arena_size() const;
+
+        /** Write the instance into a snapshot.
+            \param [inout] w The writer of the snapshot.
+        */
+        void save(SnapshotWriter &w) const;
+        /** Read the instance from a snapshot.
+            \param [inout] r The reader of the snapshot.
+            \param [in] config The configuration to create the gsub functions. Its gsub_creator must not be empty.
+            \note The weights are calculated from the texts as well as add_text().
+        */
+        void load(SnapshotReader &r, const Config_t &config);
+        /** Write the instance into a flat image.
+            \param [inout] w The writer of the image.
+            \return The offset of the record.
+        */
+        std::uint64_t write_image(ImageWriter &w) const;
 
     private:
-        std::vector<DataText> texts; /**< The set of the text options. */
-        std::vector<double> weights; /**< weights[i] is the sum of weights[i-1] and the weight to select texts[i]. */
+        ArenaVector_t<DataText> texts; /**< The set of the text options. */
+        ArenaVector_t<double> weights; /**< weights[i] is the sum of weights[i-1] and the weight to select texts[i]. */
         bool equalized_chance; /**< Is the chance equalized? */
     };
 }
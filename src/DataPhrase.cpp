@@ -36,11 +36,17 @@
 */
 
 #include <algorithm>
+#include <limits>
+#include <sstream>
+#include <unordered_map>
 #include <utility>
 
 #include "DataPhrase.h"
+#include "ImageWriter.h"
+#include "heap_size.h"
 #include "random.h"
 #include "select_and_generate.h"
+#include "snapshot.h"
 
 namespace tphrase {
     DataPhrase::DataPhrase()
@@ -48,9 +54,9 @@ namespace tphrase {
     {
     }
 
-    std::string DataPhrase::generate(const ExtContext_t &ext_context) const
+    std::string DataPhrase::generate(const ExtContext_t &ext_context, const RandomFunc_t &rand) const
     {
-        return select_and_generate(syntaxes, weights, equalized_chance, ext_context);
+        return select_and_generate(syntaxes, weights, equalized_chance, ext_context, rand);
     }
 
     SyntaxID_t DataPhrase::add(const DataSyntax &syntax,
@@ -64,13 +70,13 @@ namespace tphrase {
                                const std::string &start_condition,
                                std::vector<std::string> &err_msg)
     {
-        syntax.bind_syntax(start_condition, err_msg);
+        syntax.bind_syntax(Symbol{start_condition}, err_msg);
         if (!syntax.is_valid()) {
             return 0;
         }
 
-        syntaxes.emplace_back(std::move(syntax));
-        weights.emplace_back(get_weight() + syntaxes.back().get_weight());
+        syntaxes.emplace_back(std::make_shared<DataSyntax>(std::move(syntax)));
+        weights.emplace_back(get_weight() + syntaxes.back()->get_weight());
         if (ids.empty()) {
             ids.emplace_back(1);
         } else {
@@ -96,7 +102,34 @@ namespace tphrase {
             sum = weights[idx - 1];
         }
         for ( ; idx < syntaxes.size(); ++idx) {
-            sum += syntaxes[idx].get_weight();
+            sum += syntaxes[idx]->get_weight();
+            weights[idx] = sum;
+        }
+        return true;
+    }
+
+    bool DataPhrase::update(const SyntaxID_t id, const DataSyntax &syntax, std::vector<std::string> &err_msg)
+    {
+        const auto it{std::lower_bound(ids.cbegin(), ids.cend(), id)};
+        if (it == ids.end() || *it != id) {
+            return false;
+        }
+
+        std::size_t idx = it - ids.begin();
+        if (syntaxes[idx].use_count() > 1) {
+            // The copy is bound on the same start condition.
+            syntaxes[idx] = std::make_shared<DataSyntax>(*syntaxes[idx]);
+        }
+        if (!syntaxes[idx]->update(syntax, err_msg)) {
+            remove(id);
+            return false;
+        }
+        double sum{0.0};
+        if (idx >= 1) {
+            sum = weights[idx - 1];
+        }
+        for ( ; idx < syntaxes.size(); ++idx) {
+            sum += syntaxes[idx]->get_weight();
             weights[idx] = sum;
         }
         return true;
@@ -123,8 +156,228 @@ namespace tphrase {
     {
         std::size_t sum{0};
         for (const auto &s : syntaxes) {
-            sum += s.get_combination_number();
+            sum += s->get_combination_number();
         }
         return sum;
     }
+
+    std::vector<std::string> DataPhrase::get_eliminated_gsub_report() const
+    {
+        std::vector<std::string> report;
+        for (const auto &s : syntaxes) {
+            s->report_eliminated_gsubs(report);
+        }
+        return report;
+    }
+
+    std::size_t DataPhrase::compact()
+    {
+        // The fresh copies are bound in the same binding epoch, so the identical production rules are written into the identical snapshots.
+        MemoryCounter prev_counter;
+        count_memory(prev_counter);
+        std::vector<DataSyntax> copies;
+        copies.reserve(syntaxes.size());
+        for (const auto &s : syntaxes) {
+            copies.emplace_back(*s);
+        }
+
+        // A class is a production rule identified by the nonterminal, the snapshot, the creators of the gsub functions, and the classes of the production rules that it refers to.
+        struct Class_t {
+            std::size_t syntax; // The index of a syntax that has the production rule.
+            Symbol nonterminal; // The nonterminal assigned to the production rule.
+            std::vector<std::pair<Symbol, std::size_t>> refers; // The nonterminals that the production rule refers to, and their classes.
+            std::size_t count; // The number of the syntaxes that have the production rule.
+        };
+        const std::size_t unshareable{std::numeric_limits<std::size_t>::max()};
+        std::unordered_map<std::string, std::size_t> class_ids;
+        std::vector<Class_t> classes;
+        std::vector<std::unordered_map<Symbol, std::size_t, Symbol::Hash>> class_of(copies.size());
+        std::vector<std::vector<Symbol>> external(copies.size()); // The nonterminals that are referred but not assigned in the syntax.
+        std::unordered_map<DataGsubs::CreatorID_t, std::size_t> creator_ids;
+        std::vector<DataGsubs::CreatorID_t> creators;
+        std::vector<Symbol> names;
+        for (std::size_t i = 0; i < copies.size(); ++i) {
+            auto &syntax = copies[i];
+            if (!syntax.is_valid()) {
+                continue;
+            }
+            // The production rules that a production rule refers to are identified before it.
+            for (const auto &nonterminal : syntax.get_reachable_nonterminals()) {
+                const DataProductionRule &rule{syntax.get_production_rule(nonterminal)};
+                std::ostringstream os;
+                SnapshotWriter w{os};
+                w.write_string(nonterminal.str());
+                rule.save(w);
+                names.clear();
+                rule.collect_expansions(names);
+                std::vector<std::pair<Symbol, std::size_t>> refers;
+                bool shareable{nonterminal != syntax.get_start_condition()};
+                // The snapshot doesn't have the creators, and the gsub functions with the same parameters can differ by the creators.
+                creators.clear();
+                rule.collect_gsub_creators(creators);
+                for (const auto creator : creators) {
+                    if (creator == nullptr) {
+                        shareable = false;
+                    } else {
+                        w.write_size(creator_ids.emplace(creator, creator_ids.size()).first->second);
+                    }
+                }
+                for (const auto &name : names) {
+                    const auto found{class_of[i].find(name)};
+                    if (found == class_of[i].end()) {
+                        external[i].emplace_back(name);
+                        shareable = false;
+                    } else {
+                        shareable = shareable && found->second != unshareable;
+                        w.write_size(found->second);
+                        refers.emplace_back(name, found->second);
+                    }
+                }
+                std::size_t id{unshareable};
+                if (shareable) {
+                    const auto inserted = class_ids.emplace(os.str(), classes.size());
+                    id = inserted.first->second;
+                    if (inserted.second) {
+                        classes.push_back(Class_t{i, nonterminal, std::move(refers), 0});
+                    }
+                    ++classes[id].count;
+                }
+                class_of[i].emplace(nonterminal, id);
+            }
+        }
+
+        // The most common class of each nonterminal is shared if the classes that it refers to are also shared.
+        std::unordered_map<Symbol, std::size_t, Symbol::Hash> shared;
+        for (std::size_t id = 0; id < classes.size(); ++id) {
+            if (classes[id].count >= 2) {
+                const auto inserted = shared.emplace(classes[id].nonterminal, id);
+                if (!inserted.second && classes[inserted.first->second].count < classes[id].count) {
+                    inserted.first->second = id;
+                }
+            }
+        }
+        for (bool removed = true; removed; ) {
+            removed = false;
+            for (auto it = shared.begin(); it != shared.end(); ) {
+                const auto &refers = classes[it->second].refers;
+                const bool closed{std::all_of(refers.begin(), refers.end(), [&shared](const std::pair<Symbol, std::size_t> &r) {
+                    const auto found{shared.find(r.first)};
+                    return found != shared.end() && found->second == r.second;
+                })};
+                if (closed) {
+                    ++it;
+                } else {
+                    it = shared.erase(it);
+                    removed = true;
+                }
+            }
+        }
+
+        std::shared_ptr<DataSyntax> library;
+        if (!shared.empty()) {
+            library = std::make_shared<DataSyntax>();
+            std::string msg;
+            for (const auto &it : shared) {
+                library->add(it.first, copies[classes[it.second].syntax].get_production_rule(it.first).copy_in_arena(), msg);
+            }
+            std::vector<std::string> err_msg;
+            library->bind_library(err_msg); // It should not generate any error messages.
+        }
+
+        // The library is searched before the other libraries, so it must not hide the nonterminals that the syntax doesn't have.
+        std::vector<Symbol> replaced;
+        for (std::size_t i = 0; i < copies.size(); ++i) {
+            auto &syntax = copies[i];
+            if (!syntax.is_valid()) {
+                continue;
+            }
+            replaced.clear();
+            const bool hidden{std::any_of(external[i].begin(), external[i].end(), [&shared](const Symbol &name) {
+                return shared.find(name) != shared.end();
+            })};
+            if (!hidden) {
+                for (const auto &it : class_of[i]) {
+                    const auto found{shared.find(it.first)};
+                    if (found != shared.end() && found->second == it.second) {
+                        replaced.emplace_back(it.first);
+                    }
+                }
+            }
+            syntax.share_rules(replaced, replaced.empty() ? nullptr : library);
+            syntaxes[i] = std::make_shared<DataSyntax>(syntax);
+        }
+        MemoryCounter new_counter;
+        count_memory(new_counter);
+        const std::size_t prev_size{prev_counter.get_usage().total()};
+        const std::size_t new_size{new_counter.get_usage().total()};
+        return prev_size > new_size ? prev_size - new_size : 0;
+    }
+
+    void DataPhrase::count_memory(MemoryCounter &counter) const
+    {
+        counter.usage.assignments += syntaxes.capacity() * sizeof(decltype(syntaxes)::value_type)
+            + ids.capacity() * sizeof(SyntaxID_t);
+        counter.usage.weights += weights.capacity() * sizeof(double);
+        for (const auto &s : syntaxes) {
+            if (counter.is_first(s.get())) {
+                counter.usage.assignments += SHARED_OBJECT_OVERHEAD + sizeof(DataSyntax);
+                s->count_memory(counter);
+            }
+        }
+    }
+
+    void DataPhrase::save(SnapshotWriter &w) const
+    {
+        w.write_bool(equalized_chance);
+        w.write_size(syntaxes.size());
+        for (std::size_t i = 0; i < syntaxes.size(); ++i) {
+            w.write_size(ids[i]);
+            syntaxes[i]->save(w);
+        }
+    }
+
+    void DataPhrase::load(SnapshotReader &r, const Config_t &config)
+    {
+        clear();
+        ids.clear();
+        equalized_chance = r.read_bool();
+        const std::size_t num_syntaxes{r.read_size()};
+        for (std::size_t i = 0; i < num_syntaxes && r.good(); ++i) {
+            const SyntaxID_t id{r.read_size()};
+            DataSyntax syntax;
+            syntax.load(r, config);
+            if (!r.good()) {
+                break;
+            } else if (!syntax.is_valid() || id == 0 || (!ids.empty() && id <= ids.back())) {
+                r.fail("The snapshot is broken.");
+                break;
+            }
+            syntaxes.emplace_back(std::make_shared<DataSyntax>(std::move(syntax)));
+            weights.emplace_back(get_weight() + syntaxes.back()->get_weight());
+            ids.emplace_back(id);
+        }
+        if (!r.good()) {
+            clear();
+            ids.clear();
+        }
+    }
+
+    std::uint64_t DataPhrase::write_image(ImageWriter &w) const
+    {
+        std::vector<std::uint64_t> offsets;
+        for (const auto &s : syntaxes) {
+            offsets.emplace_back(s->write_image(w));
+        }
+        const std::uint64_t offset{w.begin_record()};
+        w.write_u64(equalized_chance ? 1 : 0);
+        w.write_u64(offsets.size());
+        w.write_u64(get_combination_number());
+        for (const auto o : offsets) {
+            w.write_u64(o);
+        }
+        for (const auto weight : weights) {
+            w.write_double(weight);
+        }
+        return offset;
+    }
 }
@@ -39,15 +39,25 @@
 #define TPHRASE_SRC_DATAPHRASE_H_
 
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "tphrase/common/ext_context.h"
+#include "tphrase/common/random_func.h"
 #include "tphrase/common/syntax_id.h"
 #include "DataSyntax.h"
 
 namespace tphrase {
-    /** The data structure representing the phrase generator. */
+    class ImageWriter;
+    class MemoryCounter;
+    class SnapshotReader;
+    class SnapshotWriter;
+
+    /** The data structure representing the phrase generator.
+        \note The bound syntaxes are shared by the copies of the instance, and a syntax is copied only when it's modified by the instance shared with others.
+    */
     class DataPhrase {
     public:
         /** The default constructor. */
@@ -78,9 +88,10 @@ namespace tphrase {
 
         /** Generate a phrase.
             \param [in] ext_context The external context that has some nonterminals and the substitutions.
+            \param [in] rand The random function.
             \return A phrase.
         */
-        std::string generate(const ExtContext_t &ext_context) const;
+        std::string generate(const ExtContext_t &ext_context, const RandomFunc_t &rand) const;
 
         /** Add a phrase syntax.
             \param [in] syntax The phrase syntax to be copied and added.
@@ -112,6 +123,15 @@ namespace tphrase {
             \note The ID for the removed phrase syntax may be reused by add().
         */
         bool remove(SyntaxID_t id);
+        /** Replace a phrase syntax with its later revision.
+            \param [in] id The ID for the phrase syntax.
+            \param [in] syntax The later revision of the phrase syntax.
+            \param [inout] err_msg The error messages are added if some errors are detected.
+            \return true if the phrase syntax is replaced.
+            \note See DataSyntax::update() for the incremental binding.
+            \note The phrase syntax is removed if some errors are detected.
+        */
+        bool update(SyntaxID_t id, const DataSyntax &syntax, std::vector<std::string> &err_msg);
 
         /** Clear the syntaxes and the error messages. */
         void clear();
@@ -133,9 +153,39 @@ namespace tphrase {
             \return The the number of the possible phrases generated by the instance.
         */
         std::size_t get_combination_number() const;
+        /** Get the messages for the gsubs eliminated because they can't match.
+            \return The messages.
+        */
+        std::vector<std::string> get_eliminated_gsub_report() const;
+        /** Share the identical production rules among the syntaxes.
+            \return The estimated number of the bytes released.
+            \note See Generator::compact().
+        */
+        std::size_t compact();
+        /** Count the memory held by the instance.
+            \param [inout] counter The bytes held by the instance, excluding the instance itself, are added. The syntaxes already counted are skipped.
+        */
+        void count_memory(MemoryCounter &counter) const;
+
+        /** Write the instance into a snapshot.
+            \param [inout] w The writer of the snapshot.
+        */
+        void save(SnapshotWriter &w) const;
+        /** Read the instance from a snapshot.
+            \param [inout] r The reader of the snapshot.
+            \param [in] config The configuration to create the gsub functions. Its gsub_creator must not be empty.
+            \note The syntaxes are bound again, so the broken bindings and weights in the snapshot are detected or recalculated.
+            \note The instance is cleared and an error is recorded in r if the snapshot is broken.
+        */
+        void load(SnapshotReader &r, const Config_t &config);
+        /** Write the instance into a flat image.
+            \param [inout] w The writer of the image.
+            \return The offset of the record.
+        */
+        std::uint64_t write_image(ImageWriter &w) const;
 
     private:
-        std::vector<DataSyntax> syntaxes; /**< The syntaxes in the instance. */
+        std::vector<std::shared_ptr<DataSyntax>> syntaxes; /**< The syntaxes in the instance, which may be shared by the copies. */
         std::vector<double> weights; /**< weights[i] is the sum of weights[i-1] and the weight to select syntaxes[i]. */
         bool equalized_chance; /**< Is the chance equalized? */
         std::vector<SyntaxID_t> ids; /**< The syntax ID. */
@@ -37,9 +37,14 @@
 
 #include <cmath>
 #include <limits>
+#include <sstream>
 #include <utility>
 
+#include "Arena.h"
 #include "DataProductionRule.h"
+#include "ImageWriter.h"
+#include "heap_size.h"
+#include "snapshot.h"
 
 namespace tphrase {
 
@@ -47,15 +52,19 @@ namespace tphrase {
         : options{a.options},
           gsubs{a.gsubs},
           binding_epoch{0},
-          weight{std::numeric_limits<double>::quiet_NaN()}
+          weight{a.weight},
+          output_alphabet{ByteAlphabet_t{}.set()}
     {
+        // The copy is not bound, so the eliminated gsubs are revived.
+        gsubs.eliminate_dead_gsubs(output_alphabet);
     }
 
     DataProductionRule::DataProductionRule(DataOptions &&in_options, DataGsubs &&in_gsubs)
         : options{std::move(in_options)},
           gsubs{std::move(in_gsubs)},
           binding_epoch{0},
-          weight{std::numeric_limits<double>::quiet_NaN()}
+          weight{std::numeric_limits<double>::quiet_NaN()},
+          output_alphabet{ByteAlphabet_t{}.set()}
     {
     }
 
@@ -65,12 +74,20 @@ namespace tphrase {
         gsubs = a.gsubs;
         binding_epoch = 0;
         weight = a.weight;
+        output_alphabet.set();
+        gsubs.eliminate_dead_gsubs(output_alphabet);
         return *this;
     }
 
-    std::string DataProductionRule::generate(const ExtContext_t &ext_context) const
+    DataProductionRule DataProductionRule::copy_in_arena() const
     {
-        return gsubs.gsub(options.generate(ext_context));
+        const ArenaScope scope{get_arena_size()};
+        return DataProductionRule{*this};
+    }
+
+    std::string DataProductionRule::generate(const ExtContext_t &ext_context, const RandomFunc_t &rand) const
+    {
+        return gsubs.gsub(options.generate(ext_context, rand));
     }
 
     double DataProductionRule::get_weight() const
@@ -102,6 +119,7 @@ namespace tphrase {
 
         binding_epoch = -1;
         options.bind_syntax(syntax, epoch, err_msg);
+        output_alphabet = gsubs.eliminate_dead_gsubs(options.get_output_alphabet());
         binding_epoch = epoch;
         return true;
     }
@@ -109,5 +127,86 @@ namespace tphrase {
     void DataProductionRule::reset_binding_epoch()
     {
         binding_epoch = 0;
+        // The rule is not bound, so the eliminated gsubs are revived as well as the copy.
+        output_alphabet.set();
+        gsubs.eliminate_dead_gsubs(output_alphabet);
+        options.reset_binding_epoch();
+    }
+
+    void DataProductionRule::collect_expansions(std::vector<Symbol> &names) const
+    {
+        options.collect_expansions(names);
+    }
+
+    void DataProductionRule::collect_gsub_creators(std::vector<DataGsubs::CreatorID_t> &creators) const
+    {
+        gsubs.collect_creators(creators);
+        options.collect_gsub_creators(creators);
+    }
+
+    void DataProductionRule::report_eliminated_gsubs(const std::string &nonterminal, std::vector<std::string> &report) const
+    {
+        for (const auto &pattern : gsubs.get_eliminated_gsubs()) {
+            std::string msg{"The gsub with the pattern \""};
+            msg += pattern;
+            msg += "\" in \"";
+            msg += nonterminal;
+            msg += "\" is eliminated because it can't match.";
+            report.emplace_back(std::move(msg));
+        }
+        options.report_eliminated_gsubs(nonterminal, report);
+    }
+
+    void DataProductionRule::count_memory(MemoryCounter &counter) const
+    {
+        options.count_memory(counter);
+        gsubs.count_memory(counter);
+    }
+
+    std::size_t DataProductionRule::get_arena_size() const
+    {
+        return options.get_arena_size();
+    }
+
+    void DataProductionRule::save(SnapshotWriter &w) const
+    {
+        w.write_double(weight);
+        options.save(w);
+        gsubs.save(w);
+    }
+
+    void DataProductionRule::load(SnapshotReader &r, const Config_t &config)
+    {
+        binding_epoch = 0;
+        weight = r.read_double();
+        if (weight < 0.0) {
+            r.fail("The snapshot is broken.");
+        }
+        options.load(r, config);
+        gsubs.load(r, config);
+        // The instance is not bound, so the eliminated gsubs are revived as well as the copy.
+        output_alphabet.set();
+        gsubs.eliminate_dead_gsubs(output_alphabet);
+    }
+
+    std::uint64_t DataProductionRule::write_image(ImageWriter &w) const
+    {
+        std::uint64_t offset;
+        if (w.find_rule(this, offset)) {
+            return offset;
+        }
+        const std::uint64_t options_offset{options.write_image(w)};
+        std::uint64_t gsubs_index{image::none};
+        if (!gsubs.empty()) {
+            std::ostringstream os;
+            SnapshotWriter sw{os};
+            gsubs.save(sw);
+            gsubs_index = w.add_gsubs(os.str());
+        }
+        offset = w.begin_record();
+        w.write_u64(options_offset);
+        w.write_u64(gsubs_index);
+        w.add_rule(this, offset);
+        return offset;
     }
 }
@@ -39,15 +39,19 @@
 #define TPHRASE_SRC_DATAPRODUCTIONRULE_H_
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "tphrase/common/ext_context.h"
+#include "tphrase/common/random_func.h"
 #include "DataOptions.h"
 #include "DataGsubs.h"
 
 namespace tphrase {
     class DataSyntax;
+    class MemoryCounter;
 
     /** The data structure representing the production rule.
         \note The instance bound on a syntax doesn't own the syntax, so the users must keep the syntax alive until the instance is unused.
@@ -83,11 +87,18 @@ namespace tphrase {
         */
         DataProductionRule &operator=(DataProductionRule &&a) = default;
 
+        /** Copy the instance into a new arena.
+            \return The copy, which is unbound.
+            \note The arena fits the copy, and it's released when the copy is destroyed.
+        */
+        DataProductionRule copy_in_arena() const;
+
         /** Generate a text.
             \param [in] ext_context The external context that has some nonterminals and the substitutions.
+            \param [in] rand The random function.
             \return A text.
         */
-        std::string generate(const ExtContext_t &ext_context) const;
+        std::string generate(const ExtContext_t &ext_context, const RandomFunc_t &rand) const;
 
         /** Get the sum of the weight of the texts.
             \return The sum of the weight.
@@ -116,29 +127,89 @@ namespace tphrase {
             \return false if the function call is recursive.
             \note No err_msg is added if false is returned.
             \note An error message is added to err_msg if a text in this instance detects a recursive expansion.
+            \note The gsubs that can't match the generated text are eliminated.
         */
         bool bind_syntax(DataSyntax &syntax,
                          int epoch,
                          std::vector<std::string> &err_msg);
 
-        /** Fix the reference to the local nonterminal.
-            \param [inout] syntax The syntax to be fixed.
+        /** Check the references to the local nonterminals in this and the anonymous rules.
+            \param [in] syntax The syntax that has the local nonterminals.
             \param [inout] err_msg The error messages are added if some errors are detected.
             \note An error is caused if the local nonterminal that is referred by a production rule doesn't exists.
         */
-        void fix_local_nonterminal(DataSyntax &syntax,
-                                   std::vector<std::string> &err_msg);
+        void check_local_nonterminal(const DataSyntax &syntax,
+                                     std::vector<std::string> &err_msg) const;
+        /** Rename the expansions in this and the anonymous rules.
+            \param [in] renamed The map from the old names to the new names.
+            \note The renamed expansions must be bound again.
+        */
+        void rename_expansions(const std::unordered_map<Symbol, Symbol, Symbol::Hash> &renamed);
 
-        /** Reset the binding epoch. */
+        /** Reset the binding epoch.
+            \note The binding epoch of the anonymous rules is also reset, so the next bind_syntax() binds them again. The eliminated gsubs are revived until the next bind_syntax().
+        */
         void reset_binding_epoch();
+        /** Add the names of the expansions in this and the anonymous rules.
+            \param [inout] names The names are added.
+        */
+        void collect_expansions(std::vector<Symbol> &names) const;
+        /** Add the identities of the creators of the gsub functions in this and the anonymous rules.
+            \param [inout] creators The identities are added.
+        */
+        void collect_gsub_creators(std::vector<DataGsubs::CreatorID_t> &creators) const;
+
+        /** Get the set of the bytes that the generated text can contain.
+            \return The set of the bytes.
+            \note The return value is meaningful only when the instance is bound on a syntax. The unbound instance can generate any bytes.
+        */
+        const ByteAlphabet_t &get_output_alphabet() const;
+        /** Add the patterns of the eliminated gsubs in this and the anonymous rules.
+            \param [in] nonterminal The nonterminal that contains the instance.
+            \param [inout] report The messages for the eliminated gsubs are added.
+        */
+        void report_eliminated_gsubs(const std::string &nonterminal, std::vector<std::string> &report) const;
+        /** Count the memory allocated by the instance.
+            \param [inout] counter The bytes allocated by the instance, excluding the instance itself, are added. The shared objects already counted are skipped.
+        */
+        void count_memory(MemoryCounter &counter) const;
+        /** Get the size of the arena used by a copy of the instance.
+            \return The number of the bytes, including the padding for the alignment. The anonymous rules are included.
+        */
+        std::size_t get_arena_size() const;
+
+        /** Write the instance into a snapshot.
+            \param [inout] w The writer of the snapshot.
+        */
+        void save(SnapshotWriter &w) const;
+        /** Read the instance from a snapshot.
+            \param [inout] r The reader of the snapshot.
+            \param [in] config The configuration to create the gsub functions. Its gsub_creator must not be empty.
+            \note The instance is not bound.
+        */
+        void load(SnapshotReader &r, const Config_t &config);
+        /** Write the instance into a flat image.
+            \param [inout] w The writer of the image.
+            \return The offset of the record.
+            \note The record is written only once, and shared by all the expansions of the instance.
+            \note The eliminated gsubs are written as well as save(), and they are skipped at the generation.
+        */
+        std::uint64_t write_image(ImageWriter &w) const;
 
     private:
         DataOptions options; /**< The options in the production rule. */
         DataGsubs gsubs; /**< The gsubs in the production rule. */
         int binding_epoch; /**< The binding epoch. */
         double weight; /**< The weight specified by the phrase syntax. */
+        ByteAlphabet_t output_alphabet; /**< The set of the bytes that the generated text can contain. */
     };
 
+    inline
+    const ByteAlphabet_t &DataProductionRule::get_output_alphabet() const
+    {
+        return output_alphabet;
+    }
+
     inline
     std::size_t DataProductionRule::get_combination_number() const
     {
@@ -153,10 +224,16 @@ namespace tphrase {
 
     inline
     void
-    DataProductionRule::fix_local_nonterminal(DataSyntax &syntax,
-                                              std::vector<std::string> &err_msg)
+    DataProductionRule::check_local_nonterminal(const DataSyntax &syntax,
+                                                std::vector<std::string> &err_msg) const
+    {
+        options.check_local_nonterminal(syntax, err_msg);
+    }
+
+    inline
+    void DataProductionRule::rename_expansions(const std::unordered_map<Symbol, Symbol, Symbol::Hash> &renamed)
     {
-        return options.fix_local_nonterminal(syntax, err_msg);
+        options.rename_expansions(renamed);
     }
 }
 
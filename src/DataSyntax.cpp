@@ -35,25 +35,52 @@
     \endparblock
 */
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
 #include <stdexcept>
+#include <unordered_set>
 #include <utility>
 
 #include "DataSyntax.h"
+#include "heap_size.h"
+#include "snapshot.h"
+
+namespace {
+    /** The last revision number issued by new_revision(). */
+    std::atomic<std::size_t> last_revision{0};
+
+    /** Issue a new revision number.
+        \return The revision number unique in the process.
+    */
+    std::size_t new_revision()
+    {
+        return ++last_revision;
+    }
+}
 
 namespace tphrase {
     DataSyntax::DataSyntax()
         : assignments{},
           start_it{assignments.end()},
-          binding_epoch{0}
+          binding_epoch{0},
+          revision{0},
+          prev_revision{0},
+          changed{},
+          libraries{}
     {
     }
 
     DataSyntax::DataSyntax(const DataSyntax &a)
-        : assignments{a.assignments},
+        : assignments{},
           start_it{assignments.end()},
-          binding_epoch{0}
+          binding_epoch{0},
+          revision{a.revision},
+          prev_revision{a.prev_revision},
+          changed{a.changed},
+          libraries{a.libraries}
     {
+        copy_assignments(a);
         if (a.start_it != a.assignments.end()) {
             std::vector<std::string> err_msg;
             bind_syntax(a.start_it->first, err_msg); // It should not generate any error messages.
@@ -63,7 +90,11 @@ namespace tphrase {
     DataSyntax::DataSyntax(DataSyntax &&a)
         : assignments{},
           start_it{a.start_it},
-          binding_epoch{a.binding_epoch}
+          binding_epoch{a.binding_epoch},
+          revision{a.revision},
+          prev_revision{a.prev_revision},
+          changed{std::move(a.changed)},
+          libraries{std::move(a.libraries)}
     {
         // swap() doesn't invalidate any iterators except end().
         const bool is_end{a.start_it == a.assignments.end()};
@@ -75,9 +106,12 @@ namespace tphrase {
 
     DataSyntax &DataSyntax::operator=(const DataSyntax &a)
     {
-        assignments = a.assignments;
-        start_it = assignments.end();
+        copy_assignments(a);
         binding_epoch = 0;
+        revision = a.revision;
+        prev_revision = a.prev_revision;
+        changed = a.changed;
+        libraries = a.libraries;
         if (a.start_it != a.assignments.end()) {
             std::vector<std::string> err_msg;
             bind_syntax(a.start_it->first, err_msg); // It should not generate any error messages.
@@ -96,13 +130,17 @@ namespace tphrase {
             start_it = a.start_it;
         }
         binding_epoch = a.binding_epoch;
+        revision = a.revision;
+        prev_revision = a.prev_revision;
+        changed = std::move(a.changed);
+        libraries = std::move(a.libraries);
         return *this;
     }
 
-    std::string DataSyntax::generate(const ExtContext_t &ext_context) const
+    std::string DataSyntax::generate(const ExtContext_t &ext_context, const RandomFunc_t &rand) const
     {
         if (is_valid()) {
-            return start_it->second.generate(ext_context);
+            return start_it->second.generate(ext_context, rand);
         } else {
             return "nil";
         }
@@ -126,18 +164,58 @@ namespace tphrase {
         }
     }
 
-    bool DataSyntax::has_nonterminal(const std::string &nonterminal) const
+    void DataSyntax::report_eliminated_gsubs(std::vector<std::string> &report) const
+    {
+        std::vector<const decltype(assignments)::value_type *> sorted;
+        sorted.reserve(assignments.size());
+        for (const auto &a : assignments) {
+            sorted.emplace_back(&a);
+        }
+        std::sort(sorted.begin(), sorted.end(), [](const decltype(sorted)::value_type a, const decltype(sorted)::value_type b) {
+            return a->first.str() < b->first.str();
+        });
+        for (const auto a : sorted) {
+            a->second.report_eliminated_gsubs(get_source_name(a->first), report);
+        }
+    }
+
+    void DataSyntax::count_memory(MemoryCounter &counter) const
+    {
+        // A node of the hash table has the pointer to the next node as well as the assignment.
+        counter.usage.assignments += assignments.bucket_count() * sizeof(void *)
+            + assignments.size() * (sizeof(void *) + sizeof(Symbol))
+            + changed.capacity() * sizeof(Symbol)
+            + libraries.capacity() * sizeof(decltype(libraries)::value_type);
+        counter.usage.rules += assignments.size() * sizeof(DataProductionRule);
+        for (const auto &it : assignments) {
+            it.second.count_memory(counter);
+        }
+        for (const auto &library : libraries) {
+            if (counter.is_first(library.get())) {
+                counter.usage.assignments += SHARED_OBJECT_OVERHEAD + sizeof(DataSyntax);
+                library->count_memory(counter);
+            }
+        }
+    }
+
+    bool DataSyntax::has_nonterminal(const Symbol &nonterminal) const
     {
         return assignments.find(nonterminal) != assignments.end();
     }
 
-    bool DataSyntax::is_local_nonterminal(const std::string &nonterminal) const
+    bool DataSyntax::is_local_nonterminal(const Symbol &nonterminal) const
+    {
+        return nonterminal.str()[0] == '_';
+    }
+
+    std::string DataSyntax::get_source_name(const Symbol &nonterminal)
     {
-        return nonterminal[0] == '_';
+        const std::string &name{nonterminal.str()};
+        return name.substr(0, name.find('@'));
     }
 
     DataProductionRule &
-    DataSyntax::get_production_rule(const std::string &nonterminal)
+    DataSyntax::get_production_rule(const Symbol &nonterminal)
     {
         auto it{assignments.find(nonterminal)};
         if (it == assignments.end()) {
@@ -146,18 +224,44 @@ namespace tphrase {
         return it->second;
     }
 
-    bool DataSyntax::add(std::string &&nonterminal,
+    const DataProductionRule *DataSyntax::find_linked_rule(const Symbol &nonterminal) const
+    {
+        for (const auto &library : libraries) {
+            const auto it{library->assignments.find(nonterminal)};
+            if (it != library->assignments.end()) {
+                return &it->second;
+            }
+            const auto rule{library->find_linked_rule(nonterminal)};
+            if (rule) {
+                return rule;
+            }
+        }
+        return nullptr;
+    }
+
+    void DataSyntax::link(const std::shared_ptr<const DataSyntax> &library)
+    {
+        start_it = assignments.end();
+        if (std::find(libraries.begin(), libraries.end(), library) == libraries.end()) {
+            libraries.emplace_back(library);
+        }
+    }
+
+    bool DataSyntax::add(const Symbol &nonterminal,
                          DataProductionRule &&rule,
                          std::string &err_msg)
     {
         start_it = assignments.end();
+        revision = 0;
+        prev_revision = 0;
+        changed.clear();
         auto it{assignments.find(nonterminal)};
         if (it == assignments.end()) {
-            assignments.emplace(std::move(nonterminal), std::move(rule));
+            assignments.emplace(nonterminal, std::move(rule));
             return true;
         } else {
             err_msg += "The nonterminal \"";
-            err_msg += nonterminal;
+            err_msg += nonterminal.str();
             err_msg += "\" is already defined.";
             return false;
         }
@@ -166,6 +270,38 @@ namespace tphrase {
     void DataSyntax::add(DataSyntax &&syntax, std::vector<std::string> &err_msg)
     {
         start_it = assignments.end();
+        revision = 0;
+        prev_revision = 0;
+        changed.clear();
+
+        // The local nonterminals in syntax are renamed with a character that the source text can't contain.
+        std::unordered_map<Symbol, Symbol, Symbol::Hash> renamed;
+        std::unordered_set<Symbol, Symbol::Hash> new_names;
+        for (const auto &it : syntax.assignments) {
+            if (is_local_nonterminal(it.first) && has_nonterminal(it.first)) {
+                const std::string base{get_source_name(it.first)};
+                for (std::size_t i = 1; ; ++i) {
+                    const Symbol name{base + "@" + std::to_string(i)};
+                    if (!has_nonterminal(name) && !syntax.has_nonterminal(name) && new_names.insert(name).second) {
+                        renamed.emplace(it.first, name);
+                        break;
+                    }
+                }
+            }
+        }
+        if (!renamed.empty()) {
+            for (auto &it : syntax.assignments) {
+                it.second.rename_expansions(renamed);
+                it.second.reset_binding_epoch();
+            }
+            for (const auto &it : renamed) {
+                auto found{syntax.assignments.find(it.first)};
+                DataProductionRule rule{std::move(found->second)};
+                syntax.assignments.erase(found);
+                syntax.assignments.emplace(it.second, std::move(rule));
+            }
+        }
+
         for (auto &it : syntax.assignments) {
             auto found{assignments.find(it.first)};
             if (found == assignments.end()) {
@@ -174,23 +310,165 @@ namespace tphrase {
                 found->second = std::move(it.second);
 
                 std::string msg{"The nonterminal \""};
-                msg += it.first;
+                msg += it.first.str();
                 msg += "\" is already defined.";
                 err_msg.emplace_back(std::move(msg));
             }
         }
+        for (const auto &library : syntax.libraries) {
+            link(library);
+        }
+    }
+
+    void DataSyntax::copy_local_nonterminals(const DataSyntax &locals)
+    {
+        std::vector<Symbol> names;
+        for (const auto &it : assignments) {
+            it.second.collect_expansions(names);
+        }
+        while (!names.empty()) {
+            const Symbol name{std::move(names.back())};
+            names.pop_back();
+            if (is_local_nonterminal(name) && !has_nonterminal(name)) {
+                const auto found{locals.assignments.find(name)};
+                if (found != locals.assignments.end()) {
+                    found->second.collect_expansions(names);
+                    assignments.emplace(name, found->second.copy_in_arena());
+                }
+            }
+        }
     }
 
-    bool DataSyntax::bind_syntax(const std::string &start_condition, std::vector<std::string> &err_msg)
+    void DataSyntax::replace(const std::vector<Symbol> &removed, DataSyntax &&added)
     {
-        auto it{assignments.find(start_condition)};
+        start_it = assignments.end();
+        changed.clear();
+        for (const auto &nonterminal : removed) {
+            assignments.erase(nonterminal);
+            changed.emplace_back(nonterminal);
+        }
+        for (auto &it : added.assignments) {
+            changed.emplace_back(it.first);
+            assignments.emplace(it.first, std::move(it.second));
+        }
+        prev_revision = revision;
+        revision = new_revision();
+    }
+
+    void DataSyntax::renew_revision()
+    {
+        revision = new_revision();
+        prev_revision = 0;
+        changed.clear();
+    }
+
+    bool DataSyntax::update(const DataSyntax &a, std::vector<std::string> &err_msg)
+    {
+        const Symbol start_condition{start_it->first};
+        if (revision == 0 || a.prev_revision != revision || binding_epoch <= 0 || libraries != a.libraries) {
+            *this = a;
+            return bind_syntax(start_condition, err_msg);
+        }
+
+        for (const auto &nonterminal : a.changed) {
+            const auto src{a.assignments.find(nonterminal)};
+            auto dst{assignments.find(nonterminal)};
+            if (src == a.assignments.end()) {
+                if (dst != assignments.end()) {
+                    assignments.erase(dst);
+                }
+            } else if (dst == assignments.end()) {
+                assignments.emplace(nonterminal, src->second.copy_in_arena());
+            } else {
+                // The copy takes its own arena, and the arena of the replaced production rule is released.
+                dst->second = src->second.copy_in_arena();
+            }
+        }
+        revision = a.revision;
+        prev_revision = a.prev_revision;
+        changed = a.changed;
+
+        // Reset the binding epoch of the production rules that refer to the changed nonterminals directly or indirectly.
+        std::unordered_map<Symbol, std::vector<decltype(assignments)::value_type *>, Symbol::Hash> referrers;
+        std::vector<Symbol> names;
+        for (auto &it : assignments) {
+            names.clear();
+            it.second.collect_expansions(names);
+            for (const auto &name : names) {
+                referrers[name].emplace_back(&it);
+            }
+        }
+        std::unordered_set<const decltype(assignments)::value_type *> visited;
+        std::vector<Symbol> queue{changed};
+        while (!queue.empty()) {
+            const Symbol nonterminal{queue.back()};
+            queue.pop_back();
+            const auto self{assignments.find(nonterminal)};
+            if (self != assignments.end() && visited.insert(&*self).second) {
+                self->second.reset_binding_epoch();
+            }
+            const auto found{referrers.find(nonterminal)};
+            if (found != referrers.end()) {
+                for (const auto r : found->second) {
+                    if (visited.insert(r).second) {
+                        r->second.reset_binding_epoch();
+                        queue.emplace_back(r->first);
+                    }
+                }
+            }
+        }
+
+        start_it = assignments.find(start_condition);
+        if (start_it == assignments.end()) {
+            std::string msg{"The nonterminal \""};
+            msg += start_condition.str();
+            msg += "\" doesn't exist.";
+            err_msg.emplace_back(std::move(msg));
+            return false;
+        }
+        const std::size_t prev_len{err_msg.size()};
+        start_it->second.bind_syntax(*this, binding_epoch, err_msg);
+        const bool is_bound{err_msg.size() == prev_len};
+        if (!is_bound) {
+            start_it = assignments.end();
+            return false;
+        }
+
+        // The production rules unreachable from the start condition are left unbound as well as the whole binding.
+        visited.clear();
+        std::vector<const decltype(assignments)::value_type *> stack{&*start_it};
+        visited.insert(&*start_it);
+        while (!stack.empty()) {
+            const auto a{stack.back()};
+            stack.pop_back();
+            names.clear();
+            a->second.collect_expansions(names);
+            for (const auto &name : names) {
+                const auto found{assignments.find(name)};
+                if (found != assignments.end() && visited.insert(&*found).second) {
+                    stack.emplace_back(&*found);
+                }
+            }
+        }
+        for (auto &it : assignments) {
+            if (visited.find(&it) == visited.end()) {
+                it.second.reset_binding_epoch();
+            }
+        }
+        return true;
+    }
+
+    bool DataSyntax::bind_syntax(const Symbol &start_condition, std::vector<std::string> &err_msg)
+    {
+        // The local nonterminals are hidden from the outside of the syntax.
+        auto it{is_local_nonterminal(start_condition) ? assignments.end() : assignments.find(start_condition)};
         if (it != assignments.end()) {
             start_it = it;
         } else {
             start_it = assignments.end();
 
             std::string msg{"The nonterminal \""};
-            msg += start_condition;
+            msg += start_condition.str();
             msg += "\" doesn't exist.";
             err_msg.emplace_back(std::move(msg));
             return false;
@@ -213,18 +491,170 @@ namespace tphrase {
         return is_bound;
     }
 
-    void DataSyntax::fix_local_nonterminal(std::vector<std::string> &err_msg)
+    bool DataSyntax::bind_library(std::vector<std::string> &err_msg)
     {
+        start_it = assignments.end();
+        ++binding_epoch;
+        if (binding_epoch == std::numeric_limits<int>::max()) {
+            for (auto &it : assignments) {
+                it.second.reset_binding_epoch();
+            }
+            binding_epoch = 1;
+        }
+        const std::size_t prev_len{err_msg.size()};
         for (auto &it : assignments) {
-            it.second.fix_local_nonterminal(*this, err_msg);
+            it.second.bind_syntax(*this, binding_epoch, err_msg);
+        }
+        return err_msg.size() == prev_len;
+    }
+
+    std::vector<Symbol> DataSyntax::get_reachable_nonterminals() const
+    {
+        // Depth-first search from the start condition, where a nonterminal is added after all the nonterminals that it refers to.
+        std::vector<Symbol> order;
+        std::unordered_set<Symbol, Symbol::Hash> visited{start_it->first};
+        std::vector<std::pair<decltype(assignments)::const_iterator, std::vector<Symbol>>> stack;
+        stack.emplace_back(decltype(assignments)::const_iterator{start_it}, std::vector<Symbol>{});
+        start_it->second.collect_expansions(stack.back().second);
+        while (!stack.empty()) {
+            auto &names = stack.back().second;
+            if (names.empty()) {
+                order.emplace_back(stack.back().first->first);
+                stack.pop_back();
+                continue;
+            }
+            const Symbol name{std::move(names.back())};
+            names.pop_back();
+            const auto found{assignments.find(name)};
+            if (found != assignments.end() && visited.insert(name).second) {
+                stack.emplace_back(found, std::vector<Symbol>{});
+                found->second.collect_expansions(stack.back().second);
+            }
+        }
+        return order;
+    }
+
+    void DataSyntax::share_rules(const std::vector<Symbol> &shared, const std::shared_ptr<const DataSyntax> &library)
+    {
+        const Symbol start_condition{start_it->first};
+        const auto reachable = get_reachable_nonterminals();
+        std::unordered_set<Symbol, Symbol::Hash> kept{reachable.begin(), reachable.end()};
+        for (const auto &nonterminal : shared) {
+            kept.erase(nonterminal);
         }
         for (auto it = assignments.begin(); it != assignments.end(); ) {
-            if (is_local_nonterminal(it->first)) {
+            if (kept.find(it->first) == kept.end()) {
                 it = assignments.erase(it);
             } else {
                 ++it;
             }
         }
+        if (library) {
+            libraries.insert(libraries.begin(), library);
+        }
+        revision = 0;
+        prev_revision = 0;
+        changed.clear();
+        std::vector<std::string> err_msg;
+        bind_syntax(start_condition, err_msg); // It should not generate any error messages.
+    }
+
+    void DataSyntax::fix_local_nonterminal(std::vector<std::string> &err_msg)
+    {
+        for (const auto &it : assignments) {
+            it.second.check_local_nonterminal(*this, err_msg);
+        }
+
+        // The local nonterminals are reachable only from the other nonterminals in this.
+        std::unordered_set<Symbol, Symbol::Hash> referred;
+        std::vector<Symbol> names;
+        for (const auto &it : assignments) {
+            if (!is_local_nonterminal(it.first)) {
+                it.second.collect_expansions(names);
+            }
+        }
+        while (!names.empty()) {
+            const Symbol name{std::move(names.back())};
+            names.pop_back();
+            if (is_local_nonterminal(name) && referred.insert(name).second) {
+                const auto found{assignments.find(name)};
+                if (found != assignments.end()) {
+                    found->second.collect_expansions(names);
+                }
+            }
+        }
+        for (auto it = assignments.begin(); it != assignments.end(); ) {
+            if (is_local_nonterminal(it->first) && referred.find(it->first) == referred.end()) {
+                it = assignments.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void DataSyntax::save(SnapshotWriter &w) const
+    {
+        w.write_bool(is_valid());
+        w.write_string(is_valid() ? start_it->first.str() : std::string{});
+        w.write_size(libraries.size());
+        for (const auto &library : libraries) {
+            library->save(w);
+        }
+        w.write_size(assignments.size());
+        for (const auto &it : assignments) {
+            w.write_string(it.first.str());
+            it.second.save(w);
+        }
+    }
+
+    void DataSyntax::load(SnapshotReader &r, const Config_t &config)
+    {
+        clear();
+        const bool has_start{r.read_bool()};
+        const Symbol start_condition{r.read_string()};
+        std::vector<std::string> err_msg;
+        // The libraries are bound before this, so that the expansions in this can be bound on them.
+        const std::size_t num_libraries{r.read_size()};
+        for (std::size_t i = 0; i < num_libraries && r.good(); ++i) {
+            const auto library = std::make_shared<DataSyntax>();
+            library->load(r, config);
+            if (r.good() && !library->bind_library(err_msg)) {
+                r.fail("The snapshot is broken.");
+            }
+            libraries.emplace_back(library);
+        }
+        const std::size_t num_assignments{r.read_size()};
+        for (std::size_t i = 0; i < num_assignments && r.good(); ++i) {
+            const Symbol nonterminal{r.read_string()};
+            DataProductionRule rule{DataOptions{}, DataGsubs{}};
+            rule.load(r, config);
+            if (!assignments.emplace(std::move(nonterminal), rule.copy_in_arena()).second) {
+                r.fail("The snapshot is broken.");
+            }
+        }
+
+        // The bindings in the snapshot aren't trusted, so the recursion is checked and the weights are calculated again.
+        if (r.good() && has_start && !bind_syntax(start_condition, err_msg)) {
+            r.fail("The snapshot is broken.");
+        }
+        if (!r.good()) {
+            clear();
+        }
+    }
+
+    std::uint64_t DataSyntax::write_image(ImageWriter &w) const
+    {
+        return start_it->second.write_image(w);
+    }
+
+    void DataSyntax::copy_assignments(const DataSyntax &a)
+    {
+        start_it = assignments.end();
+        assignments.clear();
+        assignments.reserve(a.assignments.size());
+        for (const auto &it : a.assignments) {
+            assignments.emplace(it.first, it.second.copy_in_arena());
+        }
     }
 
     void DataSyntax::clear()
@@ -232,5 +662,9 @@ namespace tphrase {
         assignments.clear();
         start_it = assignments.end();
         binding_epoch = 0;
+        revision = 0;
+        prev_revision = 0;
+        changed.clear();
+        libraries.clear();
     }
 }
@@ -39,14 +39,24 @@
 #define TPHRASE_SRC_DATASYNTAX_H_
 
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <unordered_map>
 #include <string>
 #include <vector>
 
+#include "tphrase/common/config.h"
 #include "tphrase/common/ext_context.h"
+#include "tphrase/common/random_func.h"
 #include "DataProductionRule.h"
+#include "Symbol.h"
 
 namespace tphrase {
+    class ImageWriter;
+    class MemoryCounter;
+    class SnapshotReader;
+    class SnapshotWriter;
+
     /** The data structure representing the phrase syntax. */
     class DataSyntax {
     public:
@@ -76,9 +86,10 @@ namespace tphrase {
 
         /** Generate a phrase.
             \param [in] ext_context The external context that has some nonterminals and the substitutions.
+            \param [in] rand The random function.
             \return A phrase.
         */
-        std::string generate(const ExtContext_t &ext_context) const;
+        std::string generate(const ExtContext_t &ext_context, const RandomFunc_t &rand) const;
 
         /** Get the sum of the weight of the texts.
             \return The sum of the weight.
@@ -95,26 +106,58 @@ namespace tphrase {
             \param [in] nonterminal The target nonterminal.
             \return The instance has the nonterminal.
         */
-        bool has_nonterminal(const std::string &nonterminal) const;
+        bool has_nonterminal(const Symbol &nonterminal) const;
         /** Is is a local instance?
             \param [in] nonterminal The target nonterminal.
             \return It's a local nonterminal.
         */
-        bool is_local_nonterminal(const std::string &nonterminal) const;
+        bool is_local_nonterminal(const Symbol &nonterminal) const;
+        /** Get the name of a nonterminal in the source text.
+            \param [in] nonterminal The target nonterminal.
+            \return The name without the suffix that add() appends to a local nonterminal to avoid the conflict.
+        */
+        static std::string get_source_name(const Symbol &nonterminal);
         /** Get the production rule assigned to the nonterminal.
             \param [in] nonterminal The target nonterminal.
             \return The production rule.
         */
-        DataProductionRule &get_production_rule(const std::string &nonterminal);
+        DataProductionRule &get_production_rule(const Symbol &nonterminal);
+        /** Find the production rule assigned to the nonterminal in the linked libraries.
+            \param [in] nonterminal The target nonterminal.
+            \return The production rule, or nullptr if no linked libraries have the nonterminal.
+            \note The libraries are searched in the order of linking, and the libraries linked with a library are searched after it.
+        */
+        const DataProductionRule *find_linked_rule(const Symbol &nonterminal) const;
+
+        /** Link a library.
+            \param [in] library The library bound by bind_library(). (shared)
+            \note It has a side effect to make the instance the unbound state (although the object that was bound on this remains bound on it).
+            \note The assignments in this take precedence over the ones in the library.
+        */
+        void link(const std::shared_ptr<const DataSyntax> &library);
+        /** Get the linked libraries.
+            \return The linked libraries in the order of linking.
+        */
+        const std::vector<std::shared_ptr<const DataSyntax>> &get_libraries() const;
 
         /** Is the instance able to generate a phrase?
             \return The instance is able to generate a phrase.
             \note Is means the instance has the production rule assigned to the start condition and is successfully bound.
         */
         bool is_valid() const;
+        /** Get the start condition.
+            \return The nonterminal where is the start condition.
+            \note is_valid() must be true.
+        */
+        const Symbol &get_start_condition() const;
+        /** Get the nonterminals reachable from the start condition.
+            \return The nonterminals, each of which follows the nonterminals that its production rule refers to.
+            \note is_valid() must be true.
+        */
+        std::vector<Symbol> get_reachable_nonterminals() const;
 
         /** Add a pair of a nonterminal and a production rule.
-            \param [inout] nonterminal The nonterminal. (moved)
+            \param [in] nonterminal The nonterminal.
             \param [inout] rule The production rule to be assigned to the nonterminal. (moved)
             \param [inout] err_msg The error message is added if an error is detected.
             \return true if no errors are detected.
@@ -122,14 +165,41 @@ namespace tphrase {
             \note If this already contains nonterminal, then: (1) nonterminal and rule do NOT add to this, (2) an error message is added to err_msg, (3) false is returned.
             \note A single error may occur at most.
         */
-        bool add(std::string &&nonterminal, DataProductionRule &&rule, std::string &err_msg);
+        bool add(const Symbol &nonterminal, DataProductionRule &&rule, std::string &err_msg);
         /** Add a set of the assignments.
             \param [inout] syntax The syntax with the assignments to be added. (moved)
             \param [inout] err_msg The error messages are added if some errors are detected.
             \note It has a side effect to make the instance the unbound state (although the object that was bound on this remains bound on it).
             \note If syntax has the nonterminal that this already contains, then: (1) the nonterminal in syntax overwrites it, (2) an error message is added to err_msg.
+            \note The local nonterminal in syntax that this already contains is renamed by appending "@" and a number, so each one is referred only by the production rules in its own syntax.
         */
         void add(DataSyntax &&syntax, std::vector<std::string> &err_msg);
+        /** Copy the local nonterminals that the production rules in this refer to.
+            \param [in] locals The syntax that has the local nonterminals.
+            \note The local nonterminals that the copied ones refer to are also copied.
+        */
+        void copy_local_nonterminals(const DataSyntax &locals);
+        /** Replace some assignments.
+            \param [in] removed The nonterminals to be removed.
+            \param [inout] added The assignments to be added. (moved)
+            \note It has a side effect to make the instance the unbound state (although the object that was bound on this remains bound on it).
+            \note The caller must ensure that added has no nonterminals that this contains, except for the nonterminals in removed.
+            \note The revision is renewed, and the changed nonterminals are recorded for update().
+        */
+        void replace(const std::vector<Symbol> &removed, DataSyntax &&added);
+        /** Renew the revision.
+            \note The revision identifies the contents of the instance. The copy has the same revision as the source, and the modifying functions except for replace() make the revision unknown.
+        */
+        void renew_revision();
+        /** Update the bound instance into a later revision of the same syntax.
+            \param [in] a The later revision of the syntax.
+            \param [inout] err_msg The error messages are added if some errors are detected.
+            \return true if no errors are detected.
+            \note If a is made by replace() from the revision of this, only the changed assignments are copied, and only the production rules that refer to them directly or indirectly are bound again. Otherwise, all the assignments are copied and bound.
+            \note The start condition is not changed.
+            \note This must be bound on this.
+        */
+        bool update(const DataSyntax &a, std::vector<std::string> &err_msg);
 
         /** Try to bind the expansions on the nonterminals in this.
             \param [in] start_condition The nonterminal where is the start condition.
@@ -138,29 +208,99 @@ namespace tphrase {
             \note Only the nonterminals that are directly or indirectly referred by the start condition are tried binding.
             \note An error is caused if the recursive reference to a nonterminal exists.
             \note An error is cause if the nonterminal start_condition doesn't exist.
+            \note An error is caused if start_condition is a local nonterminal, as if it doesn't exist.
         */
-        bool bind_syntax(const std::string &start_condition, std::vector<std::string> &err_msg);
+        bool bind_syntax(const Symbol &start_condition, std::vector<std::string> &err_msg);
+        /** Bind all the assignments to use the instance as a library.
+            \param [inout] err_msg The error messages are added if some errors are detected.
+            \return true if no errors are detected.
+            \note The instance has no start condition, so is_valid() is false.
+            \note An error is caused if the recursive reference to a nonterminal exists.
+        */
+        bool bind_library(std::vector<std::string> &err_msg);
+        /** Replace some assignments with the ones in a library, and remove the assignments unreachable from the start condition.
+            \param [in] shared The nonterminals whose production rules are replaced with the ones in library.
+            \param [in] library The library bound by bind_library(), or nullptr if shared is empty. (shared)
+            \note This must be bound on this, and library must have the production rules identical with the replaced ones, including the production rules that they refer to.
+            \note library is searched before the other libraries, and it must have no nonterminals that this refers to except for shared.
+            \note The instance is bound on this again, and the revision is unknown, so the next update() copies the whole syntax.
+        */
+        void share_rules(const std::vector<Symbol> &shared, const std::shared_ptr<const DataSyntax> &library);
 
-        /** Fix the reference to the local nonterminal.
+        /** Check the references to the local nonterminals, and release the local nonterminals that no other nonterminals refer to.
             \param [inout] err_msg The error messages are added if some errors are detected.
             \note An error is caused if the local nonterminal that is referred by a production rule doesn't exists.
+            \note The local nonterminals are kept as the assignments, so all the references share the production rule and bind it once.
         */
         void fix_local_nonterminal(std::vector<std::string> &err_msg);
 
+        /** Add the messages for the gsubs eliminated at the binding.
+            \param [inout] report The messages are added in the order of the nonterminal.
+        */
+        void report_eliminated_gsubs(std::vector<std::string> &report) const;
+        /** Count the memory held by the instance.
+            \param [inout] counter The bytes held by the instance and the linked libraries are added. The libraries already counted are skipped.
+        */
+        void count_memory(MemoryCounter &counter) const;
+
+        /** Write the instance into a snapshot.
+            \param [inout] w The writer of the snapshot.
+            \note The binding state is written with the assignments.
+            \note The linked libraries are written with the instance.
+        */
+        void save(SnapshotWriter &w) const;
+        /** Read the instance from a snapshot.
+            \param [inout] r The reader of the snapshot.
+            \param [in] config The configuration to create the gsub functions. Its gsub_creator must not be empty.
+            \note The instance is bound again if it was bound at writing. The linked libraries are bound as well.
+            \note The linked libraries are read as the libraries only for this.
+            \note An error is recorded in r if the snapshot is broken.
+        */
+        void load(SnapshotReader &r, const Config_t &config);
+        /** Write the production rules reachable from the start condition into a flat image.
+            \param [inout] w The writer of the image.
+            \return The offset of the record of the start condition.
+            \note is_valid() must be true.
+        */
+        std::uint64_t write_image(ImageWriter &w) const;
+
         /** Clear the instance. */
         void clear();
 
     private:
-        std::unordered_map<std::string, DataProductionRule> assignments; /**< The assignments in the syntax. */
+        /** Replace the assignments with the copies of the ones in another instance.
+            \param [in] a The source.
+            \note Each production rule is copied into its own arena, so that the arena is released as soon as the production rule is removed or replaced.
+            \note The instance is not bound.
+        */
+        void copy_assignments(const DataSyntax &a);
+
+        std::unordered_map<Symbol, DataProductionRule, Symbol::Hash> assignments; /**< The assignments in the syntax. */
         decltype(assignments)::iterator start_it; /**< The iterator for the start condition. */
         int binding_epoch; /**< The binding epoch. */
+        std::size_t revision; /**< The revision of the contents, or 0 if it's unknown. */
+        std::size_t prev_revision; /**< The revision from which replace() made this revision, or 0. */
+        std::vector<Symbol> changed; /**< The nonterminals changed by replace() from prev_revision. */
+        std::vector<std::shared_ptr<const DataSyntax>> libraries; /**< The linked libraries, which are searched for the nonterminals not in assignments. */
     };
 
+    inline
+    const std::vector<std::shared_ptr<const DataSyntax>> &DataSyntax::get_libraries() const
+    {
+        return libraries;
+    }
+
     inline
     bool DataSyntax::is_valid() const
     {
         return start_it != assignments.end();
     }
+
+    inline
+    const Symbol &DataSyntax::get_start_condition() const
+    {
+        return start_it->first;
+    }
 }
 
 #endif // TPHRASE_SRC_DATASYNTAX_H_
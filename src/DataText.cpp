@@ -37,81 +37,181 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstring>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
 #include "DataProductionRule.h"
 #include "DataSyntax.h"
 #include "DataText.h"
+#include "ImageWriter.h"
+#include "heap_size.h"
+#include "snapshot.h"
 
 namespace tphrase {
     DataText::Part_t::Part_t()
-        : kind{Kind_t::STRING}, s{}, r{nullptr}
+        : s{0, 0}, name{0}, kind{Kind_t::STRING}, linked{false}
     {
     }
 
-    // k should be STRING or EXPANSION.
-    DataText::Part_t::Part_t(Kind_t k, const std::string &v)
-        : kind{k}, s{v}, r{nullptr}
+    DataText::Part_t::Part_t(const Literal_t &v)
+        : s(v), name{0}, kind{Kind_t::STRING}, linked{false}
     {
     }
 
-    DataText::Part_t::Part_t(Kind_t k, std::string &&v)
-        : kind{k}, s{std::move(v)}, r{nullptr}
+    DataText::Part_t::Part_t(std::uint32_t v)
+        : r{nullptr}, name{v}, kind{Kind_t::EXPANSION}, linked{false}
     {
     }
 
-    DataText::Part_t::Part_t(DataProductionRule *v)
-        : kind{Kind_t::ANONYMOUS_RULE}, s{}, r{v}
+    DataText::Part_t::Part_t(const DataProductionRule *v)
+        : r{v}, name{0}, kind{Kind_t::ANONYMOUS_RULE}, linked{false}
     {
     }
 
-    DataText::Part_t &DataText::Part_t::operator=(Part_t &&a)
-    {
-        assert(kind == Kind_t::EXPANSION && r == nullptr);
-        kind = a.kind;
-        r = a.r;
-        return *this;
-    }
+    static_assert(std::is_nothrow_move_constructible<DataProductionRule>::value,
+                  "The anonymous rules must not be copied when anonymous_rules grows, because the snapshot reader refers the parts in them.");
 
     DataText::DataText()
         : parts{},
+          anonymous_rules{},
           comb{1},
           weight{1.0},
+          num_parts{0},
+          literal_size{0},
           weight_by_user{false}
     {
+        static_assert(std::is_trivially_copyable<Part_t>::value,
+                      "The parts and the literal pool are copied as a block of bytes.");
+        static_assert(sizeof(Part_t) <= 16, "The part should be compact.");
+    }
+
+    DataText::PartRange_t<DataText::Part_t> DataText::get_parts()
+    {
+        return PartRange_t<Part_t>{parts.data(), parts.data() + num_parts};
+    }
+
+    DataText::PartRange_t<const DataText::Part_t> DataText::get_parts() const
+    {
+        return PartRange_t<const Part_t>{parts.data(), parts.data() + num_parts};
+    }
+
+    void DataText::add_part(const Part_t &p)
+    {
+        parts.insert(parts.begin() + num_parts, p);
+        ++num_parts;
+    }
+
+    DataText::Part_t::Literal_t DataText::add_literal(const std::string &s)
+    {
+        const Part_t::Literal_t literal{literal_size, static_cast<std::uint32_t>(s.size())};
+        literal_size += literal.size;
+        parts.resize(num_parts + (literal_size + sizeof(Part_t) - 1) / sizeof(Part_t));
+        if (!s.empty()) {
+            std::memcpy(reinterpret_cast<char *>(parts.data() + num_parts) + literal.offset, s.data(), s.size());
+        }
+        return literal;
+    }
+
+    std::uint32_t DataText::add_name(const Symbol &name)
+    {
+        // The name is aligned in the literal pool, whose beginning is aligned as well as Part_t.
+        static_assert(alignof(Part_t) % alignof(Symbol) == 0, "The names in the literal pool must be aligned.");
+        const std::uint32_t offset{static_cast<std::uint32_t>((literal_size + alignof(Symbol) - 1) / alignof(Symbol) * alignof(Symbol))};
+        literal_size = offset + sizeof(Symbol);
+        parts.resize(num_parts + (literal_size + sizeof(Part_t) - 1) / sizeof(Part_t));
+        // The name is constructed in the literal pool, and it's destroyed by clear_parts(). It's relocated as bytes with the parts because it's only a pointer.
+        new (reinterpret_cast<char *>(parts.data() + num_parts) + offset) Symbol{name};
+        return offset;
+    }
+
+    const char *DataText::get_literals() const
+    {
+        return reinterpret_cast<const char *>(parts.data() + num_parts);
+    }
+
+    std::string DataText::get_string(const Part_t &p) const
+    {
+        return std::string(get_literals() + p.s.offset, p.s.size);
+    }
+
+    const Symbol &DataText::get_name(const Part_t &p) const
+    {
+        return *reinterpret_cast<const Symbol *>(get_literals() + p.name);
     }
 
     void DataText::copy_parts(const DataText &a)
     {
-        for (const auto &it : a.parts) {
-            if (it.kind == Part_t::Kind_t::ANONYMOUS_RULE) {
-                parts.emplace_back(new DataProductionRule{*it.r});
-            } else {
-                parts.emplace_back(it.kind, it.s);
+        parts.assign(a.parts.begin(), a.parts.end());
+        num_parts = a.num_parts;
+        literal_size = a.literal_size;
+        char *literals{reinterpret_cast<char *>(parts.data() + num_parts)};
+        for (auto &p : get_parts()) {
+            if (p.kind == Part_t::Kind_t::EXPANSION) {
+                p.r = nullptr;
+                p.linked = false;
+                // The copied bytes of the name don't count the reference.
+                new (literals + p.name) Symbol{a.get_name(p)};
             }
         }
+        anonymous_rules = a.anonymous_rules;
+        relink_anonymous_rules();
     }
 
     void DataText::clear_parts() noexcept
     {
-        for (auto &it : parts) {
-            if (it.kind == Part_t::Kind_t::ANONYMOUS_RULE) {
-                delete it.r;
+        char *literals{reinterpret_cast<char *>(parts.data() + num_parts)};
+        for (const auto &p : get_parts()) {
+            if (p.kind == Part_t::Kind_t::EXPANSION) {
+                reinterpret_cast<Symbol *>(literals + p.name)->~Symbol();
             }
         }
         parts.clear();
+        anonymous_rules.clear();
+        num_parts = 0;
+        literal_size = 0;
+    }
+
+    void DataText::relink_anonymous_rules()
+    {
+        auto it = anonymous_rules.begin();
+        for (auto &p : get_parts()) {
+            if (p.kind == Part_t::Kind_t::ANONYMOUS_RULE) {
+                assert(it != anonymous_rules.end());
+                p.r = &*it;
+                ++it;
+            }
+        }
     }
 
     DataText::DataText(const DataText &a)
         : parts{},
+          anonymous_rules{},
           comb{a.comb},
           weight{a.weight},
+          num_parts{0},
+          literal_size{0},
           weight_by_user{a.weight_by_user}
     {
         copy_parts(a);
     }
 
+    DataText::DataText(DataText &&a) noexcept
+        : parts{std::move(a.parts)},
+          anonymous_rules{std::move(a.anonymous_rules)},
+          comb{a.comb},
+          weight{a.weight},
+          num_parts{a.num_parts},
+          literal_size{a.literal_size},
+          weight_by_user{a.weight_by_user}
+    {
+        // The names in the literal pool are moved with the parts.
+        a.num_parts = 0;
+        a.clear_parts();
+    }
+
     DataText::~DataText() noexcept
     {
         clear_parts();
@@ -129,20 +229,38 @@ namespace tphrase {
         return *this;
     }
 
-    std::string DataText::generate(const ExtContext_t &ext_context) const
+    DataText &DataText::operator=(DataText &&a) noexcept
+    {
+        clear_parts();
+        parts = std::move(a.parts);
+        anonymous_rules = std::move(a.anonymous_rules);
+        comb = a.comb;
+        weight = a.weight;
+        num_parts = a.num_parts;
+        literal_size = a.literal_size;
+        weight_by_user = a.weight_by_user;
+        a.num_parts = 0;
+        a.clear_parts();
+
+        return *this;
+    }
+
+    std::string DataText::generate(const ExtContext_t &ext_context, const RandomFunc_t &rand) const
     {
         std::string s;
-        for (const auto &p : parts) {
+        const char *literals{get_literals()};
+        for (const auto &p : get_parts()) {
             if (p.kind == Part_t::Kind_t::STRING) {
-                s += p.s;
+                s.append(literals + p.s.offset, p.s.size);
             } else if (p.r) {
-                s += p.r->generate(ext_context);
+                s += p.r->generate(ext_context, rand);
             } else {
-                const auto it = ext_context.find(p.s);
+                const auto &name = get_name(p).str();
+                const auto it = ext_context.find(name);
                 if (it != ext_context.end()) {
                     s += it->second;
                 } else {
-                    s += p.s;
+                    s += name;
                 }
             }
         }
@@ -151,22 +269,24 @@ namespace tphrase {
 
     void DataText::add_string(const std::string &s)
     {
-        parts.emplace_back(Part_t::Kind_t::STRING, s);
+        add_part(Part_t{add_literal(s)});
     }
 
     void DataText::add_string(std::string &&s)
     {
-        parts.emplace_back(Part_t::Kind_t::STRING, std::move(s));
+        add_string(static_cast<const std::string &>(s));
     }
 
-    void DataText::add_expansion(std::string &&name)
+    void DataText::add_expansion(const Symbol &name)
     {
-        parts.emplace_back(Part_t::Kind_t::EXPANSION, std::move(name));
+        add_part(Part_t{add_name(name)});
     }
 
     void DataText::add_anonymous_rule(DataProductionRule &&r)
     {
-        parts.emplace_back(new DataProductionRule{std::move(r)});
+        anonymous_rules.emplace_back(std::move(r));
+        add_part(Part_t{static_cast<const DataProductionRule *>(nullptr)});
+        relink_anonymous_rules();
     }
 
     void DataText::set_weight(double w)
@@ -186,23 +306,33 @@ namespace tphrase {
     {
         double tmp_weight{1.0};
         comb = 1;
-        for (auto &p : parts) {
+        auto anonymous_it = anonymous_rules.begin();
+        for (auto &p : get_parts()) {
             if (p.kind == Part_t::Kind_t::ANONYMOUS_RULE) {
-                p.r->bind_syntax(syntax, epoch, err_msg);
+                anonymous_it->bind_syntax(syntax, epoch, err_msg);
+                ++anonymous_it;
             } else if (p.kind == Part_t::Kind_t::EXPANSION) {
-                if (syntax.has_nonterminal(p.s)) {
-                    p.r = &syntax.get_production_rule(p.s);
-                    if (!p.r->bind_syntax(syntax, epoch, err_msg)) {
+                const Symbol &name{get_name(p)};
+                p.linked = false;
+                if (syntax.has_nonterminal(name)) {
+                    DataProductionRule &rule{syntax.get_production_rule(name)};
+                    if (rule.bind_syntax(syntax, epoch, err_msg)) {
+                        p.r = &rule;
+                    } else {
                         p.r = nullptr;
 
                         std::string msg{"Recursive expansion of \""};
-                        msg += p.s;
+                        msg += DataSyntax::get_source_name(name);
                         msg += "\" is detected.";
                         err_msg.emplace_back(std::move(msg));
                     }
+                } else {
+                    // The nonterminal may be removed after the previous binding. The production rule in a library is already bound.
+                    p.r = syntax.find_linked_rule(name);
+                    p.linked = p.r != nullptr;
                 }
             }
-            if (p.r) {
+            if (p.kind != Part_t::Kind_t::STRING && p.r) {
                 comb *= p.r->get_combination_number();
                 tmp_weight *= p.r->get_weight();
             }
@@ -212,22 +342,181 @@ namespace tphrase {
         }
     }
 
+    ByteAlphabet_t DataText::get_output_alphabet() const
+    {
+        ByteAlphabet_t alphabet;
+        const char *literals{get_literals()};
+        for (const auto &p : get_parts()) {
+            if (p.kind == Part_t::Kind_t::STRING) {
+                for (std::uint32_t i = 0; i < p.s.size; ++i) {
+                    alphabet.set(static_cast<unsigned char>(literals[p.s.offset + i]));
+                }
+            } else if (p.r) {
+                alphabet |= p.r->get_output_alphabet();
+            } else {
+                alphabet.set();
+            }
+        }
+        return alphabet;
+    }
+
+    void DataText::reset_binding_epoch()
+    {
+        for (auto &rule : anonymous_rules) {
+            rule.reset_binding_epoch();
+        }
+    }
+
+    void DataText::collect_expansions(std::vector<Symbol> &names) const
+    {
+        for (const auto &p : get_parts()) {
+            if (p.kind == Part_t::Kind_t::ANONYMOUS_RULE) {
+                p.r->collect_expansions(names);
+            } else if (p.kind == Part_t::Kind_t::EXPANSION) {
+                names.emplace_back(get_name(p));
+            }
+        }
+    }
+
+    void DataText::collect_gsub_creators(std::vector<DataGsubs::CreatorID_t> &creators) const
+    {
+        for (const auto &r : anonymous_rules) {
+            r.collect_gsub_creators(creators);
+        }
+    }
+
+    void DataText::report_eliminated_gsubs(const std::string &nonterminal, std::vector<std::string> &report) const
+    {
+        for (const auto &p : get_parts()) {
+            if (p.kind == Part_t::Kind_t::ANONYMOUS_RULE) {
+                p.r->report_eliminated_gsubs(nonterminal, report);
+            }
+        }
+    }
+
+    void DataText::count_memory(MemoryCounter &counter) const
+    {
+        const std::size_t parts_size{num_parts * sizeof(Part_t)};
+        counter.usage.parts += parts_size;
+        counter.usage.literals += counter.get_capacity_size(parts) - parts_size;
+        counter.usage.rules += counter.get_capacity_size(anonymous_rules);
+        for (const auto &r : anonymous_rules) {
+            r.count_memory(counter);
+        }
+    }
+
+    std::size_t DataText::get_arena_size() const
+    {
+        std::size_t size{get_copy_size(parts) + get_copy_size(anonymous_rules)};
+        for (const auto &r : anonymous_rules) {
+            size += r.get_arena_size();
+        }
+        return size;
+    }
+
     void
-    DataText::fix_local_nonterminal(DataSyntax &syntax,
-                                    std::vector<std::string> &err_msg)
-    {
-        for (auto &p : parts) {
-            if (p.kind == Part_t::Kind_t::EXPANSION
-                && syntax.is_local_nonterminal(p.s)) {
-                if (syntax.has_nonterminal(p.s)) {
-                    p = Part_t(new DataProductionRule{syntax.get_production_rule(p.s)});
-                } else {
+    DataText::check_local_nonterminal(const DataSyntax &syntax,
+                                      std::vector<std::string> &err_msg) const
+    {
+        for (const auto &p : get_parts()) {
+            if (p.kind == Part_t::Kind_t::ANONYMOUS_RULE) {
+                p.r->check_local_nonterminal(syntax, err_msg);
+            } else if (p.kind == Part_t::Kind_t::EXPANSION) {
+                const Symbol &name{get_name(p)};
+                if (syntax.is_local_nonterminal(name) && !syntax.has_nonterminal(name)) {
                     std::string msg{"The local nonterminal \""};
-                    msg += p.s;
+                    msg += name.str();
                     msg += "\" is not found.";
                     err_msg.emplace_back(std::move(msg));
                 }
             }
         }
     }
+
+    void DataText::rename_expansions(const std::unordered_map<Symbol, Symbol, Symbol::Hash> &renamed)
+    {
+        for (auto &r : anonymous_rules) {
+            r.rename_expansions(renamed);
+        }
+        char *literals{reinterpret_cast<char *>(parts.data() + num_parts)};
+        for (auto &p : get_parts()) {
+            if (p.kind == Part_t::Kind_t::EXPANSION) {
+                const auto found{renamed.find(get_name(p))};
+                if (found != renamed.end()) {
+                    *reinterpret_cast<Symbol *>(literals + p.name) = found->second;
+                    p.r = nullptr;
+                    p.linked = false;
+                }
+            }
+        }
+    }
+
+    void DataText::save(SnapshotWriter &w) const
+    {
+        w.write_bool(weight_by_user);
+        if (weight_by_user) {
+            w.write_double(weight);
+        }
+        w.write_size(num_parts);
+        for (const auto &p : get_parts()) {
+            w.write_byte(static_cast<unsigned char>(p.kind));
+            if (p.kind == Part_t::Kind_t::ANONYMOUS_RULE) {
+                p.r->save(w);
+            } else if (p.kind == Part_t::Kind_t::EXPANSION) {
+                w.write_string(get_name(p).str());
+            } else {
+                w.write_string(get_string(p));
+            }
+        }
+    }
+
+    void DataText::load(SnapshotReader &r, const Config_t &config)
+    {
+        clear_parts();
+        comb = 1;
+        weight_by_user = r.read_bool();
+        weight = weight_by_user ? r.read_double() : 1.0;
+        if (!(weight >= 0.0)) {
+            r.fail("The snapshot is broken.");
+        }
+        const std::size_t num_read{r.read_size()};
+        for (std::size_t i = 0; i < num_read && r.good(); ++i) {
+            const unsigned char kind{r.read_byte()};
+            if (kind == static_cast<unsigned char>(Part_t::Kind_t::STRING)) {
+                add_string(r.read_string());
+            } else if (kind == static_cast<unsigned char>(Part_t::Kind_t::EXPANSION)) {
+                add_expansion(Symbol{r.read_string()});
+            } else if (kind == static_cast<unsigned char>(Part_t::Kind_t::ANONYMOUS_RULE)) {
+                anonymous_rules.emplace_back(DataOptions{}, DataGsubs{});
+                add_part(Part_t{static_cast<const DataProductionRule *>(nullptr)});
+                anonymous_rules.back().load(r, config);
+            } else {
+                r.fail("The snapshot is broken.");
+            }
+        }
+        relink_anonymous_rules();
+    }
+
+    std::uint64_t DataText::write_image(ImageWriter &w) const
+    {
+        std::vector<std::pair<image::PartKind_t, std::pair<std::uint64_t, std::uint64_t>>> words;
+        for (const auto &p : get_parts()) {
+            if (p.kind == Part_t::Kind_t::STRING) {
+                words.emplace_back(image::PartKind_t::STRING, std::make_pair(w.add_string(get_string(p)), std::uint64_t{p.s.size}));
+            } else if (p.r) {
+                words.emplace_back(image::PartKind_t::RULE, std::make_pair(p.r->write_image(w), std::uint64_t{0}));
+            } else {
+                const auto &name = get_name(p).str();
+                words.emplace_back(image::PartKind_t::EXTERNAL, std::make_pair(w.add_string(name), std::uint64_t{name.size()}));
+            }
+        }
+        const std::uint64_t offset{w.begin_record()};
+        w.write_u64(words.size());
+        for (const auto &word : words) {
+            w.write_u64(static_cast<std::uint64_t>(word.first));
+            w.write_u64(word.second.first);
+            w.write_u64(word.second.second);
+        }
+        return offset;
+    }
 }
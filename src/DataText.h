@@ -39,17 +39,31 @@
 #define TPHRASE_SRC_DATATEXT_H_
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "tphrase/common/config.h"
 #include "tphrase/common/ext_context.h"
+#include "tphrase/common/random_func.h"
+#include "Arena.h"
+#include "DataGsubs.h"
+#include "Symbol.h"
+#include "byte_alphabet.h"
 
 namespace tphrase {
     class DataProductionRule;
     class DataSyntax;
+    class ImageWriter;
+    class MemoryCounter;
+    class SnapshotReader;
+    class SnapshotWriter;
 
     /** The data structure representing the text.
+        \note The instance owns the anonymous rules in it. They and the parts are allocated in the arena of the scope in which the instance is created.
+        \note The strings and the names of the expansions are stored in the literal pool that follows the parts in the same block, so the parts of a short text fit in a cache line. The total size of the strings in a text must be less than 4 GiB.
         \note The instance bound on a syntax doesn't own the syntax, so the users must keep the syntax alive until the instance is unused.
         \note The copied instance is unbound.
     */
@@ -65,7 +79,7 @@ namespace tphrase {
         /** The move constructor.
             \param [inout] a The source.
         */
-        DataText(DataText &&a) = default;
+        DataText(DataText &&a) noexcept;
 
         /** The destructor. */
         ~DataText() noexcept;
@@ -80,13 +94,14 @@ namespace tphrase {
             \param [inout] a The source. (moved)
             \return *this
         */
-        DataText &operator=(DataText &&a) = default;
+        DataText &operator=(DataText &&a) noexcept;
 
         /** Generate a text.
             \param [in] ext_context The external context that has some nonterminals and the substitutions.
+            \param [in] rand The random function.
             \return A text.
         */
-        std::string generate(const ExtContext_t &ext_context) const;
+        std::string generate(const ExtContext_t &ext_context, const RandomFunc_t &rand) const;
 
         /** Get the weight of the texts.
             \return The weight.
@@ -107,9 +122,9 @@ namespace tphrase {
         */
         void add_string(std::string &&s);
         /** Add an expansion name that is a part of the text.
-            \param [inout] name The expansion name. (moved)
+            \param [in] name The expansion name.
         */
-        void add_expansion(std::string &&name);
+        void add_expansion(const Symbol &name);
         /** Add an anonymous rule that is a part of the text.
             \param [inout] r The anonymous rule. (moved)
         */
@@ -131,12 +146,65 @@ namespace tphrase {
                          int epoch,
                          std::vector<std::string> &err_msg);
 
-        /** Fix the reference to the local nonterminal.
-            \param [inout] syntax The syntax to be fixed.
+        /** Check the references to the local nonterminals in this and the anonymous rules.
+            \param [in] syntax The syntax that has the local nonterminals.
             \param [inout] err_msg The error messages are added if some errors are detected.
             \note An error is caused if the local nonterminal that is referred by a production rule doesn't exists.
         */
-        void fix_local_nonterminal(DataSyntax& syntax, std::vector<std::string> &err_msg);
+        void check_local_nonterminal(const DataSyntax &syntax, std::vector<std::string> &err_msg) const;
+        /** Rename the expansions in this and the anonymous rules.
+            \param [in] renamed The map from the old names to the new names.
+            \note The renamed expansions must be bound again.
+        */
+        void rename_expansions(const std::unordered_map<Symbol, Symbol, Symbol::Hash> &renamed);
+
+        /** Reset the binding epoch of the anonymous rules. */
+        void reset_binding_epoch();
+        /** Add the names of the expansions in this and the anonymous rules.
+            \param [inout] names The names are added.
+        */
+        void collect_expansions(std::vector<Symbol> &names) const;
+        /** Add the identities of the creators of the gsub functions in the anonymous rules.
+            \param [inout] creators The identities are added.
+        */
+        void collect_gsub_creators(std::vector<DataGsubs::CreatorID_t> &creators) const;
+
+        /** Get the set of the bytes that the generated text can contain.
+            \return The set of the bytes.
+            \note The return value is meaningful only when the instance is bound on a syntax.
+            \note The expansion that is not bound can generate any bytes because it's substituted by the external context.
+        */
+        ByteAlphabet_t get_output_alphabet() const;
+        /** Add the patterns of the gsubs eliminated in the anonymous rules.
+            \param [in] nonterminal The nonterminal that contains the instance.
+            \param [inout] report The messages for the eliminated gsubs are added.
+        */
+        void report_eliminated_gsubs(const std::string &nonterminal, std::vector<std::string> &report) const;
+        /** Count the memory allocated by the instance.
+            \param [inout] counter The bytes allocated by the instance, excluding the instance itself, are added. The shared objects already counted are skipped.
+        */
+        void count_memory(MemoryCounter &counter) const;
+        /** Get the size of the arena used by a copy of the instance.
+            \return The number of the bytes, including the padding for the alignment. The anonymous rules are included.
+        */
+        std::size_t get_arena_size() const;
+
+        /** Write the instance into a snapshot.
+            \param [inout] w The writer of the snapshot.
+        */
+        void save(SnapshotWriter &w) const;
+        /** Read the instance from a snapshot.
+            \param [inout] r The reader of the snapshot.
+            \param [in] config The configuration to create the gsub functions. Its gsub_creator must not be empty.
+            \note The expansions are not bound.
+        */
+        void load(SnapshotReader &r, const Config_t &config);
+        /** Write the instance into a flat image.
+            \param [inout] w The writer of the image.
+            \return The offset of the record.
+            \note The production rules in the parts are written before the record.
+        */
+        std::uint64_t write_image(ImageWriter &w) const;
 
     private:
         /** Copy another DataText to parts.
@@ -145,56 +213,119 @@ namespace tphrase {
         */
         void copy_parts(const DataText &a);
 
-        /** Clear the anonymous rule in this. */
+        /** Clear the parts and the anonymous rules in this. */
         void clear_parts() noexcept;
 
+        /** Point the parts of the anonymous rules to the elements of anonymous_rules.
+            \note It must be called after anonymous_rules is changed, because the elements may be moved.
+        */
+        void relink_anonymous_rules();
+
         /** A part of the text.
-            \note The instance doesn't own the instance of DataProductionRule.
+            \note The instance doesn't own the instance of DataProductionRule. The anonymous rule is an element of DataText::anonymous_rules.
+            \note The type is trivially copyable, so the parts and the literal pool are copied and moved as a block of bytes.
         */
         struct Part_t {
             /** The type of the kind. */
-            enum class Kind_t {
+            enum class Kind_t : std::uint8_t {
                 STRING, /**< The part is a string. */
                 EXPANSION, /**< The part is an expansion. */
                 ANONYMOUS_RULE /**< The part is an anonymous rule. */
-            } kind; /**< The kind of the part. */
-            const std::string s; /**< The string, or the name of the expansion. */
-            DataProductionRule *r; /**< The anonymous rule, or the production rule assigned to the expansion. */
+            };
+            /** The range of a string in the literal pool. */
+            struct Literal_t {
+                std::uint32_t offset; /**< The offset of the string. */
+                std::uint32_t size; /**< The size of the string. */
+            };
 
-            /** The default constructor. */
+            union {
+                Literal_t s; /**< The string, if kind is STRING. */
+                const DataProductionRule *r; /**< The anonymous rule, or the production rule assigned to the expansion, if kind isn't STRING. */
+            };
+            std::uint32_t name; /**< The offset of the name of the expansion in the literal pool, if kind is EXPANSION. */
+            Kind_t kind; /**< The kind of the part. */
+            bool linked; /**< Is the expansion bound on a production rule in a linked library? */
+
+            /** The default constructor to create the empty string. */
             Part_t();
-            /** Constructor for a string or an expansion.
-                \param [in] k The kind of the part.
-                \param [in] v The string, or the name of the expansion.
+            /** Constructor for a string.
+                \param [in] v The range of the string in the literal pool.
             */
-            Part_t(Kind_t k, const std::string &v);
-            /** Constructor for a string or an expansion.
-                \param [in] k The kind of the part.
-                \param [inout] v The string, or the name of the expansion. (moved)
+            explicit Part_t(const Literal_t &v);
+            /** Constructor for an expansion.
+                \param [in] v The offset of the name of the expansion in the literal pool.
             */
-            Part_t(Kind_t k, std::string &&v);
+            explicit Part_t(std::uint32_t v);
             /** Constructor for an anonymous rule.
-                \param [in] v The pointer to the anonymous rule.
+                \param [in] v The pointer to the anonymous rule, or nullptr if it's linked later.
                 \note The instance doesn't own the anonymous rule.
             */
-            explicit Part_t(DataProductionRule *v);
-            Part_t(const Part_t &a) = delete;
-            /** The move constructor.
-                \param [inout] a The source.
+            explicit Part_t(const DataProductionRule *v);
+        };
+
+        /** The range of the parts for the range-based for loop.
+            \tparam T Part_t or const Part_t.
+        */
+        template<typename T>
+        struct PartRange_t {
+            T *first; /**< The first part. */
+            T *last; /**< The end of the parts. */
+
+            /** Get the first part.
+                \return The first part.
             */
-            Part_t(Part_t &&a) = default;
-            Part_t &operator=(const Part_t &a) = delete;
-            /** The move assignment.
-                \param [inout] a The source. (moved)
-                \return *this
-                \note This kind must be EXPANSION.
+            T *begin() const { return first; }
+            /** Get the end of the parts.
+                \return The end of the parts.
             */
-            Part_t &operator=(Part_t &&a);
+            T *end() const { return last; }
         };
 
-        std::vector<Part_t> parts; /**< The parts of the text. */
+        /** Get the parts.
+            \return The range of the parts, which excludes the literal pool.
+        */
+        PartRange_t<Part_t> get_parts();
+        /** Get the parts.
+            \return The range of the parts, which excludes the literal pool.
+        */
+        PartRange_t<const Part_t> get_parts() const;
+        /** Add a part.
+            \param [in] p The part.
+            \note The literal pool is moved to make room for the part.
+        */
+        void add_part(const Part_t &p);
+        /** Add a string into the literal pool.
+            \param [in] s The string.
+            \return The range of the string in the literal pool.
+        */
+        Part_t::Literal_t add_literal(const std::string &s);
+        /** Add a name into the literal pool.
+            \param [in] name The name.
+            \return The offset of the name in the literal pool.
+            \note The name in the literal pool refers to the entry of the symbol table until clear_parts() is called.
+        */
+        std::uint32_t add_name(const Symbol &name);
+        /** Get the literal pool.
+            \return The beginning of the literal pool.
+        */
+        const char *get_literals() const;
+        /** Get the string of a part.
+            \param [in] p The part whose kind is STRING.
+            \return The string.
+        */
+        std::string get_string(const Part_t &p) const;
+        /** Get the name of a part.
+            \param [in] p The part whose kind is EXPANSION.
+            \return The name of the expansion.
+        */
+        const Symbol &get_name(const Part_t &p) const;
+
+        ArenaVector_t<Part_t> parts; /**< The parts of the text, followed by the literal pool that has the strings and the names of the expansions. */
+        ArenaVector_t<DataProductionRule> anonymous_rules; /**< anonymous_rules[i] is the anonymous rule of the i-th part whose kind is ANONYMOUS_RULE. */
         std::size_t comb; /**< The number of the combination. */
         double weight; /**< The weight of the text. */
+        std::uint32_t num_parts; /**< The number of the parts, which precede the literal pool in parts. */
+        std::uint32_t literal_size; /**< The size of the literal pool in bytes. */
         bool weight_by_user; /**< Was the weight manually set? */
     };
 
@@ -35,13 +35,19 @@
     \endparblock
 */
 
+#include <istream>
+#include <ostream>
 #include <utility>
 
 #include "tphrase/common/ext_context.h"
 #include "tphrase/Generator.h"
 #include "DataGsubs.h"
 #include "DataPhrase.h"
+#include "ImageWriter.h"
+#include "gsub_cache.h"
+#include "heap_size.h"
 #include "random.h"
+#include "snapshot.h"
 
 namespace {
     /** The predefined empty external context. */
@@ -55,19 +61,27 @@ namespace tphrase {
 
     /** The type of the private data of the class Generator. */
     struct Generator::Impl {
+        Config_t config; /**< The configuration. */
+        RandomFunc_t rand; /**< The random function created by the configuration, or an empty function. */
         std::vector<std::string> err_msg; /**< The holder of the error messages. */
         DataPhrase data; /**< The data structure for the phrase generator. */
 
         /** The default constructor. */
         Impl() = default;
+        /** The constructor with a configuration.
+            \param [in] conf The configuration.
+        */
+        explicit Impl(const Config_t &conf);
         /** The constructor to copy error messages.
+            \param [in] conf The configuration.
             \param [in] err The error messages.
         */
-        Impl(const std::vector<std::string> &err);
+        Impl(const Config_t &conf, const std::vector<std::string> &err);
         /** The constructor to move error messages.
+            \param [in] conf The configuration.
             \param [inout] err The error messages. (moved)
         */
-        Impl(std::vector<std::string> &&err);
+        Impl(const Config_t &conf, std::vector<std::string> &&err);
         /** The copy constructor.
             \param [in] a The source.
         */
@@ -77,16 +91,53 @@ namespace tphrase {
             \return *this
         */
         Impl &operator=(const Impl &a) = default;
+
+        /** Get the random function to generate a phrase.
+            \return The random function created by the configuration, or the process-wide one if the configuration doesn't have the creator.
+        */
+        const RandomFunc_t &get_random_function() const;
+        /** Get the configuration to create the gsub functions.
+            \return The configuration whose gsub creator is replaced by the process-wide one if it's empty.
+        */
+        Config_t get_gsub_config() const;
     };
 
-    Generator::Impl::Impl(const std::vector<std::string> &err)
-        : err_msg{err}, data{}
+    Generator::Impl::Impl(const Config_t &conf)
+        : config{conf}, rand{}, err_msg{}, data{}
+    {
+        if (config.random_creator) {
+            rand = config.random_creator();
+        }
+    }
+
+    Generator::Impl::Impl(const Config_t &conf, const std::vector<std::string> &err)
+        : Impl{conf}
     {
+        err_msg = err;
+    }
+
+    Generator::Impl::Impl(const Config_t &conf, std::vector<std::string> &&err)
+        : Impl{conf}
+    {
+        err_msg = std::move(err);
+    }
+
+    const RandomFunc_t &Generator::Impl::get_random_function() const
+    {
+        if (rand) {
+            return rand;
+        } else {
+            return random;
+        }
     }
 
-    Generator::Impl::Impl(std::vector<std::string> &&err)
-        : err_msg{std::move(err)}, data{}
+    Config_t Generator::Impl::get_gsub_config() const
     {
+        Config_t gsub_config{config};
+        if (!gsub_config.gsub_creator) {
+            gsub_config.gsub_creator = DataGsubs::get_gsub_function_creator();
+        }
+        return gsub_config;
     }
 
     Generator::Generator()
@@ -94,6 +145,11 @@ namespace tphrase {
     {
     }
 
+    Generator::Generator(const Config_t &config)
+        : pimpl{new Impl{config}}
+    {
+    }
+
     Generator::Generator(const Syntax &syntax)
         : Generator{syntax, default_start_condition}
     {
@@ -106,7 +162,7 @@ namespace tphrase {
 
     Generator::Generator(const Syntax &syntax,
                          const std::string &start_condition)
-        : pimpl{new Impl{syntax.get_error_message()}}
+        : pimpl{new Impl{syntax.get_config(), syntax.get_error_message()}}
     {
         if (pimpl->err_msg.empty()) {
             pimpl->data.add(syntax.get_syntax_data(),
@@ -116,7 +172,7 @@ namespace tphrase {
     }
 
     Generator::Generator(Syntax &&syntax, const std::string &start_condition)
-        : pimpl{new Impl{std::move(syntax).move_error_message()}}
+        : pimpl{new Impl{syntax.get_config(), std::move(syntax).move_error_message()}}
     {
         if (pimpl->err_msg.empty()) {
             pimpl->data.add(std::move(syntax).move_syntax_data(),
@@ -159,12 +215,12 @@ namespace tphrase {
 
     std::string Generator::generate() const
     {
-        return pimpl->data.generate(empty_context);
+        return pimpl->data.generate(empty_context, pimpl->get_random_function());
     }
 
     std::string Generator::generate(const ExtContext_t &ext_context) const
     {
-        return pimpl->data.generate(ext_context);
+        return pimpl->data.generate(ext_context, pimpl->get_random_function());
     }
 
     SyntaxID_t Generator::add(const Syntax &syntax)
@@ -212,6 +268,19 @@ namespace tphrase {
         return pimpl->data.remove(id);
     }
 
+    bool Generator::update(const SyntaxID_t id, const Syntax &syntax)
+    {
+        const auto &add_err = syntax.get_error_message();
+        if (!add_err.empty()) {
+            for (auto &err : add_err) {
+                pimpl->err_msg.emplace_back(err);
+            }
+            pimpl->data.remove(id);
+            return false;
+        }
+        return pimpl->data.update(id, syntax.get_syntax_data(), pimpl->err_msg);
+    }
+
     const std::vector<std::string> &Generator::get_error_message() const
     {
         return pimpl->err_msg;
@@ -233,6 +302,11 @@ namespace tphrase {
         pimpl->data.equalize_chance(enable);
     }
 
+    const Config_t &Generator::get_config() const
+    {
+        return pimpl->config;
+    }
+
     std::size_t Generator::get_number_of_syntax() const
     {
         return pimpl->data.get_number_of_syntax();
@@ -243,11 +317,61 @@ namespace tphrase {
         return pimpl->data.get_combination_number();
     }
 
+    std::vector<std::string> Generator::get_eliminated_gsub_report() const
+    {
+        return pimpl->data.get_eliminated_gsub_report();
+    }
+
+    std::size_t Generator::compact()
+    {
+        return pimpl->data.compact();
+    }
+
+    MemoryUsage_t Generator::memory_usage() const
+    {
+        MemoryCounter counter;
+        pimpl->data.count_memory(counter);
+        counter.usage.error_messages += get_heap_size(pimpl->err_msg);
+        counter.usage.others += sizeof(Impl);
+        return counter.get_usage();
+    }
+
     double Generator::get_weight() const
     {
         return pimpl->data.get_weight();
     }
 
+    bool Generator::save(std::ostream &os) const
+    {
+        SnapshotWriter w{os};
+        w.write_header(SnapshotKind_t::GENERATOR);
+        pimpl->data.save(w);
+        return w.good();
+    }
+
+    bool Generator::load(std::istream &is)
+    {
+        SnapshotReader r{is};
+        if (r.read_header(SnapshotKind_t::GENERATOR)) {
+            pimpl->data.load(r, pimpl->get_gsub_config());
+        } else {
+            pimpl->data.clear();
+        }
+        if (!r.good()) {
+            pimpl->err_msg.emplace_back(r.get_error_message());
+        }
+        return r.good();
+    }
+
+    bool Generator::save_image(std::ostream &os) const
+    {
+        ImageWriter w;
+        const std::uint64_t phrase{pimpl->data.write_image(w)};
+        const std::string image{w.finish(phrase)};
+        os.write(image.data(), image.size());
+        return static_cast<bool>(os);
+    }
+
     void Generator::set_gsub_function_creator(const GsubFuncCreator_t &creator)
     {
         DataGsubs::set_gsub_function_creator(creator);
@@ -258,6 +382,21 @@ namespace tphrase {
         return DataGsubs::get_gsub_function_creator();
     }
 
+    void Generator::set_gsub_cache_capacity(const std::size_t capacity)
+    {
+        tphrase::set_gsub_cache_capacity(capacity);
+    }
+
+    GsubCacheStats_t Generator::get_gsub_cache_stats()
+    {
+        return tphrase::get_gsub_cache_stats();
+    }
+
+    void Generator::clear_gsub_cache()
+    {
+        tphrase::clear_gsub_cache();
+    }
+
     void Generator::set_random_function(const RandomFunc_t &rand)
     {
         random = rand;
@@ -0,0 +1,525 @@
+/** The read-only phrase generator on a flat image.
+    \file GeneratorImage.cpp
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tphrase/GeneratorImage.h"
+#include "DataGsubs.h"
+#include "ImageWriter.h"
+#include "MappedFile.h"
+#include "random.h"
+#include "snapshot.h"
+
+namespace {
+    /** The predefined empty external context. */
+    const tphrase::ExtContext_t empty_context;
+
+    /** The size of a word in the image. */
+    constexpr std::uint64_t word{sizeof(std::uint64_t)};
+
+    /** The stream buffer to read a range of the memory. */
+    class MemoryBuffer : public std::streambuf {
+    public:
+        /** The constructor.
+            \param [in] begin The beginning of the range.
+            \param [in] end The end of the range.
+        */
+        MemoryBuffer(const char *begin, const char *end)
+        {
+            // The buffer is never written.
+            setg(const_cast<char *>(begin), const_cast<char *>(begin), const_cast<char *>(end));
+        }
+    };
+}
+
+namespace tphrase {
+
+    /** The type of the private data of the class GeneratorImage. */
+    struct GeneratorImage::Impl {
+        Config_t config; /**< The configuration. */
+        RandomFunc_t rand; /**< The random function created by the configuration, or an empty function. */
+        std::vector<std::string> err_msg; /**< The holder of the error messages. */
+        std::unique_ptr<MappedFile> file; /**< The mapping of the image file, or nullptr. */
+        std::string buffer; /**< The image read from the file that can't be mapped. */
+        const char *base; /**< The beginning of the image. */
+        std::uint64_t size; /**< The size of the image. */
+        std::uint64_t phrase; /**< The offset of the phrase record, or 0 if the instance is empty. */
+        std::vector<DataGsubs> gsubs; /**< The gsubs in the gsub directory. */
+
+        /** The constructor.
+            \param [in] conf The configuration.
+        */
+        explicit Impl(const Config_t &conf);
+
+        /** Attach the instance on an image.
+            \param [in] begin The beginning of the image.
+            \param [in] end The end of the image.
+            \note An error message is added if the image is broken.
+        */
+        void attach(const char *begin, const char *end);
+
+        /** Read a word.
+            \param [in] offset The offset of the word.
+            \return The value.
+        */
+        std::uint64_t read_u64(std::uint64_t offset) const;
+        /** Read a floating point number.
+            \param [in] offset The offset of the word.
+            \return The value.
+        */
+        double read_double(std::uint64_t offset) const;
+        /** Select an item by the cumulative weights, in the same way as select_and_generate().
+            \param [in] num The number of the items. It must be 2 or more.
+            \param [in] weights The offset of the cumulative weights.
+            \param [in] equalized_chance Equalize the chance to select the items.
+            \param [in] rand The random function.
+            \return The index of the selected item.
+        */
+        std::size_t select(std::uint64_t num, std::uint64_t weights, bool equalized_chance, const RandomFunc_t &rand) const;
+
+        /** Generate a text by a rule record.
+            \param [in] offset The offset of the record.
+            \param [in] ext_context The external context that has some nonterminals and the substitutions.
+            \param [in] rand The random function.
+            \return A text.
+        */
+        std::string generate_rule(std::uint64_t offset, const ExtContext_t &ext_context, const RandomFunc_t &rand) const;
+        /** Generate a text by an options record.
+            \param [in] offset The offset of the record.
+            \param [in] ext_context The external context that has some nonterminals and the substitutions.
+            \param [in] rand The random function.
+            \return A text.
+        */
+        std::string generate_options(std::uint64_t offset, const ExtContext_t &ext_context, const RandomFunc_t &rand) const;
+        /** Generate a text by a text record.
+            \param [in] offset The offset of the record.
+            \param [in] ext_context The external context that has some nonterminals and the substitutions.
+            \param [in] rand The random function.
+            \return A text.
+        */
+        std::string generate_text(std::uint64_t offset, const ExtContext_t &ext_context, const RandomFunc_t &rand) const;
+        /** Generate a phrase.
+            \param [in] ext_context The external context that has some nonterminals and the substitutions.
+            \return A phrase.
+        */
+        std::string generate(const ExtContext_t &ext_context) const;
+
+        /** Does a record fit in the image?
+            \param [in] offset The offset of the record.
+            \param [in] words The number of the words in the record.
+            \param [in] limit The record must be placed before limit.
+            \return true if the record is aligned and fits in [header, limit).
+        */
+        bool fits(std::uint64_t offset, std::uint64_t words, std::uint64_t limit) const;
+        /** Check a rule record and the records referred by it.
+            \param [in] offset The offset of the record.
+            \param [in] limit The record must be placed before limit.
+            \param [inout] checked checked[i] is true if the record at i words is checked.
+            \return true if the records are valid.
+        */
+        bool check_rule(std::uint64_t offset, std::uint64_t limit, std::vector<bool> &checked) const;
+        /** Check an options record and the records referred by it.
+            \param [in] offset The offset of the record.
+            \param [in] limit The record must be placed before limit.
+            \param [inout] checked checked[i] is true if the record at i words is checked.
+            \return true if the records are valid.
+        */
+        bool check_options(std::uint64_t offset, std::uint64_t limit, std::vector<bool> &checked) const;
+        /** Check a text record and the records referred by it.
+            \param [in] offset The offset of the record.
+            \param [in] limit The record must be placed before limit.
+            \param [inout] checked checked[i] is true if the record at i words is checked.
+            \return true if the records are valid.
+        */
+        bool check_text(std::uint64_t offset, std::uint64_t limit, std::vector<bool> &checked) const;
+    };
+
+    GeneratorImage::Impl::Impl(const Config_t &conf)
+        : config{conf}, rand{}, err_msg{}, file{}, buffer{}, base{nullptr}, size{0}, phrase{0}, gsubs{}
+    {
+        if (config.random_creator) {
+            rand = config.random_creator();
+        }
+    }
+
+    std::uint64_t GeneratorImage::Impl::read_u64(const std::uint64_t offset) const
+    {
+        std::uint64_t v;
+        std::memcpy(&v, base + offset, sizeof(v));
+        return v;
+    }
+
+    double GeneratorImage::Impl::read_double(const std::uint64_t offset) const
+    {
+        double v;
+        std::memcpy(&v, base + offset, sizeof(v));
+        return v;
+    }
+
+    bool GeneratorImage::Impl::fits(const std::uint64_t offset, const std::uint64_t words, const std::uint64_t limit) const
+    {
+        const std::uint64_t header{sizeof(image::magic) + image::header_words * word};
+        return offset % word == 0
+            && offset >= header
+            && offset < limit
+            && words <= (size - offset) / word;
+    }
+
+    bool GeneratorImage::Impl::check_rule(const std::uint64_t offset, const std::uint64_t limit, std::vector<bool> &checked) const
+    {
+        if (!fits(offset, 2, limit)) {
+            return false;
+        } else if (checked[offset / word]) {
+            return true;
+        }
+        const std::uint64_t g{read_u64(offset + word)};
+        if (g != image::none && g >= gsubs.size()) {
+            return false;
+        }
+        checked[offset / word] = true;
+        return check_options(read_u64(offset), offset, checked);
+    }
+
+    bool GeneratorImage::Impl::check_options(const std::uint64_t offset, const std::uint64_t limit, std::vector<bool> &checked) const
+    {
+        if (!fits(offset, 2, limit)) {
+            return false;
+        }
+        const std::uint64_t num{read_u64(offset + word)};
+        if (num > size / word || !fits(offset, 2 + num * 2, limit)) {
+            return false;
+        }
+        for (std::uint64_t i = 0; i < num; ++i) {
+            if (!check_text(read_u64(offset + (2 + i) * word), offset, checked)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool GeneratorImage::Impl::check_text(const std::uint64_t offset, const std::uint64_t limit, std::vector<bool> &checked) const
+    {
+        if (!fits(offset, 1, limit)) {
+            return false;
+        }
+        const std::uint64_t num{read_u64(offset)};
+        if (num > size / word || !fits(offset, 1 + num * 3, limit)) {
+            return false;
+        }
+        for (std::uint64_t i = 0; i < num; ++i) {
+            const std::uint64_t part{offset + (1 + i * 3) * word};
+            const std::uint64_t kind{read_u64(part)};
+            const std::uint64_t a{read_u64(part + word)};
+            const std::uint64_t b{read_u64(part + word * 2)};
+            if (kind == static_cast<std::uint64_t>(image::PartKind_t::RULE)) {
+                if (!check_rule(a, offset, checked)) {
+                    return false;
+                }
+            } else if (kind == static_cast<std::uint64_t>(image::PartKind_t::STRING)
+                       || kind == static_cast<std::uint64_t>(image::PartKind_t::EXTERNAL)) {
+                if (a > size || b > size - a) {
+                    return false;
+                }
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void GeneratorImage::Impl::attach(const char *begin, const char *end)
+    {
+        base = begin;
+        size = end - begin;
+        const std::uint64_t header{sizeof(image::magic) + image::header_words * word};
+        if (size < header || std::memcmp(base, image::magic, sizeof(image::magic)) != 0) {
+            err_msg.emplace_back("The data is not an image of TPhrase.");
+            size = 0;
+            return;
+        } else if (read_u64(sizeof(image::magic)) != image::version) {
+            err_msg.emplace_back("The version of the image is not supported.");
+            size = 0;
+            return;
+        } else if (read_u64(sizeof(image::magic) + word) != image::byte_order) {
+            err_msg.emplace_back("The byte order of the image is different.");
+            size = 0;
+            return;
+        } else if (read_u64(sizeof(image::magic) + word * 2) != size) {
+            err_msg.emplace_back("The image is truncated.");
+            size = 0;
+            return;
+        }
+
+        // The gsubs are the only objects created in each process.
+        const std::uint64_t directory{read_u64(sizeof(image::magic) + word * 4)};
+        bool good{fits(directory, 1, size)};
+        const std::uint64_t num_gsubs{good ? read_u64(directory) : 0};
+        good = good && num_gsubs <= size / word && fits(directory, 1 + num_gsubs * 2, size);
+        Config_t gsub_config{config};
+        if (!gsub_config.gsub_creator) {
+            gsub_config.gsub_creator = DataGsubs::get_gsub_function_creator();
+        }
+        for (std::uint64_t i = 0; good && i < num_gsubs; ++i) {
+            const std::uint64_t offset{read_u64(directory + (1 + i * 2) * word)};
+            const std::uint64_t len{read_u64(directory + (2 + i * 2) * word)};
+            if (offset > size || len > size - offset) {
+                good = false;
+                break;
+            }
+            MemoryBuffer buf{base + offset, base + offset + len};
+            std::istream is{&buf};
+            SnapshotReader r{is};
+            gsubs.emplace_back();
+            gsubs.back().load(r, gsub_config);
+            if (!r.good()) {
+                err_msg.emplace_back(r.get_error_message());
+                gsubs.clear();
+                size = 0;
+                return;
+            }
+        }
+
+        const std::uint64_t offset{read_u64(sizeof(image::magic) + word * 3)};
+        good = good && fits(offset, 3, directory);
+        const std::uint64_t num{good ? read_u64(offset + word) : 0};
+        good = good && num <= size / word && fits(offset, 3 + num * 2, directory);
+        std::vector<bool> checked(good ? size / word : 0);
+        for (std::uint64_t i = 0; good && i < num; ++i) {
+            good = check_rule(read_u64(offset + (3 + i) * word), offset, checked);
+        }
+        if (good) {
+            phrase = offset;
+        } else {
+            err_msg.emplace_back("The image is broken.");
+            gsubs.clear();
+            size = 0;
+        }
+    }
+
+    std::size_t GeneratorImage::Impl::select(const std::uint64_t num, const std::uint64_t weights,
+                                             const bool equalized_chance, const RandomFunc_t &rand) const
+    {
+        double r{rand()};
+        std::uint64_t i{0};
+        if (equalized_chance) {
+            i = std::floor(r * num);
+        } else {
+            r *= read_double(weights + (num - 1) * word);
+            // std::upper_bound()
+            std::uint64_t lo{0};
+            std::uint64_t hi{num};
+            while (lo < hi) {
+                const std::uint64_t mid{lo + (hi - lo) / 2};
+                if (r < read_double(weights + mid * word)) {
+                    hi = mid;
+                } else {
+                    lo = mid + 1;
+                }
+            }
+            i = lo;
+        }
+        if (i >= num) {
+            i = 0;
+        }
+        return i;
+    }
+
+    std::string GeneratorImage::Impl::generate_rule(const std::uint64_t offset, const ExtContext_t &ext_context, const RandomFunc_t &rand) const
+    {
+        std::string s{generate_options(read_u64(offset), ext_context, rand)};
+        const std::uint64_t g{read_u64(offset + word)};
+        if (g != image::none) {
+            return gsubs[g].gsub(std::move(s));
+        }
+        return s;
+    }
+
+    std::string GeneratorImage::Impl::generate_options(const std::uint64_t offset, const ExtContext_t &ext_context, const RandomFunc_t &rand) const
+    {
+        const bool equalized_chance{read_u64(offset) != 0};
+        const std::uint64_t num{read_u64(offset + word)};
+        const std::uint64_t texts{offset + word * 2};
+        if (num == 0) {
+            return "nil";
+        } else if (num == 1) {
+            return generate_text(read_u64(texts), ext_context, rand);
+        }
+        const std::size_t i{select(num, texts + num * word, equalized_chance, rand)};
+        return generate_text(read_u64(texts + i * word), ext_context, rand);
+    }
+
+    std::string GeneratorImage::Impl::generate_text(const std::uint64_t offset, const ExtContext_t &ext_context, const RandomFunc_t &rand) const
+    {
+        std::string s;
+        const std::uint64_t num{read_u64(offset)};
+        for (std::uint64_t i = 0; i < num; ++i) {
+            const std::uint64_t part{offset + (1 + i * 3) * word};
+            const std::uint64_t kind{read_u64(part)};
+            const std::uint64_t a{read_u64(part + word)};
+            if (kind == static_cast<std::uint64_t>(image::PartKind_t::STRING)) {
+                s.append(base + a, read_u64(part + word * 2));
+            } else if (kind == static_cast<std::uint64_t>(image::PartKind_t::RULE)) {
+                s += generate_rule(a, ext_context, rand);
+            } else {
+                const std::string name{base + a, read_u64(part + word * 2)};
+                const auto it = ext_context.find(name);
+                if (it != ext_context.end()) {
+                    s += it->second;
+                } else {
+                    s += name;
+                }
+            }
+        }
+        return s;
+    }
+
+    std::string GeneratorImage::Impl::generate(const ExtContext_t &ext_context) const
+    {
+        if (phrase == 0) {
+            return "nil";
+        }
+        const RandomFunc_t &r{rand ? rand : random};
+        const bool equalized_chance{read_u64(phrase) != 0};
+        const std::uint64_t num{read_u64(phrase + word)};
+        const std::uint64_t rules{phrase + word * 3};
+        if (num == 0) {
+            return "nil";
+        } else if (num == 1) {
+            return generate_rule(read_u64(rules), ext_context, r);
+        }
+        const std::size_t i{select(num, rules + num * word, equalized_chance, r)};
+        return generate_rule(read_u64(rules + i * word), ext_context, r);
+    }
+
+
+    GeneratorImage::GeneratorImage()
+        : pimpl{new Impl{Config_t{}}}
+    {
+    }
+
+    GeneratorImage::GeneratorImage(const char *begin, const char *end, const Config_t &config)
+        : pimpl{new Impl{config}}
+    {
+        pimpl->attach(begin, end);
+    }
+
+    GeneratorImage::GeneratorImage(GeneratorImage &&a)
+        : pimpl{a.pimpl}
+    {
+        a.pimpl = nullptr;
+    }
+
+    GeneratorImage::~GeneratorImage() noexcept
+    {
+        delete pimpl;
+    }
+
+    GeneratorImage &GeneratorImage::operator=(GeneratorImage &&a)
+    {
+        delete pimpl;
+        pimpl = a.pimpl;
+        a.pimpl = nullptr;
+
+        return *this;
+    }
+
+    GeneratorImage GeneratorImage::from_file(const std::string &path, const Config_t &config)
+    {
+        GeneratorImage a;
+        Impl &impl{*a.pimpl};
+        impl = Impl{config};
+        std::unique_ptr<MappedFile> file{new MappedFile{path}};
+        if (file->is_mapped()) {
+            impl.file = std::move(file);
+            impl.attach(impl.file->begin(), impl.file->end());
+        } else {
+            std::ifstream s{path, std::ios_base::binary};
+            if (s) {
+                impl.buffer.assign(std::istreambuf_iterator<char>{s}, std::istreambuf_iterator<char>{});
+                impl.attach(impl.buffer.data(), impl.buffer.data() + impl.buffer.size());
+            } else {
+                impl.err_msg.emplace_back("The file can't be opened.");
+            }
+        }
+        for (auto &msg : impl.err_msg) {
+            msg = path + ": " + msg;
+        }
+        return a;
+    }
+
+    std::string GeneratorImage::generate() const
+    {
+        return pimpl->generate(empty_context);
+    }
+
+    std::string GeneratorImage::generate(const ExtContext_t &ext_context) const
+    {
+        return pimpl->generate(ext_context);
+    }
+
+    const std::vector<std::string> &GeneratorImage::get_error_message() const
+    {
+        return pimpl->err_msg;
+    }
+
+    std::size_t GeneratorImage::get_number_of_syntax() const
+    {
+        return pimpl->phrase == 0 ? 0 : pimpl->read_u64(pimpl->phrase + word);
+    }
+
+    double GeneratorImage::get_weight() const
+    {
+        const std::size_t num{get_number_of_syntax()};
+        return num == 0 ? 0.0 : pimpl->read_double(pimpl->phrase + word * (3 + num * 2 - 1));
+    }
+
+    std::size_t GeneratorImage::get_combination_number() const
+    {
+        return pimpl->phrase == 0 ? 0 : pimpl->read_u64(pimpl->phrase + word * 2);
+    }
+}
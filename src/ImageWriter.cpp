@@ -0,0 +1,124 @@
+/** The writer of the flat image of a generator.
+    \file ImageWriter.cpp
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "ImageWriter.h"
+
+namespace tphrase {
+
+    ImageWriter::ImageWriter()
+        : buf(image::header_words * sizeof(std::uint64_t) + sizeof(image::magic), '\0'), rules{}, gsubs{}
+    {
+    }
+
+    bool ImageWriter::find_rule(const DataProductionRule *rule, std::uint64_t &offset) const
+    {
+        const auto it{rules.find(rule)};
+        if (it == rules.end()) {
+            return false;
+        }
+        offset = it->second;
+        return true;
+    }
+
+    void ImageWriter::add_rule(const DataProductionRule *rule, const std::uint64_t offset)
+    {
+        rules.emplace(rule, offset);
+    }
+
+    std::uint64_t ImageWriter::add_gsubs(const std::string &data)
+    {
+        gsubs.emplace_back(add_string(data), data.size());
+        return gsubs.size() - 1;
+    }
+
+    std::uint64_t ImageWriter::add_string(const std::string &s)
+    {
+        const std::uint64_t offset{buf.size()};
+        buf += s;
+        return offset;
+    }
+
+    void ImageWriter::align()
+    {
+        buf.resize((buf.size() + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t) * sizeof(std::uint64_t), '\0');
+    }
+
+    std::uint64_t ImageWriter::begin_record()
+    {
+        align();
+        return buf.size();
+    }
+
+    void ImageWriter::write_u64(const std::uint64_t v)
+    {
+        char word[sizeof(v)];
+        std::memcpy(word, &v, sizeof(v));
+        buf.append(word, sizeof(word));
+    }
+
+    void ImageWriter::write_double(const double v)
+    {
+        static_assert(sizeof(double) == sizeof(std::uint64_t), "double must be 64 bits.");
+        std::uint64_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        write_u64(bits);
+    }
+
+    std::string ImageWriter::finish(const std::uint64_t phrase)
+    {
+        const std::uint64_t directory{begin_record()};
+        write_u64(gsubs.size());
+        for (const auto &g : gsubs) {
+            write_u64(g.first);
+            write_u64(g.second);
+        }
+
+        const std::uint64_t header[image::header_words] = {
+            image::version, image::byte_order, buf.size(), phrase, directory
+        };
+        std::memcpy(&buf[0], image::magic, sizeof(image::magic));
+        std::memcpy(&buf[sizeof(image::magic)], header, sizeof(header));
+        std::string image;
+        image.swap(buf);
+        return image;
+    }
+}
@@ -0,0 +1,141 @@
+/** The writer of the flat image of a generator.
+    \file ImageWriter.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_SRC_IMAGEWRITER_H_
+#define TPHRASE_SRC_IMAGEWRITER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace tphrase {
+    class DataProductionRule;
+
+    /** The layout of the flat image of a generator.
+
+        The image consists of the records of the 64-bit words in the native byte order. A record refers to another record by the offset from the beginning of the image, and the referred record is always placed before the referring record, so the image has no cycles and can be mapped at any address.
+
+        - Header: magic (8 bytes), version, byte order mark, size of the image, offset of the phrase record, offset of the gsub directory.
+        - Phrase: equalized chance, number of the syntaxes n, number of the combination, the offsets of the start rules [n], the cumulative weights [n].
+        - Rule: offset of the options record, index of the gsubs in the gsub directory or NONE.
+        - Options: equalized chance, number of the texts n, the offsets of the text records [n], the cumulative weights [n].
+        - Text: number of the parts n, the parts [n] that consist of the kind and two words: STRING (offset and length of the bytes), RULE (offset of the rule record), EXTERNAL (offset and length of the name of the expansion).
+        - Gsub directory: number of the gsubs n, the pairs of the offset and the length of the gsubs in the snapshot format [n].
+    */
+    namespace image {
+        /** The magic number at the beginning of the image. */
+        constexpr char magic[8] = {'T', 'P', 'h', 'r', 'I', 'm', 'g', '\0'};
+        /** The version of the image format. It must be changed if the format is changed. */
+        constexpr std::uint64_t version{1};
+        /** The byte order mark. */
+        constexpr std::uint64_t byte_order{0x0102030405060708};
+        /** The number of the words in the header. */
+        constexpr std::size_t header_words{5};
+        /** The value meaning no gsubs. */
+        constexpr std::uint64_t none{~static_cast<std::uint64_t>(0)};
+
+        /** The kind of a part of a text. */
+        enum class PartKind_t : std::uint64_t {
+            STRING, /**< A string. */
+            RULE, /**< An anonymous rule or a bound expansion. */
+            EXTERNAL, /**< An expansion substituted by the external context. */
+        };
+    }
+
+    /** The writer of the flat image of a generator. */
+    class ImageWriter {
+    public:
+        /** The default constructor. */
+        ImageWriter();
+        ImageWriter(const ImageWriter &a) = delete;
+        ImageWriter &operator=(const ImageWriter &a) = delete;
+
+        /** Find the record of a production rule written already.
+            \param [in] rule The production rule.
+            \param [out] offset The offset of the record.
+            \return true if the record is found.
+        */
+        bool find_rule(const DataProductionRule *rule, std::uint64_t &offset) const;
+        /** Register the record of a production rule, so it's shared by the expansions.
+            \param [in] rule The production rule.
+            \param [in] offset The offset of the record.
+        */
+        void add_rule(const DataProductionRule *rule, std::uint64_t offset);
+        /** Add the gsubs into the gsub directory.
+            \param [in] data The gsubs in the snapshot format.
+            \return The index in the gsub directory.
+        */
+        std::uint64_t add_gsubs(const std::string &data);
+        /** Add a string.
+            \param [in] s The string.
+            \return The offset of the string.
+        */
+        std::uint64_t add_string(const std::string &s);
+
+        /** Begin a record.
+            \return The offset of the record.
+        */
+        std::uint64_t begin_record();
+        /** Write a word into the current record.
+            \param [in] v The value.
+        */
+        void write_u64(std::uint64_t v);
+        /** Write a floating point number into the current record.
+            \param [in] v The value.
+        */
+        void write_double(double v);
+
+        /** Finish the image.
+            \param [in] phrase The offset of the phrase record.
+            \return The image.
+        */
+        std::string finish(std::uint64_t phrase);
+
+    private:
+        /** Pad the buffer to the word boundary. */
+        void align();
+
+        std::string buf; /**< The image being written. */
+        std::unordered_map<const DataProductionRule *, std::uint64_t> rules; /**< The offsets of the records of the production rules. */
+        std::vector<std::pair<std::uint64_t, std::uint64_t>> gsubs; /**< The offsets and the lengths of the gsubs. */
+    };
+}
+
+#endif // TPHRASE_SRC_IMAGEWRITER_H_
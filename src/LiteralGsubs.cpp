@@ -0,0 +1,248 @@
+/** The data structure representing the literal gsubs fused into a single pass.
+    \file LiteralGsubs.cpp
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "LiteralGsubs.h"
+#include "heap_size.h"
+
+namespace {
+    /** Does a nonempty proper suffix of a string equal a proper prefix of another?
+        \param [in] a The string whose suffix is tested.
+        \param [in] b The string whose prefix is tested.
+        \return true if the end of a can overlap the beginning of b.
+        \note The case that a string contains the other is not an overlap in this function.
+    */
+    bool has_overlap(const std::string &a, const std::string &b)
+    {
+        const std::size_t len{std::min(a.size(), b.size())};
+        for (std::size_t k = 1; k < len; ++k) {
+            if (a.compare(a.size() - k, k, b, 0, k) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** Is a string a proper substring of another?
+        \param [in] a The string that may be contained.
+        \param [in] b The string that may contain a.
+        \return true if b contains a and a is shorter than b.
+    */
+    bool is_proper_substring(const std::string &a, const std::string &b)
+    {
+        return a.size() < b.size() && b.find(a) != std::string::npos;
+    }
+}
+
+namespace tphrase {
+    constexpr LiteralGsubs::State_t LiteralGsubs::NONE;
+
+    LiteralGsubs::LiteralGsubs(const std::string &pattern, const std::string &repl, const bool in_global)
+        : patterns{pattern},
+          repls{repl},
+          global{in_global},
+          byte_class{},
+          num_classes{0},
+          transitions{},
+          depths{},
+          outputs{},
+          dict_links{}
+    {
+        build();
+    }
+
+    std::string LiteralGsubs::gsub(const std::string &s) const
+    {
+        std::string r;
+        std::size_t emitted{0}; // s[0 .. emitted) has been emitted or substituted.
+        std::size_t pending_start{0};
+        std::size_t pending_len{0};
+        State_t pending{NONE}; // The leftmost-longest match that is not substituted yet.
+        State_t state{0};
+        std::size_t i{0};
+        for (;;) {
+            const bool is_end{i == s.size()};
+            if (!is_end) {
+                state = transitions[state * num_classes + byte_class[static_cast<unsigned char>(s[i])]];
+            }
+            const std::size_t end{i + 1};
+            if (pending != NONE && (is_end || end - depths[state] > pending_start)) {
+                // No match that starts at or before pending_start can be found after here.
+                r.append(s, emitted, pending_start - emitted);
+                r += repls[pending];
+                emitted = pending_start + pending_len;
+                pending = NONE;
+                if (!global) {
+                    break;
+                }
+                // Restart just after the substituted part, because a match that was shadowed by the pending match may follow it.
+                state = 0;
+                i = emitted;
+                continue;
+            }
+            if (is_end) {
+                break;
+            }
+            // The longest match that ends here.
+            const State_t t{outputs[state] != NONE ? state : dict_links[state]};
+            if (t != NONE) {
+                const std::size_t start{end - depths[t]};
+                if (pending == NONE
+                    || start < pending_start
+                    || (start == pending_start && depths[t] > pending_len)) {
+                    pending = outputs[t];
+                    pending_start = start;
+                    pending_len = depths[t];
+                }
+            }
+            ++i;
+        }
+        r.append(s, emitted, std::string::npos);
+        return r;
+    }
+
+    bool LiteralGsubs::can_fuse(const std::string &pattern, const bool in_global) const
+    {
+        // The sequential gsubs replace the former patterns in advance, and the single pass replaces the leftmost-longest pattern. They make the same result if no match of the latter pattern interferes with the former gsubs. (The replacement of the latter gsub is never scanned in either way.)
+        if (!global || !in_global) {
+            return false;
+        }
+        for (std::size_t i = 0; i < patterns.size(); ++i) {
+            const std::string &former{patterns[i]};
+            const std::string &former_repl{repls[i]};
+            // The former match inside the latter pattern would be replaced in advance.
+            if (is_proper_substring(former, pattern)) {
+                return false;
+            }
+            // The latter match overlapping the beginning of the former match would be chosen by the single pass.
+            if (has_overlap(pattern, former)) {
+                return false;
+            }
+            // The former replacement might make a new match of the latter pattern.
+            if (former_repl.empty()) {
+                if (pattern.size() > 1) {
+                    return false;
+                }
+            } else if (former_repl.find(pattern) != std::string::npos
+                       || pattern.find(former_repl) != std::string::npos
+                       || has_overlap(former_repl, pattern)
+                       || has_overlap(pattern, former_repl)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void LiteralGsubs::fuse(const std::string &pattern, const std::string &repl)
+    {
+        patterns.emplace_back(pattern);
+        repls.emplace_back(repl);
+        build();
+    }
+
+    void LiteralGsubs::build()
+    {
+        // Equivalence classes of the bytes: the bytes not in the patterns share the class 0.
+        std::fill(std::begin(byte_class), std::end(byte_class), 0);
+        num_classes = 1;
+        for (const auto &pat : patterns) {
+            for (const char c : pat) {
+                unsigned char &cls{byte_class[static_cast<unsigned char>(c)]};
+                if (cls == 0) {
+                    cls = static_cast<unsigned char>(num_classes);
+                    ++num_classes;
+                }
+            }
+        }
+
+        // Trie
+        transitions.assign(num_classes, NONE);
+        depths.assign(1, 0);
+        outputs.assign(1, NONE);
+        for (std::size_t i = 0; i < patterns.size(); ++i) {
+            State_t s{0};
+            for (const char c : patterns[i]) {
+                const std::size_t idx{s * num_classes + byte_class[static_cast<unsigned char>(c)]};
+                if (transitions[idx] == NONE) {
+                    const State_t t{static_cast<State_t>(depths.size())};
+                    transitions[idx] = t;
+                    transitions.resize(transitions.size() + num_classes, NONE);
+                    depths.emplace_back(depths[s] + 1);
+                    outputs.emplace_back(NONE);
+                }
+                s = transitions[idx];
+            }
+            if (outputs[s] == NONE) {
+                // The former gsub has the priority over the same pattern.
+                outputs[s] = static_cast<State_t>(i);
+            }
+        }
+
+        // Failure links folded into the transitions in the breadth first order.
+        const std::size_t num_states{depths.size()};
+        std::vector<State_t> fails(num_states, 0);
+        dict_links.assign(num_states, NONE);
+        std::vector<State_t> queue;
+        queue.reserve(num_states);
+        queue.emplace_back(0);
+        for (std::size_t qi = 0; qi < queue.size(); ++qi) {
+            const State_t s{queue[qi]};
+            for (std::size_t c = 0; c < num_classes; ++c) {
+                State_t &t{transitions[s * num_classes + c]};
+                const State_t fail_next{s == 0 ? 0 : transitions[fails[s] * num_classes + c]};
+                if (t == NONE) {
+                    t = fail_next;
+                } else {
+                    fails[t] = fail_next;
+                    dict_links[t] = outputs[fail_next] != NONE ? fail_next : dict_links[fail_next];
+                    queue.emplace_back(t);
+                }
+            }
+        }
+    }
+
+    std::size_t LiteralGsubs::get_heap_size() const
+    {
+        return tphrase::get_heap_size(patterns) + tphrase::get_heap_size(repls)
+            + (transitions.capacity() + outputs.capacity() + dict_links.capacity()) * sizeof(State_t)
+            + depths.capacity() * sizeof(std::size_t);
+    }
+}
@@ -0,0 +1,156 @@
+/** The data structure representing the literal gsubs fused into a single pass.
+    \file LiteralGsubs.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_SRC_LITERALGSUBS_H_
+#define TPHRASE_SRC_LITERALGSUBS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace tphrase {
+    /** The data structure representing the literal gsubs fused into a single pass.
+
+        The sequential literal gsubs are substituted by a single leftmost-longest scan with an Aho-Corasick automaton, only if the result is provably equivalent to the sequential substitutions.
+    */
+    class LiteralGsubs {
+    public:
+        LiteralGsubs() = delete;
+        /** The constructor.
+            \param [in] pattern The literal string to be substituted.
+            \param [in] repl The literal string to substitute.
+            \param [in] global The global parameter of gsub.
+        */
+        LiteralGsubs(const std::string &pattern, const std::string &repl, bool global);
+        /** The copy constructor.
+            \param [in] a The source.
+        */
+        LiteralGsubs(const LiteralGsubs &a) = default;
+        /** The move constructor.
+            \param [inout] a The source. (moved)
+        */
+        LiteralGsubs(LiteralGsubs &&a) = default;
+
+        /** The assignment.
+            \param [in] a The source.
+            \return *this
+        */
+        LiteralGsubs &operator=(const LiteralGsubs &a) = default;
+        /** The move assignment.
+            \param [inout] a The source. (moved)
+            \return *this
+        */
+        LiteralGsubs &operator=(LiteralGsubs &&a) = default;
+
+        /** Substitute a string.
+            \param [in] s The source string.
+            \return Substituted string.
+        */
+        std::string gsub(const std::string &s) const;
+
+        /** Can a literal gsub be fused after the gsubs in this instance?
+            \param [in] pattern The literal string to be substituted.
+            \param [in] global The global parameter of gsub.
+            \return true if the single pass substitution is equivalent to the sequential substitutions.
+        */
+        bool can_fuse(const std::string &pattern, bool global) const;
+        /** Fuse a literal gsub after the gsubs in this instance.
+            \param [in] pattern The literal string to be substituted.
+            \param [in] repl The literal string to substitute.
+            \note can_fuse(pattern, true) must be true.
+        */
+        void fuse(const std::string &pattern, const std::string &repl);
+
+        /** Get the literal strings to be substituted.
+            \return The literal strings to be substituted, in the order of the gsubs.
+        */
+        const std::vector<std::string> &get_patterns() const;
+        /** Get the literal strings to substitute.
+            \return The literal strings to substitute, in the order of the gsubs.
+        */
+        const std::vector<std::string> &get_replacements() const;
+        /** Get the global parameter of gsub.
+            \return The global parameter of gsub.
+        */
+        bool is_global() const;
+        /** Get the number of the bytes allocated by the instance.
+            \return The estimated number of the bytes, excluding the instance itself.
+        */
+        std::size_t get_heap_size() const;
+
+    private:
+        /** Build the automaton out of the parameters. */
+        void build();
+
+        /** The type of the state of the automaton. */
+        using State_t = std::uint32_t;
+        /** The value meaning no state or no pattern. */
+        static constexpr State_t NONE = static_cast<State_t>(-1);
+
+        std::vector<std::string> patterns; /**< The literal strings to be substituted, in the order of the gsubs. */
+        std::vector<std::string> repls; /**< The literal strings to substitute, in the order of the gsubs. */
+        bool global; /**< The global parameter of gsub. */
+
+        unsigned char byte_class[256]; /**< The equivalence class of each byte in the automaton. */
+        std::size_t num_classes; /**< The number of the equivalence classes. */
+        std::vector<State_t> transitions; /**< transitions[s * num_classes + c] is the next state from s by a byte in the class c. */
+        std::vector<std::size_t> depths; /**< depths[s] is the length of the string that the state s represents. */
+        std::vector<State_t> outputs; /**< outputs[s] is the index of the pattern that the state s represents, or NONE. */
+        std::vector<State_t> dict_links; /**< dict_links[s] is the longest proper suffix state of s that represents a pattern, or NONE. */
+    };
+
+    inline
+    const std::vector<std::string> &LiteralGsubs::get_patterns() const
+    {
+        return patterns;
+    }
+
+    inline
+    const std::vector<std::string> &LiteralGsubs::get_replacements() const
+    {
+        return repls;
+    }
+
+    inline
+    bool LiteralGsubs::is_global() const
+    {
+        return global;
+    }
+}
+
+#endif // TPHRASE_SRC_LITERALGSUBS_H_
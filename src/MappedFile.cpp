@@ -0,0 +1,91 @@
+/** The read-only memory mapping of a source file.
+    \file MappedFile.cpp
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#include <cstddef>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define TPHRASE_HAS_MMAP 1
+#endif
+
+#include "MappedFile.h"
+
+namespace tphrase {
+    MappedFile::MappedFile(const std::string &path)
+        : addr{nullptr}, size{0}, mapped{false}
+    {
+#ifdef TPHRASE_HAS_MMAP
+        const int fd{::open(path.c_str(), O_RDONLY)};
+        if (fd < 0) {
+            return;
+        }
+        struct stat st;
+        if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+            if (st.st_size == 0) {
+                mapped = true;
+            } else {
+                void *p{::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0)};
+                if (p != MAP_FAILED) {
+#ifdef POSIX_MADV_SEQUENTIAL
+                    ::posix_madvise(p, static_cast<std::size_t>(st.st_size), POSIX_MADV_SEQUENTIAL);
+#endif
+                    addr = static_cast<const char *>(p);
+                    size = static_cast<std::size_t>(st.st_size);
+                    mapped = true;
+                }
+            }
+        }
+        // The mapping is available after closing the file descriptor.
+        ::close(fd);
+#else
+        static_cast<void>(path);
+#endif
+    }
+
+    MappedFile::~MappedFile() noexcept
+    {
+#ifdef TPHRASE_HAS_MMAP
+        if (addr) {
+            ::munmap(const_cast<char *>(addr), size);
+        }
+#endif
+    }
+}
@@ -0,0 +1,102 @@
+/** The read-only memory mapping of a source file.
+    \file MappedFile.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_SRC_MAPPEDFILE_H_
+#define TPHRASE_SRC_MAPPEDFILE_H_
+
+#include <cstddef>
+#include <string>
+
+namespace tphrase {
+    /** The read-only memory mapping of a source file.
+
+        The file is mapped on the construction and unmapped on the destruction.
+
+        \note The mapping is available only if the file is a regular file and the platform supports mmap(). Otherwise, is_mapped() returns false and the caller should read the file as a stream.
+    */
+    class MappedFile {
+    public:
+        MappedFile() = delete;
+        /** The constructor.
+            \param [in] path The path of the file.
+        */
+        explicit MappedFile(const std::string &path);
+        MappedFile(const MappedFile &a) = delete;
+        MappedFile &operator=(const MappedFile &a) = delete;
+        /** The destructor. */
+        ~MappedFile() noexcept;
+
+        /** Is the file mapped?
+            \return true if the file is mapped.
+            \note An empty regular file is handled as mapped, whose begin() equals end().
+        */
+        bool is_mapped() const;
+        /** Get the beginning of the file contents.
+            \return The pointer to the beginning.
+        */
+        const char *begin() const;
+        /** Get the end of the file contents.
+            \return The pointer to the end.
+        */
+        const char *end() const;
+
+    private:
+        const char *addr; /**< The address of the mapping, or nullptr. */
+        std::size_t size; /**< The size of the mapping. */
+        bool mapped; /**< Is the file mapped? */
+    };
+
+    inline
+    bool MappedFile::is_mapped() const
+    {
+        return mapped;
+    }
+
+    inline
+    const char *MappedFile::begin() const
+    {
+        return addr;
+    }
+
+    inline
+    const char *MappedFile::end() const
+    {
+        return addr + size;
+    }
+}
+
+#endif // TPHRASE_SRC_MAPPEDFILE_H_
@@ -0,0 +1,129 @@
+/** The interned name of a nonterminal.
+    \file Symbol.cpp
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+#include "Symbol.h"
+
+namespace {
+    /** The number of the shards of the symbol table. */
+    constexpr std::size_t num_shards{16};
+    /** The number of the buckets of a shard that aren't shrunk. */
+    constexpr std::size_t min_buckets{64};
+
+    /** A shard of the symbol table.
+        \note The elements of std::unordered_map are not moved by the insertion, so the symbols can refer them without the lock.
+    */
+    template <typename Info>
+    struct Shard_t {
+        std::mutex mutex; /**< The mutex for the table. */
+        std::unordered_map<std::string, Info> table; /**< The table that maps the names to the information of the entries. */
+    };
+
+    /** Get the shard of the symbol table.
+        \param [in] hash The hash value of the name by std::hash.
+        \return The shard that has the name.
+        \note The shards are never destroyed, so the symbols in the static objects can be released at the exit.
+    */
+    template <typename Info>
+    Shard_t<Info> &get_shard(std::size_t hash)
+    {
+        static auto *shards = new Shard_t<Info>[num_shards];
+        // The low bits are used by the buckets of the tables, so the shard is selected by the high bits.
+        return shards[(hash >> (sizeof(std::size_t) * 8 - 4)) % num_shards];
+    }
+
+    /** The ID of the next entry. */
+    std::atomic<std::uint64_t> next_id{1};
+
+    /** The empty name. */
+    const std::string empty_name;
+}
+
+namespace tphrase {
+    Symbol::Symbol(const std::string &name)
+        : entry{nullptr}
+    {
+        if (name.empty()) {
+            return;
+        }
+        const std::size_t hash{std::hash<std::string>{}(name)};
+        auto &shard = get_shard<Info_t>(hash);
+        std::lock_guard<std::mutex> lock{shard.mutex};
+        auto it = shard.table.find(name);
+        if (it == shard.table.end()) {
+            it = shard.table.emplace(std::piecewise_construct, std::forward_as_tuple(name), std::forward_as_tuple(next_id.fetch_add(1, std::memory_order_relaxed))).first;
+        }
+        it->second.refs.fetch_add(1, std::memory_order_relaxed);
+        entry = &*it;
+    }
+
+    const std::string &Symbol::str() const
+    {
+        return entry ? entry->first : empty_name;
+    }
+
+    void Symbol::release() noexcept
+    {
+        std::atomic<std::size_t> &refs{entry->second.refs};
+        std::size_t n{refs.load(std::memory_order_relaxed)};
+        while (n > 1) {
+            if (refs.compare_exchange_weak(n, n - 1, std::memory_order_release, std::memory_order_relaxed)) {
+                entry = nullptr;
+                return;
+            }
+        }
+        // The last reference is released with the lock, because another thread can find the entry in the table at the same time.
+        auto &shard = get_shard<Info_t>(std::hash<std::string>{}(entry->first));
+        std::lock_guard<std::mutex> lock{shard.mutex};
+        if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            shard.table.erase(shard.table.find(entry->first));
+            // The buckets are shrunk as well, so the table doesn't keep the memory for the names released.
+            if (shard.table.bucket_count() > min_buckets && shard.table.size() * 8 < shard.table.bucket_count()) {
+                shard.table.rehash(shard.table.size() * 2);
+            }
+        }
+        entry = nullptr;
+    }
+}
@@ -0,0 +1,211 @@
+/** The interned name of a nonterminal.
+    \file Symbol.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_SRC_SYMBOL_H_
+#define TPHRASE_SRC_SYMBOL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace tphrase {
+    /** The interned name of a nonterminal.
+
+        The equal names are interned into the same entry of the process-wide symbol table, so the symbols are compared and hashed by the entry and its integer ID instead of the name.
+
+        \note The entry is counted by the references from the symbols, and it's released when the last symbol referring to it is destroyed.
+        \note The symbols can be created in multiple threads at the same time. The table is divided into the shards locked separately, and copying a symbol doesn't lock any of them.
+    */
+    class Symbol {
+    public:
+        /** The default constructor to create the empty name. */
+        Symbol();
+        /** The constructor to intern a name.
+            \param [in] name The name.
+        */
+        explicit Symbol(const std::string &name);
+        /** The copy constructor.
+            \param [in] a The source.
+        */
+        Symbol(const Symbol &a);
+        /** The move constructor.
+            \param [inout] a The source, which becomes the empty name. (moved)
+        */
+        Symbol(Symbol &&a) noexcept;
+        /** The destructor. */
+        ~Symbol() noexcept;
+
+        /** The assignment.
+            \param [in] a The source.
+            \return *this
+        */
+        Symbol &operator=(const Symbol &a);
+        /** The move assignment.
+            \param [inout] a The source. (moved)
+            \return *this
+        */
+        Symbol &operator=(Symbol &&a) noexcept;
+
+        /** Get the name.
+            \return The name.
+        */
+        const std::string &str() const;
+        /** Get the ID.
+            \return The ID, which is 0 for the empty name, and increasing for the other names in the order of interning.
+            \note The ID of a released entry isn't reused, so the name interned again has a new ID.
+        */
+        std::uint64_t get_id() const;
+
+        /** Compare the symbols.
+            \param [in] a The other symbol.
+            \return true if the names are equal.
+        */
+        bool operator==(const Symbol &a) const;
+        /** Compare the symbols.
+            \param [in] a The other symbol.
+            \return true if the names are different.
+        */
+        bool operator!=(const Symbol &a) const;
+
+        /** The hash function of the symbols for std::unordered_map. */
+        struct Hash {
+            /** Calculate the hash.
+                \param [in] a The symbol.
+                \return The hash value.
+            */
+            std::size_t operator()(const Symbol &a) const;
+        };
+
+    private:
+        /** The information of the entry of the symbol table. */
+        struct Info_t {
+            std::uint64_t id; /**< The ID of the entry. */
+            std::atomic<std::size_t> refs; /**< The number of the symbols referring to the entry. */
+
+            /** The constructor.
+                \param [in] i The ID of the entry.
+            */
+            explicit Info_t(std::uint64_t i)
+                : id{i}, refs{0}
+            {
+            }
+        };
+        /** The type of the entry of the symbol table. */
+        using Entry_t = std::pair<const std::string, Info_t>;
+
+        /** Release the reference to the entry.
+            \note The entry is removed from the table if it's the last reference.
+        */
+        void release() noexcept;
+
+        Entry_t *entry; /**< The entry of the symbol table, or nullptr for the empty name. */
+    };
+
+    inline
+    Symbol::Symbol()
+        : entry{nullptr}
+    {
+    }
+
+    inline
+    Symbol::Symbol(const Symbol &a)
+        : entry{a.entry}
+    {
+        if (entry) {
+            // The entry is alive while the source refers to it, so it's counted without the lock.
+            entry->second.refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    inline
+    Symbol::Symbol(Symbol &&a) noexcept
+        : entry{a.entry}
+    {
+        a.entry = nullptr;
+    }
+
+    inline
+    Symbol::~Symbol() noexcept
+    {
+        if (entry) {
+            release();
+        }
+    }
+
+    inline
+    Symbol &Symbol::operator=(const Symbol &a)
+    {
+        Symbol copy{a};
+        std::swap(entry, copy.entry);
+        return *this;
+    }
+
+    inline
+    Symbol &Symbol::operator=(Symbol &&a) noexcept
+    {
+        std::swap(entry, a.entry);
+        return *this;
+    }
+
+    inline
+    std::uint64_t Symbol::get_id() const
+    {
+        return entry ? entry->second.id : 0;
+    }
+
+    inline
+    bool Symbol::operator==(const Symbol &a) const
+    {
+        return entry == a.entry;
+    }
+
+    inline
+    bool Symbol::operator!=(const Symbol &a) const
+    {
+        return entry != a.entry;
+    }
+
+    inline
+    std::size_t Symbol::Hash::operator()(const Symbol &a) const
+    {
+        return static_cast<std::size_t>(a.get_id());
+    }
+}
+
+#endif // TPHRASE_SRC_SYMBOL_H_
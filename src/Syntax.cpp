@@ -35,33 +35,49 @@
     \endparblock
 */
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <ios>
+#include <iterator>
+#include <memory>
 #include <utility>
 
 #include "tphrase/Generator.h"
+#include "DataGsubs.h"
 #include "DataSyntax.h"
+#include "MappedFile.h"
+#include "heap_size.h"
 #include "parse.h"
+#include "snapshot.h"
+#include "Symbol.h"
 
 namespace tphrase {
 
     /** The type of the private data of the class Syntax. */
     struct Syntax::Impl {
+        Config_t config; /**< The configuration. */
         std::vector<std::string> err_msg; /**< The holder of the error messages. */
-        DataSyntax data; /**< The data structure for the phrase syntax. */
+        std::shared_ptr<DataSyntax> data{std::make_shared<DataSyntax>()}; /**< The data structure for the phrase syntax, which is shared by the copies until it's modified. */
+        std::string source; /**< The source text given by update(), or an empty string if data is modified by others. */
+        std::vector<AssignmentSpan_t> spans; /**< The ranges of the assignments in source. */
+        bool has_source{false}; /**< Is data made from source? */
 
         /** The default constructor. */
         Impl() = default;
-        /** Parse the source text to create the data structure.
-            \param [in] it The source text.
-            \note Some parse errors may be detected if src has errors.
+        /** The constructor to create an empty syntax with a configuration.
+            \param [in] conf The configuration.
         */
-        Impl(InputIteratorBase &it);
+        explicit Impl(const Config_t &conf);
         /** Parse the source text to create the data structure.
             \param [in] it The source text.
+            \param [in] conf The configuration.
             \note Some parse errors may be detected if src has errors.
         */
-        Impl(InputIteratorBase &&it);
+        Impl(InputIteratorBase &it, const Config_t &conf);
         /** The copy constructor.
             \param [in] a The source.
         */
@@ -71,24 +87,183 @@ namespace tphrase {
             \return *this
         */
         Impl &operator=(const Impl &a) = default;
+
+        /** Get the data structure to modify it.
+            \return The data structure, which is copied if it's shared by the copies.
+        */
+        DataSyntax &modify_data();
+
+        /** Get the configuration to parse the source text.
+            \return The configuration whose gsub creator is replaced by the process-wide one if it's empty.
+        */
+        Config_t get_parse_config() const;
+
+        /** Forget the source text because data is modified by something other than update(). */
+        void forget_source();
+        /** Parse the whole source text for update().
+            \param [in] src The source text.
+        */
+        void parse_all(const std::string &src);
+        /** Parse only the changed assignments for update().
+            \param [in] src The source text.
+            \return false if the whole source text needs parsing. The instance isn't modified in this case.
+        */
+        bool parse_changes(const std::string &src);
     };
 
-    Syntax::Impl::Impl(InputIteratorBase &it)
-        : err_msg{}, data{parse(it, err_msg)}
+    Syntax::Impl::Impl(const Config_t &conf)
+        : config{conf}, err_msg{}, data{std::make_shared<DataSyntax>()}, source{}, spans{}
+    {
+    }
+
+    Syntax::Impl::Impl(InputIteratorBase &it, const Config_t &conf)
+        : config{conf}, err_msg{}, data{std::make_shared<DataSyntax>(parse(it, err_msg, get_parse_config()))}, source{}, spans{}
     {
         if (!err_msg.empty()) {
-            data.clear();
+            data->clear();
         }
     }
 
-    Syntax::Impl::Impl(InputIteratorBase &&it)
-        : err_msg{}, data{parse(it, err_msg)}
+    DataSyntax &Syntax::Impl::modify_data()
     {
-        if (!err_msg.empty()) {
-            data.clear();
+        if (data.use_count() > 1) {
+            data = std::make_shared<DataSyntax>(*data);
+        }
+        return *data;
+    }
+
+    Config_t Syntax::Impl::get_parse_config() const
+    {
+        Config_t parse_config{config};
+        if (!parse_config.gsub_creator) {
+            parse_config.gsub_creator = DataGsubs::get_gsub_function_creator();
+        }
+        return parse_config;
+    }
+
+    void Syntax::Impl::forget_source()
+    {
+        source.clear();
+        spans.clear();
+        has_source = false;
+    }
+
+    void Syntax::Impl::parse_all(const std::string &src)
+    {
+        err_msg.clear();
+        spans.clear();
+        const char *begin{src.data()};
+        const char *end{begin + src.size()};
+        InputIterator<const char *, const char *> it{begin, end};
+        const auto libraries = data->get_libraries();
+        data = std::make_shared<DataSyntax>(parse(it, err_msg, get_parse_config(), &spans));
+        for (const auto &library : libraries) {
+            data->link(library);
+        }
+        if (err_msg.empty()) {
+            data->renew_revision();
+            source = src;
+            has_source = true;
+        } else {
+            data->clear();
+            forget_source();
         }
     }
 
+    bool Syntax::Impl::parse_changes(const std::string &src)
+    {
+        // The changed range is [prefix, source.size() - suffix) in source, and [prefix, src.size() - suffix) in src.
+        const std::size_t min_len{std::min(source.size(), src.size())};
+        std::size_t prefix{0};
+        while (prefix < min_len && source[prefix] == src[prefix]) {
+            ++prefix;
+        }
+        std::size_t suffix{0};
+        while (suffix < min_len - prefix
+               && source[source.size() - 1 - suffix] == src[src.size() - 1 - suffix]) {
+            ++suffix;
+        }
+        if (prefix == source.size() && prefix == src.size()) {
+            err_msg.clear();
+            return true;
+        }
+        const std::size_t changed_end{source.size() - suffix};
+
+        // Expand the range to the boundaries of the assignments, where the parser starts in the same state.
+        // The assignments whose end is at prefix or whose beginning is at the end of the change are included because the change may join them. The assignment continued over the end of the range causes a parse error.
+        const std::size_t last_end{spans.empty() ? 0 : spans.back().end};
+        std::size_t first{0};
+        while (first < spans.size() && spans[first].end < prefix) {
+            ++first;
+        }
+        std::size_t last{first};
+        while (last < spans.size() && spans[last].begin <= changed_end) {
+            ++last;
+        }
+        const std::size_t range_begin{first < spans.size() ? spans[first].begin : last_end};
+        std::size_t range_end;
+        if (last < spans.size()) {
+            range_end = spans[last].begin;
+        } else if (changed_end <= last_end) {
+            range_end = last_end;
+        } else {
+            range_end = source.size();
+        }
+        const std::size_t new_range_end{range_end + src.size() - source.size()};
+
+        std::vector<Symbol> removed;
+        for (std::size_t i = first; i < last; ++i) {
+            if (data->is_local_nonterminal(spans[i].nonterminal)) {
+                return false;
+            }
+            removed.emplace_back(spans[i].nonterminal);
+        }
+
+        std::vector<std::string> new_err_msg;
+        std::vector<AssignmentSpan_t> new_spans;
+        const char *begin{src.data() + range_begin};
+        const char *end{src.data() + new_range_end};
+        InputIterator<const char *, const char *> it{begin, end};
+        DataSyntax added{parse(it, new_err_msg, get_parse_config(), &new_spans)};
+        if (!new_err_msg.empty()) {
+            return false;
+        }
+        for (const auto &span : new_spans) {
+            if (data->is_local_nonterminal(span.nonterminal)
+                || (data->has_nonterminal(span.nonterminal)
+                    && std::find(removed.begin(), removed.end(), span.nonterminal) == removed.end())) {
+                return false;
+            }
+        }
+
+        modify_data().replace(removed, std::move(added));
+        err_msg.clear();
+
+        // Splice the spans. The span after the range begins at the end of the last new span, as well as the whole parse.
+        std::vector<AssignmentSpan_t> merged;
+        merged.reserve(first + new_spans.size() + spans.size() - last);
+        for (std::size_t i = 0; i < first; ++i) {
+            merged.emplace_back(std::move(spans[i]));
+        }
+        for (auto &span : new_spans) {
+            span.begin += range_begin;
+            span.end += range_begin;
+            merged.emplace_back(std::move(span));
+        }
+        for (std::size_t i = last; i < spans.size(); ++i) {
+            AssignmentSpan_t span{std::move(spans[i])};
+            span.begin = span.begin + src.size() - source.size();
+            span.end = span.end + src.size() - source.size();
+            merged.emplace_back(std::move(span));
+        }
+        if (last < spans.size()) {
+            const std::size_t next{first + new_spans.size()};
+            merged[next].begin = next > 0 ? merged[next - 1].end : 0;
+        }
+        spans = std::move(merged);
+        source = src;
+        return true;
+    }
 
     Syntax::Syntax()
         : pimpl{new Impl}
@@ -105,6 +280,11 @@ namespace tphrase {
     {
     }
 
+    Syntax::Syntax(const Config_t &config)
+        : pimpl{new Impl{config}}
+    {
+    }
+
     Syntax::Syntax(const Syntax &a)
         : pimpl{new Impl{*a.pimpl}}
     {
@@ -146,7 +326,8 @@ namespace tphrase {
                 pimpl->err_msg.emplace_back(err);
             }
         }
-        pimpl->data.add(DataSyntax(a.pimpl->data), pimpl->err_msg);
+        pimpl->modify_data().add(DataSyntax(*a.pimpl->data), pimpl->err_msg);
+        pimpl->forget_source();
         return good;
     }
 
@@ -159,7 +340,8 @@ namespace tphrase {
                 pimpl->err_msg.emplace_back(std::move(err));
             }
         }
-        pimpl->data.add(std::move(a.pimpl->data), pimpl->err_msg);
+        pimpl->modify_data().add(std::move(a.pimpl->modify_data()), pimpl->err_msg);
+        pimpl->forget_source();
         return good;
     }
 
@@ -173,6 +355,99 @@ namespace tphrase {
         return add(src, src + std::strlen(src));
     }
 
+    bool Syntax::add_file(const std::string &path)
+    {
+        const std::size_t prev_len{pimpl->err_msg.size()};
+        bool good;
+        const MappedFile file{path};
+        if (file.is_mapped()) {
+            good = add(file.begin(), file.end());
+        } else {
+            std::ifstream s{path, std::ios_base::binary};
+            if (s) {
+                good = add(std::istreambuf_iterator<char>{s}, std::istreambuf_iterator<char>{});
+            } else {
+                pimpl->err_msg.emplace_back("The file can't be opened.");
+                good = false;
+            }
+        }
+        for (std::size_t i = prev_len; i < pimpl->err_msg.size(); ++i) {
+            std::string msg{path};
+            msg += ": ";
+            msg += pimpl->err_msg[i];
+            pimpl->err_msg[i] = std::move(msg);
+        }
+        return good;
+    }
+
+    bool Syntax::update(const std::string &src)
+    {
+        if (!pimpl->has_source || !pimpl->parse_changes(src)) {
+            pimpl->parse_all(src);
+        }
+        return pimpl->err_msg.empty();
+    }
+
+    bool Syntax::link(const std::shared_ptr<const SyntaxLibrary> &library)
+    {
+        const auto &library_err = library->get_error_message();
+        if (!library_err.empty()) {
+            for (auto &err : library_err) {
+                pimpl->err_msg.emplace_back(err);
+            }
+            return false;
+        }
+        // The aliasing constructor shares the ownership of the library.
+        pimpl->modify_data().link(std::shared_ptr<const DataSyntax>{library, &library->get_library_data()});
+        return true;
+    }
+
+    bool Syntax::save(std::ostream &os) const
+    {
+        SnapshotWriter w{os};
+        w.write_header(SnapshotKind_t::SYNTAX);
+        pimpl->data->save(w);
+        return w.good();
+    }
+
+    bool Syntax::load(std::istream &is)
+    {
+        SnapshotReader r{is};
+        pimpl->data = std::make_shared<DataSyntax>();
+        if (r.read_header(SnapshotKind_t::SYNTAX)) {
+            pimpl->data->load(r, pimpl->get_parse_config());
+        }
+        pimpl->forget_source();
+        if (!r.good()) {
+            pimpl->err_msg.emplace_back(r.get_error_message());
+        }
+        return r.good();
+    }
+
+    MemoryUsage_t Syntax::memory_usage() const
+    {
+        MemoryCounter counter;
+        counter.usage.assignments += SHARED_OBJECT_OVERHEAD + sizeof(DataSyntax);
+        pimpl->data->count_memory(counter);
+        counter.usage.error_messages += get_heap_size(pimpl->err_msg);
+        counter.usage.others += sizeof(Impl) + get_heap_size(pimpl->source)
+            + pimpl->spans.capacity() * sizeof(AssignmentSpan_t);
+        return counter.get_usage();
+    }
+
+    Syntax Syntax::from_file(const std::string &path, const Config_t &config)
+    {
+        Syntax syntax{config};
+        syntax.add_file(path);
+        return syntax;
+    }
+
+    bool Syntax::parse_each(std::istream &is, const AssignmentSink_t &sink,
+                            std::vector<std::string> &err_msg, const Config_t &config)
+    {
+        return parse_each(std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{}, sink, err_msg, config);
+    }
+
     const std::vector<std::string> &Syntax::get_error_message() const
     {
         return pimpl->err_msg;
@@ -186,34 +461,55 @@ namespace tphrase {
     void Syntax::clear()
     {
         pimpl->err_msg.clear();
-        pimpl->data.clear();
+        pimpl->data = std::make_shared<DataSyntax>();
+        pimpl->forget_source();
+    }
+
+    const Config_t &Syntax::get_config() const
+    {
+        return pimpl->config;
     }
 
 
     Syntax::Syntax(InputIteratorBase &it)
-        : pimpl{new Impl{it}}
+        : pimpl{new Impl{it, Config_t{}}}
     {
     }
 
     bool Syntax::add(InputIteratorBase &it)
     {
         const std::size_t prev_len{pimpl->err_msg.size()};
-        DataSyntax data{parse(it, pimpl->err_msg)};
+        DataSyntax data{parse(it, pimpl->err_msg, pimpl->get_parse_config())};
         const bool good = prev_len == pimpl->err_msg.size();
         if (good) {
-            pimpl->data.add(std::move(data), pimpl->err_msg);
+            pimpl->modify_data().add(std::move(data), pimpl->err_msg);
+            pimpl->forget_source();
         }
         return good;
     }
 
+    bool Syntax::parse_each(InputIteratorBase &it, const AssignmentSink_t &sink,
+                            std::vector<std::string> &err_msg, const Config_t &config)
+    {
+        const std::size_t prev_len{err_msg.size()};
+        const Impl parsing{config};
+        tphrase::parse_each(it, err_msg, parsing.get_parse_config(),
+                            [&](const Symbol &nonterminal, DataSyntax &&assignment, std::string &) {
+                                Syntax a{config};
+                                a.pimpl->data = std::make_shared<DataSyntax>(std::move(assignment));
+                                return sink(nonterminal.str(), std::move(a));
+                            });
+        return prev_len == err_msg.size();
+    }
+
     const DataSyntax &Syntax::get_syntax_data() const
     {
-        return pimpl->data;
+        return *pimpl->data;
     }
 
     DataSyntax &&Syntax::move_syntax_data() &&
     {
-        return std::move(pimpl->data);
+        return std::move(pimpl->modify_data());
     }
 
     std::vector<std::string> &&Syntax::move_error_message() &&
@@ -0,0 +1,92 @@
+/** Phrase Syntax Library
+    \file SyntaxLibrary.cpp
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#include <utility>
+
+#include "tphrase/Generator.h"
+#include "DataSyntax.h"
+
+namespace tphrase {
+
+    /** The type of the private data of the class SyntaxLibrary. */
+    struct SyntaxLibrary::Impl {
+        std::vector<std::string> err_msg; /**< The holder of the error messages. */
+        DataSyntax data; /**< The data structure for the phrase syntax, which is bound as a library. */
+
+        /** The constructor.
+            \param [in] syntax_data The data structure for the phrase syntax. (moved)
+            \param [in] msg The error messages of the source syntax. (moved)
+        */
+        Impl(DataSyntax &&syntax_data, std::vector<std::string> &&msg);
+    };
+
+    SyntaxLibrary::Impl::Impl(DataSyntax &&syntax_data, std::vector<std::string> &&msg)
+        : err_msg{std::move(msg)}, data{std::move(syntax_data)}
+    {
+        if (err_msg.empty()) {
+            data.bind_library(err_msg);
+        }
+        if (!err_msg.empty()) {
+            data.clear();
+        }
+    }
+
+    SyntaxLibrary::SyntaxLibrary(const Syntax &syntax)
+        : pimpl{new Impl{DataSyntax{syntax.get_syntax_data()}, std::vector<std::string>{syntax.get_error_message()}}}
+    {
+    }
+
+    SyntaxLibrary::SyntaxLibrary(Syntax &&syntax)
+        : pimpl{new Impl{std::move(syntax).move_syntax_data(), std::move(syntax).move_error_message()}}
+    {
+    }
+
+    SyntaxLibrary::~SyntaxLibrary() noexcept
+    {
+        delete pimpl;
+    }
+
+    const std::vector<std::string> &SyntaxLibrary::get_error_message() const
+    {
+        return pimpl->err_msg;
+    }
+
+    const DataSyntax &SyntaxLibrary::get_library_data() const
+    {
+        return pimpl->data;
+    }
+}
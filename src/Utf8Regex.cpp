@@ -0,0 +1,1552 @@
+/** The regular expression engine for UTF-8 strings.
+    \file Utf8Regex.cpp
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Utf8Regex.h"
+#include "unicode_category.h"
+#include "utf8.h"
+
+namespace {
+    using tphrase::Utf8Regex;
+    using tphrase::UnicodeCategory_t;
+    using CodeRanges_t = Utf8Regex::CodeRanges_t;
+    using Op_t = Utf8Regex::Op_t;
+    using Assertion_t = Utf8Regex::Assertion_t;
+    using Inst_t = Utf8Regex::Inst_t;
+
+    /** The maximum code point. */
+    constexpr char32_t MAX_CODE_POINT{0x10FFFF};
+    /** The code point meaning the end of the pattern. */
+    constexpr char32_t END_OF_PATTERN{0xFFFFFFFF};
+    /** The value meaning no upper limit of a quantifier. */
+    constexpr std::size_t INFINITE_REPEAT{static_cast<std::size_t>(-1)};
+    /** The upper limit of the number in a quantifier. The greater number makes the program too large anyway. */
+    constexpr std::size_t MAX_REPEAT_NUMBER{1000000};
+    /** The upper limit of the nesting of the groups. */
+    constexpr std::size_t MAX_NESTING{1000};
+    /** The upper limit of the size of the program. */
+    constexpr std::size_t MAX_PROGRAM_SIZE{100000};
+    /** The upper limit of the number of the states in the DFA. */
+    constexpr std::size_t MAX_DFA_STATES{1024};
+    /** The upper limit of the number of the transitions in the DFA. */
+    constexpr std::size_t MAX_DFA_TRANSITIONS{1 << 18};
+    /** The flag of a DFA state, or a transition to the state, meaning a match ends there. */
+    constexpr std::uint32_t ACCEPT{1};
+    /** The flag of a DFA state meaning a match ends there if it's the end of the string. */
+    constexpr std::uint32_t ACCEPT_AT_END{2};
+    /** The flag of a transition meaning all the threads except for the new search died. */
+    constexpr std::uint32_t IDLE{2};
+    /** The number of the bits for the flags of a transition. */
+    constexpr unsigned TRANSITION_FLAG_BITS{2};
+
+    /** Sort and merge the ranges.
+        \param [inout] ranges The ranges.
+    */
+    void normalize(CodeRanges_t &ranges)
+    {
+        std::sort(ranges.begin(), ranges.end());
+        CodeRanges_t r;
+        for (const auto &range : ranges) {
+            if (!r.empty() && range.first <= r.back().second + 1) {
+                r.back().second = std::max(r.back().second, range.second);
+            } else {
+                r.push_back(range);
+            }
+        }
+        ranges = std::move(r);
+    }
+
+    /** Get the complement of the ranges.
+        \param [in] ranges The normalized ranges.
+        \return The complement of ranges.
+    */
+    CodeRanges_t negate(const CodeRanges_t &ranges)
+    {
+        CodeRanges_t r;
+        char32_t next{0};
+        for (const auto &range : ranges) {
+            if (range.first > next) {
+                r.emplace_back(next, range.first - 1);
+            }
+            next = range.second + 1;
+        }
+        if (next <= MAX_CODE_POINT) {
+            r.emplace_back(next, MAX_CODE_POINT);
+        }
+        return r;
+    }
+
+    /** Get the set of the digits "\d".
+        \return The set.
+    */
+    CodeRanges_t digit_set()
+    {
+        return CodeRanges_t{{'0', '9'}};
+    }
+
+    /** Get the set of the word characters "\w".
+        \return The set.
+    */
+    CodeRanges_t word_set()
+    {
+        return CodeRanges_t{{'0', '9'}, {'A', 'Z'}, {'_', '_'}, {'a', 'z'}};
+    }
+
+    /** Get the set of the white spaces and the line terminators "\s".
+        \return The set.
+    */
+    CodeRanges_t space_set()
+    {
+        return CodeRanges_t{
+            {0x0009, 0x000D}, {0x0020, 0x0020}, {0x00A0, 0x00A0}, {0x1680, 0x1680},
+            {0x2000, 0x200A}, {0x2028, 0x2029}, {0x202F, 0x202F}, {0x205F, 0x205F},
+            {0x3000, 0x3000}, {0xFEFF, 0xFEFF},
+        };
+    }
+
+    /** Get the set of the characters except for the line terminators ".".
+        \return The set.
+    */
+    CodeRanges_t any_set()
+    {
+        return negate(CodeRanges_t{{0x000A, 0x000A}, {0x000D, 0x000D}, {0x2028, 0x2029}});
+    }
+
+    /** The bit mask of a general category.
+        \param [in] c The general category.
+        \return The bit mask.
+    */
+    constexpr std::uint32_t category_bit(const UnicodeCategory_t c)
+    {
+        return static_cast<std::uint32_t>(1) << static_cast<unsigned>(c);
+    }
+
+    /** The name of a general category or a group of general categories. */
+    struct CategoryName_t {
+        const char *short_name; /**< The short name. */
+        const char *long_name; /**< The long name. */
+        std::uint32_t mask; /**< The bit mask of the general categories. */
+    };
+
+    constexpr std::uint32_t LETTER_MASK{category_bit(UnicodeCategory_t::LU) | category_bit(UnicodeCategory_t::LL)
+                                        | category_bit(UnicodeCategory_t::LT) | category_bit(UnicodeCategory_t::LM)
+                                        | category_bit(UnicodeCategory_t::LO)};
+    constexpr std::uint32_t MARK_MASK{category_bit(UnicodeCategory_t::MN) | category_bit(UnicodeCategory_t::MC)
+                                      | category_bit(UnicodeCategory_t::ME)};
+    constexpr std::uint32_t NUMBER_MASK{category_bit(UnicodeCategory_t::ND) | category_bit(UnicodeCategory_t::NL)
+                                        | category_bit(UnicodeCategory_t::NO)};
+    constexpr std::uint32_t PUNCTUATION_MASK{category_bit(UnicodeCategory_t::PC) | category_bit(UnicodeCategory_t::PD)
+                                             | category_bit(UnicodeCategory_t::PS) | category_bit(UnicodeCategory_t::PE)
+                                             | category_bit(UnicodeCategory_t::PI) | category_bit(UnicodeCategory_t::PF)
+                                             | category_bit(UnicodeCategory_t::PO)};
+    constexpr std::uint32_t SYMBOL_MASK{category_bit(UnicodeCategory_t::SM) | category_bit(UnicodeCategory_t::SC)
+                                        | category_bit(UnicodeCategory_t::SK) | category_bit(UnicodeCategory_t::SO)};
+    constexpr std::uint32_t SEPARATOR_MASK{category_bit(UnicodeCategory_t::ZS) | category_bit(UnicodeCategory_t::ZL)
+                                           | category_bit(UnicodeCategory_t::ZP)};
+    constexpr std::uint32_t OTHER_MASK{category_bit(UnicodeCategory_t::CC) | category_bit(UnicodeCategory_t::CF)
+                                       | category_bit(UnicodeCategory_t::CS) | category_bit(UnicodeCategory_t::CO)
+                                       | category_bit(UnicodeCategory_t::CN)};
+
+    /** The names of the general categories. */
+    const CategoryName_t category_names[]{
+        {"L", "Letter", LETTER_MASK},
+        {"LC", "Cased_Letter", category_bit(UnicodeCategory_t::LU) | category_bit(UnicodeCategory_t::LL) | category_bit(UnicodeCategory_t::LT)},
+        {"Lu", "Uppercase_Letter", category_bit(UnicodeCategory_t::LU)},
+        {"Ll", "Lowercase_Letter", category_bit(UnicodeCategory_t::LL)},
+        {"Lt", "Titlecase_Letter", category_bit(UnicodeCategory_t::LT)},
+        {"Lm", "Modifier_Letter", category_bit(UnicodeCategory_t::LM)},
+        {"Lo", "Other_Letter", category_bit(UnicodeCategory_t::LO)},
+        {"M", "Mark", MARK_MASK},
+        {"Mn", "Nonspacing_Mark", category_bit(UnicodeCategory_t::MN)},
+        {"Mc", "Spacing_Mark", category_bit(UnicodeCategory_t::MC)},
+        {"Me", "Enclosing_Mark", category_bit(UnicodeCategory_t::ME)},
+        {"N", "Number", NUMBER_MASK},
+        {"Nd", "Decimal_Number", category_bit(UnicodeCategory_t::ND)},
+        {"Nl", "Letter_Number", category_bit(UnicodeCategory_t::NL)},
+        {"No", "Other_Number", category_bit(UnicodeCategory_t::NO)},
+        {"P", "Punctuation", PUNCTUATION_MASK},
+        {"Pc", "Connector_Punctuation", category_bit(UnicodeCategory_t::PC)},
+        {"Pd", "Dash_Punctuation", category_bit(UnicodeCategory_t::PD)},
+        {"Ps", "Open_Punctuation", category_bit(UnicodeCategory_t::PS)},
+        {"Pe", "Close_Punctuation", category_bit(UnicodeCategory_t::PE)},
+        {"Pi", "Initial_Punctuation", category_bit(UnicodeCategory_t::PI)},
+        {"Pf", "Final_Punctuation", category_bit(UnicodeCategory_t::PF)},
+        {"Po", "Other_Punctuation", category_bit(UnicodeCategory_t::PO)},
+        {"S", "Symbol", SYMBOL_MASK},
+        {"Sm", "Math_Symbol", category_bit(UnicodeCategory_t::SM)},
+        {"Sc", "Currency_Symbol", category_bit(UnicodeCategory_t::SC)},
+        {"Sk", "Modifier_Symbol", category_bit(UnicodeCategory_t::SK)},
+        {"So", "Other_Symbol", category_bit(UnicodeCategory_t::SO)},
+        {"Z", "Separator", SEPARATOR_MASK},
+        {"Zs", "Space_Separator", category_bit(UnicodeCategory_t::ZS)},
+        {"Zl", "Line_Separator", category_bit(UnicodeCategory_t::ZL)},
+        {"Zp", "Paragraph_Separator", category_bit(UnicodeCategory_t::ZP)},
+        {"C", "Other", OTHER_MASK},
+        {"Cc", "Control", category_bit(UnicodeCategory_t::CC)},
+        {"Cf", "Format", category_bit(UnicodeCategory_t::CF)},
+        {"Cs", "Surrogate", category_bit(UnicodeCategory_t::CS)},
+        {"Co", "Private_Use", category_bit(UnicodeCategory_t::CO)},
+        {"Cn", "Unassigned", category_bit(UnicodeCategory_t::CN)},
+    };
+
+    /** Get the set of the code points in the general categories.
+        \param [in] mask The bit mask of the general categories.
+        \return The set.
+    */
+    CodeRanges_t category_set(const std::uint32_t mask)
+    {
+        CodeRanges_t r;
+        char32_t next{0};
+        for (std::size_t i = 0; i < tphrase::unicode_category_table_size; ++i) {
+            const auto &range = tphrase::unicode_category_table[i];
+            if ((mask & category_bit(UnicodeCategory_t::CN)) != 0 && range.first > next) {
+                r.emplace_back(next, range.first - 1);
+            }
+            if ((mask & category_bit(range.category)) != 0) {
+                r.emplace_back(range.first, range.last);
+            }
+            next = range.last + 1;
+        }
+        if ((mask & category_bit(UnicodeCategory_t::CN)) != 0 && next <= MAX_CODE_POINT) {
+            r.emplace_back(next, MAX_CODE_POINT);
+        }
+        normalize(r);
+        return r;
+    }
+
+    /** Get the set of a Unicode property.
+        \param [in] name The name of the property in "\p{name}".
+        \return The set.
+        \throw std::runtime_error if the property is unknown.
+    */
+    CodeRanges_t property_set(const std::string &name)
+    {
+        std::string value{name};
+        const std::size_t eq{name.find('=')};
+        if (eq != std::string::npos) {
+            const std::string key{name.substr(0, eq)};
+            if (key != "General_Category" && key != "gc") {
+                throw std::runtime_error{"Unsupported Unicode property: " + name};
+            }
+            value = name.substr(eq + 1);
+        }
+        for (const auto &n : category_names) {
+            if (value == n.short_name || value == n.long_name) {
+                return category_set(n.mask);
+            }
+        }
+        if (eq == std::string::npos) {
+            if (value == "Any") {
+                return CodeRanges_t{{0, MAX_CODE_POINT}};
+            }
+            if (value == "ASCII") {
+                return CodeRanges_t{{0, 0x7F}};
+            }
+        }
+        throw std::runtime_error{"Unsupported Unicode property: " + name};
+    }
+
+    /** The node of the syntax tree of a pattern. */
+    struct Node_t {
+        /** The kind of the node. */
+        enum class Kind_t {
+            EMPTY, /**< Match the empty string. */
+            SET, /**< Match a code point in the set "index". */
+            CONCAT, /**< Match the children in order. */
+            ALTERNATIVE, /**< Match one of the children. */
+            REPEAT, /**< Match the child repeatedly. */
+            GROUP, /**< Match the child and capture it as the group "index". */
+            ASSERTION, /**< Assert "index". */
+        };
+
+        Kind_t kind; /**< The kind of the node. */
+        std::size_t index; /**< The index of the set, the group, or the assertion. */
+        std::size_t min; /**< The minimum number of the repeat. */
+        std::size_t max; /**< The maximum number of the repeat. */
+        bool greedy; /**< Is the repeat greedy? */
+        std::vector<Node_t> children; /**< The children. */
+
+        /** The constructor.
+            \param [in] k The kind of the node.
+            \param [in] i The index.
+        */
+        explicit Node_t(const Kind_t k, const std::size_t i = 0)
+            : kind{k}, index{i}, min{0}, max{0}, greedy{true}, children{}
+        {
+        }
+    };
+
+    /** The parser of a pattern in the subset of the ECMAScript regex grammar. */
+    class PatternParser {
+    public:
+        /** The constructor.
+            \param [in] pattern The pattern.
+        */
+        explicit PatternParser(const std::string &pattern)
+            : cps{}, pos{0}, sets{}, num_groups{0}, depth{0}
+        {
+            std::size_t len;
+            for (std::size_t i = 0; i < pattern.size(); i += len) {
+                cps.push_back(tphrase::decode_utf8(pattern, i, len));
+            }
+        }
+
+        /** Parse the pattern.
+            \return The syntax tree.
+            \throw std::runtime_error if the pattern has an error.
+        */
+        Node_t parse()
+        {
+            Node_t node{parse_disjunction()};
+            if (peek() != END_OF_PATTERN) {
+                // parse_disjunction() stops only at the end of the pattern or ")".
+                throw std::runtime_error{"Unmatched ')'."};
+            }
+            return node;
+        }
+
+        /** Get the sets used by the syntax tree.
+            \return The sets.
+        */
+        std::vector<CodeRanges_t> &get_sets()
+        {
+            return sets;
+        }
+
+        /** Get the number of the capturing groups.
+            \return The number of the capturing groups.
+        */
+        std::size_t get_group_number() const
+        {
+            return num_groups;
+        }
+
+    private:
+        /** Peek a code point.
+            \param [in] offset The offset from the current position.
+            \return The code point, or END_OF_PATTERN.
+        */
+        char32_t peek(const std::size_t offset = 0) const
+        {
+            return pos + offset < cps.size() ? cps[pos + offset] : END_OF_PATTERN;
+        }
+
+        /** Add a set.
+            \param [in] ranges The ranges of the set.
+            \return The index of the set.
+        */
+        std::size_t add_set(CodeRanges_t &&ranges)
+        {
+            normalize(ranges);
+            const auto it = std::find(sets.begin(), sets.end(), ranges);
+            if (it != sets.end()) {
+                return static_cast<std::size_t>(it - sets.begin());
+            }
+            sets.emplace_back(std::move(ranges));
+            return sets.size() - 1;
+        }
+
+        /** Make a node to match a set.
+            \param [in] ranges The ranges of the set.
+            \return The node.
+        */
+        Node_t set_node(CodeRanges_t &&ranges)
+        {
+            return Node_t{Node_t::Kind_t::SET, add_set(std::move(ranges))};
+        }
+
+        /** Parse a disjunction.
+            \return The node.
+        */
+        Node_t parse_disjunction()
+        {
+            Node_t first{parse_alternative()};
+            if (peek() != '|') {
+                return first;
+            }
+            Node_t node{Node_t::Kind_t::ALTERNATIVE};
+            node.children.emplace_back(std::move(first));
+            while (peek() == '|') {
+                ++pos;
+                node.children.emplace_back(parse_alternative());
+            }
+            return node;
+        }
+
+        /** Parse an alternative.
+            \return The node.
+        */
+        Node_t parse_alternative()
+        {
+            Node_t node{Node_t::Kind_t::CONCAT};
+            for (;;) {
+                const char32_t c{peek()};
+                if (c == END_OF_PATTERN || c == '|' || c == ')') {
+                    break;
+                }
+                node.children.emplace_back(parse_term());
+            }
+            if (node.children.empty()) {
+                return Node_t{Node_t::Kind_t::EMPTY};
+            }
+            if (node.children.size() == 1) {
+                return std::move(node.children[0]);
+            }
+            return node;
+        }
+
+        /** Parse a term.
+            \return The node.
+        */
+        Node_t parse_term()
+        {
+            const char32_t c{peek()};
+            Assertion_t assertion;
+            bool is_assertion{true};
+            if (c == '^') {
+                assertion = Assertion_t::BEGIN;
+            } else if (c == '$') {
+                assertion = Assertion_t::END;
+            } else if (c == '\\' && peek(1) == 'b') {
+                assertion = Assertion_t::WORD_BOUNDARY;
+            } else if (c == '\\' && peek(1) == 'B') {
+                assertion = Assertion_t::NOT_WORD_BOUNDARY;
+            } else {
+                is_assertion = false;
+            }
+            if (is_assertion) {
+                pos += c == '\\' ? 2 : 1;
+                std::size_t min;
+                std::size_t max;
+                if (peek_quantifier(min, max) != 0) {
+                    throw std::runtime_error{"Nothing to repeat."};
+                }
+                return Node_t{Node_t::Kind_t::ASSERTION, static_cast<std::size_t>(assertion)};
+            }
+
+            Node_t atom{parse_atom()};
+            std::size_t min;
+            std::size_t max;
+            const std::size_t len{peek_quantifier(min, max)};
+            if (len == 0) {
+                return atom;
+            }
+            pos += len;
+            if (min > max) {
+                throw std::runtime_error{"Numbers out of order in {} quantifier."};
+            }
+            Node_t node{Node_t::Kind_t::REPEAT};
+            node.min = min;
+            node.max = max;
+            if (peek() == '?') {
+                ++pos;
+                node.greedy = false;
+            }
+            node.children.emplace_back(std::move(atom));
+            return node;
+        }
+
+        /** Peek a quantifier.
+            \param [out] min The minimum number of the repeat.
+            \param [out] max The maximum number of the repeat.
+            \return The length of the quantifier, or 0 if it's not a quantifier.
+        */
+        std::size_t peek_quantifier(std::size_t &min, std::size_t &max) const
+        {
+            const char32_t c{peek()};
+            if (c == '*') {
+                min = 0;
+                max = INFINITE_REPEAT;
+                return 1;
+            }
+            if (c == '+') {
+                min = 1;
+                max = INFINITE_REPEAT;
+                return 1;
+            }
+            if (c == '?') {
+                min = 0;
+                max = 1;
+                return 1;
+            }
+            if (c != '{') {
+                return 0;
+            }
+            std::size_t i{1};
+            if (!peek_number(i, min)) {
+                return 0;
+            }
+            if (peek(i) == '}') {
+                max = min;
+                return i + 1;
+            }
+            if (peek(i) != ',') {
+                return 0;
+            }
+            ++i;
+            if (peek(i) == '}') {
+                max = INFINITE_REPEAT;
+                return i + 1;
+            }
+            if (!peek_number(i, max) || peek(i) != '}') {
+                return 0;
+            }
+            return i + 1;
+        }
+
+        /** Peek a decimal number.
+            \param [inout] i The offset from the current position.
+            \param [out] n The number.
+            \return true if a number is found.
+        */
+        bool peek_number(std::size_t &i, std::size_t &n) const
+        {
+            const std::size_t begin{i};
+            n = 0;
+            while (peek(i) >= '0' && peek(i) <= '9') {
+                n = std::min(n * 10 + (peek(i) - '0'), MAX_REPEAT_NUMBER);
+                ++i;
+            }
+            return i > begin;
+        }
+
+        /** Parse an atom.
+            \return The node.
+        */
+        Node_t parse_atom()
+        {
+            const char32_t c{peek()};
+            std::size_t min;
+            std::size_t max;
+            if (c == '*' || c == '+' || c == '?' || (c == '{' && peek_quantifier(min, max) != 0)) {
+                throw std::runtime_error{"Nothing to repeat."};
+            }
+            ++pos;
+            if (c == '.') {
+                return set_node(any_set());
+            }
+            if (c == '(') {
+                return parse_group();
+            }
+            if (c == '[') {
+                return set_node(parse_class());
+            }
+            if (c == '\\') {
+                CodeRanges_t ranges;
+                parse_escape(false, ranges);
+                return set_node(std::move(ranges));
+            }
+            return set_node(CodeRanges_t{{c, c}});
+        }
+
+        /** Parse a group after "(".
+            \return The node.
+        */
+        Node_t parse_group()
+        {
+            bool capturing{true};
+            if (peek() == '?') {
+                if (peek(1) == ':') {
+                    capturing = false;
+                    pos += 2;
+                } else if (peek(1) == '=' || peek(1) == '!'
+                           || (peek(1) == '<' && (peek(2) == '=' || peek(2) == '!'))) {
+                    throw std::runtime_error{"Lookaround assertion is not supported."};
+                } else if (peek(1) == '<') {
+                    // The name of the group is ignored, because the named backreference isn't supported.
+                    std::size_t i{2};
+                    while (peek(i) != '>' && peek(i) != END_OF_PATTERN) {
+                        ++i;
+                    }
+                    if (i == 2 || peek(i) == END_OF_PATTERN) {
+                        throw std::runtime_error{"Invalid capture group name."};
+                    }
+                    pos += i + 1;
+                } else {
+                    throw std::runtime_error{"Invalid group."};
+                }
+            }
+            const std::size_t group{capturing ? ++num_groups : 0};
+            if (++depth > MAX_NESTING) {
+                throw std::runtime_error{"The pattern is too deeply nested."};
+            }
+            Node_t child{parse_disjunction()};
+            if (peek() != ')') {
+                throw std::runtime_error{"Unterminated group."};
+            }
+            ++pos;
+            --depth;
+            if (!capturing) {
+                return child;
+            }
+            Node_t node{Node_t::Kind_t::GROUP, group};
+            node.children.emplace_back(std::move(child));
+            return node;
+        }
+
+        /** Parse a character class after "[".
+            \return The ranges of the class.
+        */
+        CodeRanges_t parse_class()
+        {
+            bool negative{false};
+            if (peek() == '^') {
+                negative = true;
+                ++pos;
+            }
+            CodeRanges_t ranges;
+            for (;;) {
+                if (peek() == END_OF_PATTERN) {
+                    throw std::runtime_error{"Unterminated character class."};
+                }
+                if (peek() == ']') {
+                    ++pos;
+                    break;
+                }
+                CodeRanges_t first;
+                const bool is_first_char{parse_class_atom(first)};
+                if (peek() == '-' && peek(1) != ']' && peek(1) != END_OF_PATTERN) {
+                    ++pos;
+                    CodeRanges_t second;
+                    const bool is_second_char{parse_class_atom(second)};
+                    if (is_first_char && is_second_char) {
+                        if (first[0].first > second[0].first) {
+                            throw std::runtime_error{"Range out of order in character class."};
+                        }
+                        ranges.emplace_back(first[0].first, second[0].first);
+                    } else {
+                        // "-" is a literal if a class escape is an end of the range.
+                        ranges.insert(ranges.end(), first.begin(), first.end());
+                        ranges.emplace_back('-', '-');
+                        ranges.insert(ranges.end(), second.begin(), second.end());
+                    }
+                } else {
+                    ranges.insert(ranges.end(), first.begin(), first.end());
+                }
+            }
+            normalize(ranges);
+            return negative ? negate(ranges) : ranges;
+        }
+
+        /** Parse an atom in a character class.
+            \param [out] ranges The ranges of the atom.
+            \return true if the atom is a single character.
+        */
+        bool parse_class_atom(CodeRanges_t &ranges)
+        {
+            const char32_t c{peek()};
+            ++pos;
+            if (c != '\\') {
+                ranges.assign(1, std::make_pair(c, c));
+                return true;
+            }
+            return parse_escape(true, ranges);
+        }
+
+        /** Parse an escape sequence after "\".
+            \param [in] in_class Is the escape sequence in a character class?
+            \param [out] ranges The ranges of the escape sequence.
+            \return true if the escape sequence is a single character.
+        */
+        bool parse_escape(const bool in_class, CodeRanges_t &ranges)
+        {
+            const char32_t c{peek()};
+            if (c == END_OF_PATTERN) {
+                throw std::runtime_error{"\\ at end of pattern."};
+            }
+            ++pos;
+            switch (c) {
+            case 'd':
+                ranges = digit_set();
+                return false;
+            case 'D':
+                ranges = negate(digit_set());
+                return false;
+            case 'w':
+                ranges = word_set();
+                return false;
+            case 'W':
+                ranges = negate(word_set());
+                return false;
+            case 's':
+                ranges = space_set();
+                return false;
+            case 'S':
+                ranges = negate(space_set());
+                return false;
+            case 'p':
+            case 'P':
+                if (peek() == '{') {
+                    std::string name;
+                    std::size_t i{1};
+                    while (peek(i) != '}') {
+                        if (peek(i) == END_OF_PATTERN || peek(i) > 0x7F) {
+                            throw std::runtime_error{"Invalid property name."};
+                        }
+                        name += static_cast<char>(peek(i));
+                        ++i;
+                    }
+                    pos += i + 1;
+                    ranges = property_set(name);
+                    if (c == 'P') {
+                        ranges = negate(ranges);
+                    }
+                    return false;
+                }
+                break;
+            case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
+                throw std::runtime_error{in_class ? "Octal escape is not supported." : "Backreference is not supported."};
+            case 'k':
+                if (!in_class && peek() == '<') {
+                    throw std::runtime_error{"Backreference is not supported."};
+                }
+                break;
+            default:
+                break;
+            }
+            const char32_t ch{parse_character_escape(c, in_class)};
+            ranges.assign(1, std::make_pair(ch, ch));
+            return true;
+        }
+
+        /** Parse an escape sequence meaning a character.
+            \param [in] c The character after "\".
+            \param [in] in_class Is the escape sequence in a character class?
+            \return The character.
+        */
+        char32_t parse_character_escape(const char32_t c, const bool in_class)
+        {
+            switch (c) {
+            case 't':
+                return 0x09;
+            case 'n':
+                return 0x0A;
+            case 'v':
+                return 0x0B;
+            case 'f':
+                return 0x0C;
+            case 'r':
+                return 0x0D;
+            case 'b':
+                // "\b" in a character class is a backspace.
+                return in_class ? 0x08 : c;
+            case '0':
+                if (peek() >= '0' && peek() <= '9') {
+                    throw std::runtime_error{"Octal escape is not supported."};
+                }
+                return 0;
+            case 'c':
+                {
+                    const char32_t x{peek()};
+                    if ((x >= 'A' && x <= 'Z') || (x >= 'a' && x <= 'z')) {
+                        ++pos;
+                        return x % 32;
+                    }
+                    // "\c" without a control letter is "\" and "c".
+                    --pos;
+                    return '\\';
+                }
+            case 'x':
+                {
+                    std::size_t i{0};
+                    char32_t v;
+                    if (peek_hex(i, 2, v)) {
+                        pos += i;
+                        return v;
+                    }
+                    return c;
+                }
+            case 'u':
+                return parse_unicode_escape();
+            default:
+                return c;
+            }
+        }
+
+        /** Parse an escape sequence after "\u".
+            \return The character.
+        */
+        char32_t parse_unicode_escape()
+        {
+            std::size_t i{0};
+            char32_t v;
+            if (peek() == '{') {
+                i = 1;
+                v = 0;
+                while (peek(i) != '}') {
+                    char32_t d;
+                    std::size_t j{i};
+                    if (!peek_hex(j, 1, d)) {
+                        return 'u';
+                    }
+                    v = v * 16 + d;
+                    if (v > MAX_CODE_POINT) {
+                        throw std::runtime_error{"Invalid Unicode escape."};
+                    }
+                    i = j;
+                }
+                if (i == 1) {
+                    return 'u';
+                }
+                pos += i + 1;
+                return v;
+            }
+            if (!peek_hex(i, 4, v)) {
+                return 'u';
+            }
+            pos += i;
+            if (v >= 0xD800 && v <= 0xDBFF && peek() == '\\' && peek(1) == 'u') {
+                std::size_t j{2};
+                char32_t low;
+                if (peek_hex(j, 4, low) && low >= 0xDC00 && low <= 0xDFFF) {
+                    pos += j;
+                    v = 0x10000 + ((v - 0xD800) << 10) + (low - 0xDC00);
+                }
+            }
+            return v;
+        }
+
+        /** Peek hexadecimal digits.
+            \param [inout] i The offset from the current position.
+            \param [in] n The number of the digits.
+            \param [out] v The value.
+            \return true if the digits are found.
+        */
+        bool peek_hex(std::size_t &i, const std::size_t n, char32_t &v) const
+        {
+            v = 0;
+            for (std::size_t k = 0; k < n; ++k) {
+                const char32_t d{peek(i + k)};
+                if (d >= '0' && d <= '9') {
+                    v = v * 16 + (d - '0');
+                } else if (d >= 'A' && d <= 'F') {
+                    v = v * 16 + (d - 'A' + 10);
+                } else if (d >= 'a' && d <= 'f') {
+                    v = v * 16 + (d - 'a' + 10);
+                } else {
+                    return false;
+                }
+            }
+            i += n;
+            return true;
+        }
+
+        std::vector<char32_t> cps; /**< The code points of the pattern. */
+        std::size_t pos; /**< The current position in cps. */
+        std::vector<CodeRanges_t> sets; /**< The sets used by the syntax tree. */
+        std::size_t num_groups; /**< The number of the capturing groups. */
+        std::size_t depth; /**< The current nesting of the groups. */
+    };
+
+    /** Does a node match only the empty string without any instruction?
+        \param [in] node The node.
+        \return true if the node is compiled into nothing.
+    */
+    bool is_empty_node(const Node_t &node)
+    {
+        switch (node.kind) {
+        case Node_t::Kind_t::EMPTY:
+            return true;
+        case Node_t::Kind_t::CONCAT:
+            return std::all_of(node.children.begin(), node.children.end(), is_empty_node);
+        case Node_t::Kind_t::REPEAT:
+            return is_empty_node(node.children[0]);
+        default:
+            return false;
+        }
+    }
+
+    /** Can a node match the empty string?
+        \param [in] node The node.
+        \return true if the node can match the empty string.
+    */
+    bool is_nullable(const Node_t &node)
+    {
+        switch (node.kind) {
+        case Node_t::Kind_t::SET:
+            return false;
+        case Node_t::Kind_t::CONCAT:
+            return std::all_of(node.children.begin(), node.children.end(), is_nullable);
+        case Node_t::Kind_t::ALTERNATIVE:
+            return std::any_of(node.children.begin(), node.children.end(), is_nullable);
+        case Node_t::Kind_t::REPEAT:
+            return node.min == 0 || is_nullable(node.children[0]);
+        case Node_t::Kind_t::GROUP:
+            return is_nullable(node.children[0]);
+        default:
+            return true;
+        }
+    }
+
+    /** Get the range of the capturing groups in a node.
+        \param [in] node The node.
+        \param [inout] first The smallest number of the groups.
+        \param [inout] last The largest number of the groups.
+        \note first and last aren't changed if the node has no group.
+    */
+    void get_group_range(const Node_t &node, std::size_t &first, std::size_t &last)
+    {
+        if (node.kind == Node_t::Kind_t::GROUP) {
+            first = std::min(first, node.index);
+            last = std::max(last, node.index);
+        }
+        for (const auto &child : node.children) {
+            get_group_range(child, first, last);
+        }
+    }
+
+    /** The compiler from a syntax tree to a program. */
+    class Compiler {
+    public:
+        /** The constructor.
+            \param [inout] p The program to which the instructions are appended.
+            \param [in] first_slot The first slot that isn't used by the capturing groups.
+        */
+        Compiler(std::vector<Inst_t> &p, const std::size_t first_slot)
+            : program(p), num_slots{first_slot}
+        {
+        }
+
+        /** Compile a node.
+            \param [in] node The node.
+            \throw std::runtime_error if the program is too large.
+        */
+        void compile(const Node_t &node)
+        {
+            switch (node.kind) {
+            case Node_t::Kind_t::EMPTY:
+                break;
+            case Node_t::Kind_t::SET:
+                emit(Op_t::SET, node.index);
+                break;
+            case Node_t::Kind_t::CONCAT:
+                for (const auto &child : node.children) {
+                    compile(child);
+                }
+                break;
+            case Node_t::Kind_t::ALTERNATIVE:
+                {
+                    std::vector<std::size_t> jumps;
+                    for (std::size_t i = 0; i < node.children.size(); ++i) {
+                        if (i + 1 < node.children.size()) {
+                            const std::size_t split{emit(Op_t::SPLIT, program.size() + 1)};
+                            compile(node.children[i]);
+                            jumps.push_back(emit(Op_t::JMP));
+                            program[split].y = static_cast<std::uint32_t>(program.size());
+                        } else {
+                            compile(node.children[i]);
+                        }
+                    }
+                    for (const auto j : jumps) {
+                        program[j].x = static_cast<std::uint32_t>(program.size());
+                    }
+                }
+                break;
+            case Node_t::Kind_t::REPEAT:
+                compile_repeat(node);
+                break;
+            case Node_t::Kind_t::GROUP:
+                emit(Op_t::SAVE, node.index * 2);
+                compile(node.children[0]);
+                emit(Op_t::SAVE, node.index * 2 + 1);
+                break;
+            case Node_t::Kind_t::ASSERTION:
+                emit(Op_t::ASSERT, node.index);
+                break;
+            }
+        }
+
+        /** Emit an instruction.
+            \param [in] op The kind of the instruction.
+            \param [in] x The first operand.
+            \param [in] y The second operand.
+            \return The position of the instruction.
+            \throw std::runtime_error if the program is too large.
+        */
+        std::size_t emit(const Op_t op, const std::size_t x = 0, const std::size_t y = 0)
+        {
+            if (program.size() >= MAX_PROGRAM_SIZE) {
+                throw std::runtime_error{"The pattern is too large."};
+            }
+            program.push_back(Inst_t{op, static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(y)});
+            return program.size() - 1;
+        }
+
+        /** Get the number of the slots used by the program.
+            \return The number of the slots.
+        */
+        std::size_t get_slot_number() const
+        {
+            return num_slots;
+        }
+
+    private:
+        /** Compile a repeat node.
+            \param [in] node The node.
+            \note The optional iteration fails if it matches the empty string, and each iteration resets the captures in it, as well as ECMAScript.
+        */
+        void compile_repeat(const Node_t &node)
+        {
+            const Node_t &child{node.children[0]};
+            if (is_empty_node(child)) {
+                return;
+            }
+            std::size_t first_group{INFINITE_REPEAT};
+            std::size_t last_group{0};
+            get_group_range(child, first_group, last_group);
+            const bool nullable{is_nullable(child)};
+            const auto compile_iteration = [&](const bool optional) {
+                if (first_group <= last_group) {
+                    emit(Op_t::RESET, first_group * 2, last_group * 2 + 2);
+                }
+                if (optional && nullable) {
+                    const std::size_t slot{num_slots++};
+                    emit(Op_t::SAVE, slot);
+                    compile(child);
+                    emit(Op_t::PROGRESS, slot);
+                } else {
+                    compile(child);
+                }
+            };
+            for (std::size_t i = 0; i < node.min; ++i) {
+                compile_iteration(false);
+            }
+            if (node.max == INFINITE_REPEAT) {
+                const std::size_t split{emit(Op_t::SPLIT)};
+                compile_iteration(true);
+                emit(Op_t::JMP, split);
+                set_split(split, split + 1, program.size(), node.greedy);
+            } else {
+                std::vector<std::size_t> splits;
+                for (std::size_t i = node.min; i < node.max; ++i) {
+                    splits.push_back(emit(Op_t::SPLIT));
+                    compile_iteration(true);
+                }
+                for (const auto split : splits) {
+                    set_split(split, split + 1, program.size(), node.greedy);
+                }
+            }
+        }
+
+        /** Set the operands of a split instruction.
+            \param [in] split The position of the split instruction.
+            \param [in] body The position of the repeated part.
+            \param [in] out The position after the repeat.
+            \param [in] greedy Is the repeat greedy?
+        */
+        void set_split(const std::size_t split, const std::size_t body, const std::size_t out, const bool greedy)
+        {
+            program[split].x = static_cast<std::uint32_t>(greedy ? body : out);
+            program[split].y = static_cast<std::uint32_t>(greedy ? out : body);
+        }
+
+        std::vector<Inst_t> &program; /**< The program. */
+        std::size_t num_slots; /**< The number of the slots used by the program. */
+    };
+
+    /** Is a byte a word character for "\b"?
+        \param [in] c The byte.
+        \return true if c is a word character.
+        \note A non-ASCII character is not a word character, so the byte in it isn't, too.
+    */
+    bool is_word_byte(const char c)
+    {
+        return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || c == '_';
+    }
+
+    /** Is an assertion true?
+        \param [in] a The assertion.
+        \param [in] s The string.
+        \param [in] pos The position in s.
+        \return true if the assertion is true at pos.
+    */
+    bool check_assertion(const Assertion_t a, const std::string &s, const std::size_t pos)
+    {
+        switch (a) {
+        case Assertion_t::BEGIN:
+            return pos == 0;
+        case Assertion_t::END:
+            return pos == s.size();
+        case Assertion_t::WORD_BOUNDARY:
+        case Assertion_t::NOT_WORD_BOUNDARY:
+            {
+                const bool before{pos > 0 && is_word_byte(s[pos - 1])};
+                const bool after{pos < s.size() && is_word_byte(s[pos])};
+                return (before != after) == (a == Assertion_t::WORD_BOUNDARY);
+            }
+        }
+        return false;
+    }
+}
+
+namespace tphrase {
+    constexpr std::size_t Utf8Regex::NPOS;
+
+    Utf8Regex::Utf8Regex(const std::string &pattern)
+        : program{},
+          sets{},
+          num_groups{0},
+          num_slots{0},
+          has_dfa{false},
+          ascii_classes{},
+          boundaries{},
+          interval_classes{},
+          num_classes{0},
+          transitions{},
+          accepts{},
+          start_states{0, 0},
+          dead_state{0},
+          idle_bytes{}
+    {
+        PatternParser parser{pattern};
+        const Node_t root{parser.parse()};
+        sets = std::move(parser.get_sets());
+        num_groups = parser.get_group_number();
+
+        Compiler compiler{program, (num_groups + 1) * 2};
+        compiler.emit(Op_t::SAVE, 0);
+        compiler.compile(root);
+        compiler.emit(Op_t::SAVE, 1);
+        compiler.emit(Op_t::MATCH);
+        num_slots = compiler.get_slot_number();
+
+        build_dfa();
+    }
+
+    std::size_t Utf8Regex::get_group_number() const
+    {
+        return num_groups;
+    }
+
+    Utf8Regex::Workspace_t::Workspace_t()
+        : marks{}, generation{0}, current{}, next{}, slots{}, stack{}
+    {
+    }
+
+    bool Utf8Regex::search(const std::string &s, const std::size_t start, std::vector<std::size_t> &captures,
+                           Workspace_t &ws) const
+    {
+        std::size_t from{start};
+        // The empty string is left to the Pike VM, because it's the beginning and the end at the same time.
+        if (has_dfa && !s.empty() && !search_by_dfa(s, start, from)) {
+            captures.assign((num_groups + 1) * 2, NPOS);
+            return false;
+        }
+        return search_by_nfa(s, from, captures, ws);
+    }
+
+    void Utf8Regex::build_dfa()
+    {
+        for (const auto &inst : program) {
+            if (inst.op == Op_t::ASSERT
+                && (inst.x == static_cast<std::uint32_t>(Assertion_t::WORD_BOUNDARY)
+                    || inst.x == static_cast<std::uint32_t>(Assertion_t::NOT_WORD_BOUNDARY))) {
+                // The DFA doesn't know the previous character.
+                return;
+            }
+        }
+
+        // The equivalence classes of the code points.
+        std::vector<char32_t> points{0, MAX_CODE_POINT + 1};
+        for (const auto &set : sets) {
+            for (const auto &range : set) {
+                points.push_back(range.first);
+                points.push_back(range.second + 1);
+            }
+        }
+        std::sort(points.begin(), points.end());
+        points.erase(std::unique(points.begin(), points.end()), points.end());
+        std::map<std::vector<bool>, std::uint32_t> signatures;
+        std::vector<char32_t> class_chars; // A code point in each class.
+        for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+            std::vector<bool> signature(sets.size());
+            for (std::size_t k = 0; k < sets.size(); ++k) {
+                signature[k] = is_in_set(static_cast<std::uint32_t>(k), points[i]);
+            }
+            const auto it = signatures.emplace(std::move(signature), static_cast<std::uint32_t>(class_chars.size()));
+            if (it.second) {
+                class_chars.push_back(points[i]);
+            }
+            boundaries.push_back(points[i]);
+            interval_classes.push_back(it.first->second);
+        }
+        num_classes = class_chars.size();
+        for (char32_t c = 0; c < 0x80; ++c) {
+            ascii_classes[c] = get_class(c);
+        }
+
+        // The state is the list of the threads in the order of the priority, and whether the search continues.
+        using StateKey_t = std::pair<std::vector<std::uint32_t>, bool>;
+        std::map<StateKey_t, std::uint32_t> ids;
+        std::vector<StateKey_t> keys;
+        std::vector<std::uint32_t> marks(program.size(), 0);
+        std::uint32_t generation{0};
+        std::vector<std::uint32_t> stack;
+
+        // Add the threads from pc into list in the order of the priority. It returns true if the match is added, and the threads with the lower priority are cut.
+        const auto closure = [&](const std::uint32_t pc0, const bool at_begin, const bool at_end, std::vector<std::uint32_t> &list) -> bool {
+            stack.assign(1, pc0);
+            while (!stack.empty()) {
+                const std::uint32_t pc{stack.back()};
+                stack.pop_back();
+                if (marks[pc] == generation) {
+                    continue;
+                }
+                marks[pc] = generation;
+                const Inst_t &inst{program[pc]};
+                switch (inst.op) {
+                case Op_t::JMP:
+                    stack.push_back(inst.x);
+                    break;
+                case Op_t::SPLIT:
+                    stack.push_back(inst.y);
+                    stack.push_back(inst.x);
+                    break;
+                case Op_t::SAVE:
+                case Op_t::RESET:
+                case Op_t::PROGRESS:
+                    // The DFA ignores the progress check, so it may find a match that the Pike VM rejects.
+                    stack.push_back(pc + 1);
+                    break;
+                case Op_t::ASSERT:
+                    if (inst.x == static_cast<std::uint32_t>(Assertion_t::BEGIN)) {
+                        if (at_begin) {
+                            stack.push_back(pc + 1);
+                        }
+                    } else if (at_end) {
+                        stack.push_back(pc + 1);
+                    } else {
+                        // The assertion "$" is pending until the next character.
+                        list.push_back(pc);
+                    }
+                    break;
+                case Op_t::SET:
+                    list.push_back(pc);
+                    break;
+                case Op_t::MATCH:
+                    list.push_back(pc);
+                    return true;
+                }
+            }
+            return false;
+        };
+        const auto intern = [&](StateKey_t &&key) -> std::uint32_t {
+            const auto it = ids.find(key);
+            if (it != ids.end()) {
+                return it->second;
+            }
+            const std::uint32_t id{static_cast<std::uint32_t>(keys.size())};
+            ids.emplace(key, id);
+            keys.emplace_back(std::move(key));
+            return id;
+        };
+
+        for (int at_begin = 0; at_begin < 2; ++at_begin) {
+            StateKey_t key{std::vector<std::uint32_t>{}, true};
+            ++generation;
+            closure(0, at_begin != 0, false, key.first);
+            start_states[at_begin] = intern(std::move(key));
+        }
+        dead_state = intern(StateKey_t{std::vector<std::uint32_t>{}, false});
+
+        for (std::size_t id = 0; id < keys.size(); ++id) {
+            if (keys.size() > MAX_DFA_STATES || keys.size() * num_classes > MAX_DFA_TRANSITIONS) {
+                boundaries.clear();
+                interval_classes.clear();
+                transitions.clear();
+                accepts.clear();
+                return;
+            }
+            transitions.resize(keys.size() * num_classes);
+            for (std::size_t cls = 0; cls < num_classes; ++cls) {
+                const StateKey_t &key{keys[id]};
+                const char32_t c{class_chars[cls]};
+                StateKey_t next{std::vector<std::uint32_t>{}, key.second};
+                ++generation;
+                bool matched{false};
+                for (const auto pc : key.first) {
+                    const Inst_t &inst{program[pc]};
+                    if (inst.op == Op_t::MATCH) {
+                        // The match ended before this character cuts the threads with the lower priority.
+                        next.second = false;
+                        break;
+                    }
+                    if (inst.op == Op_t::SET && is_in_set(inst.x, c) && closure(pc + 1, false, false, next.first)) {
+                        matched = true;
+                        break;
+                    }
+                }
+                const bool idle{next.second && next.first.empty()};
+                if (next.second && !matched) {
+                    closure(0, false, false, next.first);
+                }
+                const std::uint32_t next_id{intern(std::move(next))};
+                transitions[id * num_classes + cls] = (next_id << TRANSITION_FLAG_BITS) | (idle ? IDLE : 0);
+            }
+        }
+
+        accepts.assign(keys.size(), 0);
+        for (std::size_t id = 0; id < keys.size(); ++id) {
+            std::vector<std::uint32_t> list;
+            ++generation;
+            for (const auto pc : keys[id].first) {
+                if (program[pc].op == Op_t::MATCH) {
+                    accepts[id] = ACCEPT | ACCEPT_AT_END;
+                }
+            }
+            for (const auto pc : keys[id].first) {
+                if (accepts[id] != 0) {
+                    break;
+                }
+                if (program[pc].op == Op_t::ASSERT && closure(pc + 1, false, true, list)) {
+                    accepts[id] = ACCEPT_AT_END;
+                }
+            }
+        }
+
+        // The state is represented by the first index of its row in transitions, in order to avoid the multiplication.
+        for (auto &t : transitions) {
+            const std::uint32_t next_id{t >> TRANSITION_FLAG_BITS};
+            t = (static_cast<std::uint32_t>(next_id * num_classes) << TRANSITION_FLAG_BITS)
+                | (t & IDLE) | (accepts[next_id] & ACCEPT);
+        }
+        for (auto &state : start_states) {
+            state *= static_cast<std::uint32_t>(num_classes);
+        }
+        dead_state *= static_cast<std::uint32_t>(num_classes);
+        for (unsigned char c = 0; c < 0x80; ++c) {
+            const std::uint32_t t{transitions[start_states[0] + ascii_classes[c]]};
+            idle_bytes[c] = (t >> TRANSITION_FLAG_BITS) == start_states[0] && (t & IDLE) != 0 && (t & ACCEPT) == 0 ? 1 : 0;
+        }
+        has_dfa = true;
+    }
+
+    bool Utf8Regex::search_by_dfa(const std::string &s, const std::size_t start, std::size_t &from) const
+    {
+        const unsigned char *const p{reinterpret_cast<const unsigned char *>(s.data())};
+        const std::size_t n{s.size()};
+        const std::uint32_t *const trans{transitions.data()};
+        const std::uint32_t idle_state{start_states[0]};
+        std::uint32_t state{start_states[start == 0 ? 1 : 0]};
+        bool found{(accepts[state / num_classes] & ACCEPT) != 0};
+        std::size_t idle_pos{start};
+        std::size_t i{start};
+        while (i < n && state != dead_state) {
+            if (state == idle_state) {
+                // Skip the ASCII characters that can't start a match, 8 bytes at a time as long as possible.
+                const std::size_t skip_start{i};
+                while (n - i >= 8
+                       && (idle_bytes[p[i]] & idle_bytes[p[i + 1]] & idle_bytes[p[i + 2]] & idle_bytes[p[i + 3]]
+                           & idle_bytes[p[i + 4]] & idle_bytes[p[i + 5]] & idle_bytes[p[i + 6]] & idle_bytes[p[i + 7]]) != 0) {
+                    i += 8;
+                }
+                while (i < n && idle_bytes[p[i]] != 0) {
+                    ++i;
+                }
+                if (i != skip_start) {
+                    idle_pos = i;
+                    if (i == n) {
+                        break;
+                    }
+                }
+            }
+            const unsigned char b{p[i]};
+            std::uint32_t cls;
+            if (b < 0x80) {
+                cls = ascii_classes[b];
+                ++i;
+            } else {
+                std::size_t len;
+                cls = get_class(decode_utf8(s, i, len));
+                i += len;
+            }
+            const std::uint32_t t{trans[state + cls]};
+            state = t >> TRANSITION_FLAG_BITS;
+            if ((t & IDLE) != 0) {
+                // No match starts before i.
+                idle_pos = i;
+            }
+            if ((t & ACCEPT) != 0) {
+                found = true;
+            }
+        }
+        if (i == n && (accepts[state / num_classes] & ACCEPT_AT_END) != 0) {
+            found = true;
+        }
+        from = idle_pos;
+        return found;
+    }
+
+    bool Utf8Regex::search_by_nfa(const std::string &s, const std::size_t start, std::vector<std::size_t> &captures,
+                                  Workspace_t &ws) const
+    {
+        const std::size_t num_captures{num_slots};
+        captures.assign((num_groups + 1) * 2, NPOS);
+        if (ws.marks.size() != program.size() || ws.generation > UINT32_MAX / 2) {
+            ws.marks.assign(program.size(), 0);
+            ws.generation = 0;
+        }
+        std::vector<std::uint32_t> &marks{ws.marks};
+        std::uint32_t &generation{ws.generation};
+        ++generation;
+        Workspace_t::ThreadList_t &current{ws.current};
+        Workspace_t::ThreadList_t &next{ws.next};
+        current.pcs.clear();
+        current.slots.clear();
+        std::vector<std::size_t> &caps{ws.slots};
+        caps.resize(num_captures);
+        using Entry_t = Workspace_t::Entry_t;
+        std::vector<Entry_t> &stack{ws.stack};
+        // Add the threads from pc into list in the order of the priority, with the slots in caps.
+        const auto add_thread = [&](Workspace_t::ThreadList_t &list, const std::uint32_t pc0, const std::size_t pos) {
+            stack.assign(1, Entry_t{pc0, false, 0});
+            while (!stack.empty()) {
+                const Entry_t e{stack.back()};
+                stack.pop_back();
+                if (e.restore) {
+                    caps[e.pc] = e.value;
+                    continue;
+                }
+                const std::uint32_t pc{e.pc};
+                if (marks[pc] == generation) {
+                    continue;
+                }
+                marks[pc] = generation;
+                const Inst_t &inst{program[pc]};
+                switch (inst.op) {
+                case Op_t::JMP:
+                    stack.push_back(Entry_t{inst.x, false, 0});
+                    break;
+                case Op_t::SPLIT:
+                    stack.push_back(Entry_t{inst.y, false, 0});
+                    stack.push_back(Entry_t{inst.x, false, 0});
+                    break;
+                case Op_t::SAVE:
+                    stack.push_back(Entry_t{inst.x, true, caps[inst.x]});
+                    caps[inst.x] = pos;
+                    stack.push_back(Entry_t{pc + 1, false, 0});
+                    break;
+                case Op_t::RESET:
+                    for (std::uint32_t slot = inst.x; slot < inst.y; ++slot) {
+                        stack.push_back(Entry_t{slot, true, caps[slot]});
+                        caps[slot] = NPOS;
+                    }
+                    stack.push_back(Entry_t{pc + 1, false, 0});
+                    break;
+                case Op_t::PROGRESS:
+                    if (caps[inst.x] != pos) {
+                        stack.push_back(Entry_t{pc + 1, false, 0});
+                    }
+                    break;
+                case Op_t::ASSERT:
+                    if (check_assertion(static_cast<Assertion_t>(inst.x), s, pos)) {
+                        stack.push_back(Entry_t{pc + 1, false, 0});
+                    }
+                    break;
+                case Op_t::SET:
+                case Op_t::MATCH:
+                    list.pcs.push_back(pc);
+                    list.slots.insert(list.slots.end(), caps.begin(), caps.end());
+                    break;
+                }
+            }
+        };
+
+        bool matched{false};
+        std::size_t pos{start};
+        for (;;) {
+            if (!matched) {
+                std::fill(caps.begin(), caps.end(), NPOS);
+                add_thread(current, 0, pos);
+            }
+            const bool at_end{pos >= s.size()};
+            if (current.pcs.empty() && (matched || at_end)) {
+                break;
+            }
+            std::size_t len{0};
+            const char32_t c{at_end ? 0 : decode_utf8(s, pos, len)};
+            ++generation;
+            next.pcs.clear();
+            next.slots.clear();
+            for (std::size_t k = 0; k < current.pcs.size(); ++k) {
+                const Inst_t &inst{program[current.pcs[k]]};
+                const auto thread_caps = current.slots.begin() + k * num_captures;
+                if (inst.op == Op_t::MATCH) {
+                    matched = true;
+                    std::copy(thread_caps, thread_caps + captures.size(), captures.begin());
+                    // The threads with the lower priority are cut.
+                    break;
+                }
+                if (!at_end && is_in_set(inst.x, c)) {
+                    std::copy(thread_caps, thread_caps + num_captures, caps.begin());
+                    add_thread(next, current.pcs[k] + 1, pos + len);
+                }
+            }
+            if (at_end) {
+                break;
+            }
+            std::swap(current, next);
+            pos += len;
+        }
+        return matched;
+    }
+
+    bool Utf8Regex::is_in_set(const std::uint32_t set, const char32_t c) const
+    {
+        const CodeRanges_t &ranges{sets[set]};
+        const auto it = std::upper_bound(ranges.begin(), ranges.end(), c,
+                                         [](const char32_t v, const std::pair<char32_t, char32_t> &r) {
+                                             return v < r.first;
+                                         });
+        return it != ranges.begin() && c <= (it - 1)->second;
+    }
+
+    std::uint32_t Utf8Regex::get_class(const char32_t c) const
+    {
+        const auto it = std::upper_bound(boundaries.begin(), boundaries.end(), c);
+        return interval_classes[static_cast<std::size_t>(it - boundaries.begin()) - 1];
+    }
+}
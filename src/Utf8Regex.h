@@ -0,0 +1,201 @@
+/** The regular expression engine for UTF-8 strings.
+    \file Utf8Regex.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_SRC_UTF8REGEX_H_
+#define TPHRASE_SRC_UTF8REGEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tphrase {
+    /** The regular expression that matches the code points in a UTF-8 string.
+
+        The pattern is a subset of the ECMAScript regex grammar, and it's compiled into a program for the Pike VM. The program is also converted into a DFA on the equivalence classes of the code points if possible, and the DFA finds the region to run the Pike VM. The DFA looks up the class of an ASCII character by a table, so it scans an ASCII string byte by byte.
+    */
+    class Utf8Regex {
+    public:
+        /** The type of the sorted and disjoint ranges of the code points. */
+        using CodeRanges_t = std::vector<std::pair<char32_t, char32_t>>;
+
+        /** The kind of the instruction. */
+        enum class Op_t : unsigned char {
+            SET, /**< Consume a code point in sets[x]. */
+            SPLIT, /**< Continue at x, and then at y with a lower priority. */
+            JMP, /**< Continue at x. */
+            SAVE, /**< Save the position to the slot x. */
+            RESET, /**< Reset the slots from x to y - 1. */
+            PROGRESS, /**< Continue if the position differs from the slot x. */
+            ASSERT, /**< Continue if the assertion x is true at the position. */
+            MATCH, /**< The pattern is matched. */
+        };
+
+        /** The kind of the assertion. */
+        enum class Assertion_t : std::uint32_t {
+            BEGIN, /**< "^" */
+            END, /**< "$" */
+            WORD_BOUNDARY, /**< "\b" */
+            NOT_WORD_BOUNDARY, /**< "\B" */
+        };
+
+        /** The instruction for the Pike VM. */
+        struct Inst_t {
+            Op_t op; /**< The kind of the instruction. */
+            std::uint32_t x; /**< The first operand. */
+            std::uint32_t y; /**< The second operand. */
+        };
+
+        /** The working memory for search(). It can be reused by the searches in a thread. */
+        struct Workspace_t {
+            /** The list of the threads for the Pike VM. */
+            struct ThreadList_t {
+                std::vector<std::uint32_t> pcs; /**< The program counters in the order of the priority. */
+                std::vector<std::size_t> slots; /**< The slots of the threads. */
+            };
+            /** The entry of the stack to add the threads. */
+            struct Entry_t {
+                std::uint32_t pc; /**< The program counter, or the slot to restore if restore is true. */
+                bool restore; /**< Restore the slot? */
+                std::size_t value; /**< The value to restore. */
+            };
+
+            /** The constructor. */
+            Workspace_t();
+
+            std::vector<std::uint32_t> marks; /**< The generation when each instruction was visited last. */
+            std::uint32_t generation; /**< The current generation. */
+            ThreadList_t current; /**< The threads at the current position. */
+            ThreadList_t next; /**< The threads at the next position. */
+            std::vector<std::size_t> slots; /**< The slots of the thread being added. */
+            std::vector<Entry_t> stack; /**< The stack to add the threads. */
+        };
+
+        /** The position that means "not captured." */
+        static constexpr std::size_t NPOS{static_cast<std::size_t>(-1)};
+
+        Utf8Regex() = delete;
+        /** The constructor.
+            \param [in] pattern The pattern.
+            \throw std::runtime_error if the pattern is invalid or unsupported.
+        */
+        explicit Utf8Regex(const std::string &pattern);
+        /** The copy constructor.
+            \param [in] a The source.
+        */
+        Utf8Regex(const Utf8Regex &a) = default;
+        /** The move constructor.
+            \param [inout] a The source. (moved)
+        */
+        Utf8Regex(Utf8Regex &&a) = default;
+
+        /** The assignment.
+            \param [in] a The source.
+            \return *this
+        */
+        Utf8Regex &operator=(const Utf8Regex &a) = default;
+        /** The move assignment.
+            \param [inout] a The source. (moved)
+            \return *this
+        */
+        Utf8Regex &operator=(Utf8Regex &&a) = default;
+
+        /** Get the number of the capturing groups.
+            \return The number of the capturing groups.
+        */
+        std::size_t get_group_number() const;
+
+        /** Search the leftmost match.
+            \param [in] s The UTF-8 string.
+            \param [in] start The position where the search starts.
+            \param [out] captures The pairs of the start and the end position of the match and the capturing groups. NPOS means the group didn't participate in the match.
+            \param [inout] ws The working memory.
+            \return true if it's matched.
+            \note start must be at the boundary of the code points.
+        */
+        bool search(const std::string &s, std::size_t start, std::vector<std::size_t> &captures, Workspace_t &ws) const;
+
+    private:
+        /** Build the DFA out of the program if possible. */
+        void build_dfa();
+        /** Search the leftmost match by the DFA.
+            \param [in] s The UTF-8 string.
+            \param [in] start The position where the search starts.
+            \param [out] from The position where the match can start at the earliest.
+            \return true if it's matched.
+        */
+        bool search_by_dfa(const std::string &s, std::size_t start, std::size_t &from) const;
+        /** Search the leftmost match by the Pike VM.
+            \param [in] s The UTF-8 string.
+            \param [in] start The position where the search starts.
+            \param [out] captures The pairs of the start and the end position of the match and the capturing groups.
+            \param [inout] ws The working memory.
+            \return true if it's matched.
+        */
+        bool search_by_nfa(const std::string &s, std::size_t start, std::vector<std::size_t> &captures, Workspace_t &ws) const;
+        /** Is a code point in a set?
+            \param [in] set The index of the set.
+            \param [in] c The code point.
+            \return true if c is in sets[set].
+        */
+        bool is_in_set(std::uint32_t set, char32_t c) const;
+        /** Get the equivalence class of a code point in the DFA.
+            \param [in] c The code point.
+            \return The equivalence class.
+        */
+        std::uint32_t get_class(char32_t c) const;
+
+        std::vector<Inst_t> program; /**< The program for the Pike VM. */
+        std::vector<CodeRanges_t> sets; /**< The sets of the code points used by the program. */
+        std::size_t num_groups; /**< The number of the capturing groups. */
+        std::size_t num_slots; /**< The number of the slots for the captures and the progress checks. */
+
+        bool has_dfa; /**< Is the DFA available? */
+        std::uint32_t ascii_classes[128]; /**< The equivalence class of each ASCII character. */
+        std::vector<char32_t> boundaries; /**< The first code points of the intervals whose code points are in the same class. */
+        std::vector<std::uint32_t> interval_classes; /**< interval_classes[i] is the class of the interval starting at boundaries[i]. */
+        std::size_t num_classes; /**< The number of the equivalence classes. */
+        std::vector<std::uint32_t> transitions; /**< transitions[s + c] is the next state from s by a code point in the class c, with the flags. A state is the index of the first transition from it. */
+        std::vector<std::uint32_t> accepts; /**< The flags of the acceptance of each state, indexed by the state / num_classes. */
+        std::uint32_t start_states[2]; /**< The initial state at the middle of the string, and at the beginning of the string. */
+        std::uint32_t dead_state; /**< The state that never matches. */
+        unsigned char idle_bytes[256]; /**< Is the byte an ASCII character that keeps the initial state at the middle of the string without any match? (1 or 0) */
+    };
+}
+
+#endif // TPHRASE_SRC_UTF8REGEX_H_
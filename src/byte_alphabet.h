@@ -0,0 +1,75 @@
+/** The set of the bytes that a text can contain.
+    \file byte_alphabet.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_SRC_BYTE_ALPHABET_H_
+#define TPHRASE_SRC_BYTE_ALPHABET_H_
+
+#include <bitset>
+#include <string>
+
+namespace tphrase {
+    /** The type of the set of the bytes that a text can contain. */
+    using ByteAlphabet_t = std::bitset<256>;
+
+    /** Add the bytes in a string into a set.
+        \param [inout] alphabet The set of the bytes.
+        \param [in] s The string.
+    */
+    inline void add_bytes(ByteAlphabet_t &alphabet, const std::string &s)
+    {
+        for (const char c : s) {
+            alphabet.set(static_cast<unsigned char>(c));
+        }
+    }
+
+    /** Does a set contain all the bytes in a string?
+        \param [in] alphabet The set of the bytes.
+        \param [in] s The string.
+        \return true if alphabet contains all the bytes in s.
+    */
+    inline bool has_all_bytes(const ByteAlphabet_t &alphabet, const std::string &s)
+    {
+        for (const char c : s) {
+            if (!alphabet.test(static_cast<unsigned char>(c))) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+#endif // TPHRASE_SRC_BYTE_ALPHABET_H_
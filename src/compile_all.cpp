@@ -0,0 +1,133 @@
+/** The parallel compilation of many phrase syntaxes.
+    \file compile_all.cpp
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "tphrase/compile_all.h"
+
+namespace {
+    /** Create the instances in parallel.
+        \tparam T The type of the instance.
+        \tparam F The type of the function to create an instance.
+        \param [in] num The number of the instances.
+        \param [in] threads The maximum number of the threads. If it's 0, std::thread::hardware_concurrency() is used.
+        \param [in] create The function T(std::size_t) to create the i-th instance.
+        \return The instances in the order of the index.
+        \note The first exception thrown by create is rethrown after all the threads finish.
+    */
+    template<typename T, typename F>
+    std::vector<T> create_in_parallel(const std::size_t num, std::size_t threads, const F &create)
+    {
+        std::vector<T> result(num);
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
+        }
+        if (threads > num) {
+            threads = num;
+        }
+        if (threads <= 1) {
+            for (std::size_t i = 0; i < num; ++i) {
+                result[i] = create(i);
+            }
+            return result;
+        }
+
+        std::atomic<std::size_t> next{0};
+        std::vector<std::exception_ptr> errors(threads);
+        const auto work = [&](const std::size_t id) {
+            try {
+                for (std::size_t i = next++; i < num; i = next++) {
+                    result[i] = create(i);
+                }
+            } catch (...) {
+                errors[id] = std::current_exception();
+                // The other threads take over the rest.
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+        try {
+            for (std::size_t id = 1; id < threads; ++id) {
+                workers.emplace_back(work, id);
+            }
+        } catch (const std::system_error &) {
+            // The threads already created take over the rest.
+        }
+        work(0);
+        for (auto &w : workers) {
+            w.join();
+        }
+        for (const auto &e : errors) {
+            if (e) {
+                std::rethrow_exception(e);
+            }
+        }
+        return result;
+    }
+}
+
+namespace tphrase {
+    std::vector<Syntax> compile_all(const std::vector<std::string> &sources,
+                                    const std::size_t threads,
+                                    const Config_t &config)
+    {
+        return create_in_parallel<Syntax>(sources.size(), threads, [&](const std::size_t i) -> Syntax {
+            Syntax syntax{config};
+            syntax.add(sources[i]);
+            return syntax;
+        });
+    }
+
+    std::vector<Generator> compile_all_generators(const std::vector<std::string> &sources,
+                                                  const std::size_t threads,
+                                                  const Config_t &config)
+    {
+        return create_in_parallel<Generator>(sources.size(), threads, [&](const std::size_t i) -> Generator {
+            Syntax syntax{config};
+            syntax.add(sources[i]);
+            return Generator{std::move(syntax)};
+        });
+    }
+}
@@ -0,0 +1,197 @@
+/** The process-wide cache of the gsub functions.
+    \file gsub_cache.cpp
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "gsub_cache.h"
+
+namespace {
+    /** The type of the gsub creator whose identity is known. */
+    using Creator_t = tphrase::GsubFunc_t (*)(const std::string &, const std::string &, bool);
+
+    /** The default maximum number of the gsub functions in the cache. */
+    constexpr std::size_t DEFAULT_CAPACITY{1024};
+
+    /** The key of the cache. */
+    struct Key_t {
+        Creator_t creator; /**< The function that creates the gsub function. */
+        std::string pattern; /**< The pattern parameter of gsub. */
+        std::string repl; /**< The replacement parameter of gsub. */
+        bool global; /**< The global parameter of gsub. */
+
+        /** Equality.
+            \param [in] a The other key.
+            \return true if the keys are the same.
+        */
+        bool operator==(const Key_t &a) const
+        {
+            return creator == a.creator
+                && global == a.global
+                && pattern == a.pattern
+                && repl == a.repl;
+        }
+    };
+
+    /** The hash function of the key. */
+    struct KeyHash_t {
+        /** Calculate the hash value.
+            \param [in] key The key.
+            \return The hash value.
+        */
+        std::size_t operator()(const Key_t &key) const
+        {
+            std::size_t h{std::hash<std::string>{}(key.pattern)};
+            h = h * 31 + std::hash<std::string>{}(key.repl);
+            h = h * 31 + std::hash<Creator_t>{}(key.creator);
+            return h * 2 + (key.global ? 1 : 0);
+        }
+    };
+
+    /** The type of the entry in the cache, in the order of the recent use. */
+    using Entries_t = std::list<std::pair<Key_t, std::shared_ptr<const tphrase::GsubFunc_t>>>;
+
+    /** The cache of the gsub functions. */
+    struct Cache_t {
+        std::mutex mutex; /**< The mutex for all the members. */
+        Entries_t entries; /**< The entries, the most recently used first. */
+        std::unordered_map<Key_t, Entries_t::iterator, KeyHash_t> index; /**< The index to the entries. */
+        tphrase::GsubCacheStats_t stats{0, 0, 0, 0, 0, DEFAULT_CAPACITY}; /**< The statistics. */
+
+        /** Remove the least recently used entries to keep the capacity.
+            \note The caller must lock the mutex.
+        */
+        void shrink()
+        {
+            while (entries.size() > stats.capacity) {
+                index.erase(entries.back().first);
+                entries.pop_back();
+                ++stats.evictions;
+            }
+            stats.size = entries.size();
+        }
+    };
+
+    /** Get the cache.
+        \return The cache.
+        \note It's created at the first use because a Syntax may be parsed at the static initialization.
+    */
+    Cache_t &get_cache()
+    {
+        static Cache_t cache;
+        return cache;
+    }
+}
+
+namespace tphrase {
+
+    extern std::shared_ptr<const GsubFunc_t> get_gsub_function(const GsubFuncCreator_t &creator,
+                                                               const std::string &pattern,
+                                                               const std::string &repl,
+                                                               const bool global)
+    {
+        Cache_t &cache{get_cache()};
+        const Creator_t *f{creator.target<Creator_t>()};
+        {
+            std::lock_guard<std::mutex> lock{cache.mutex};
+            if (f == nullptr || cache.stats.capacity == 0) {
+                ++cache.stats.uncached;
+                f = nullptr;
+            } else {
+                const auto it = cache.index.find(Key_t{*f, pattern, repl, global});
+                if (it != cache.index.end()) {
+                    ++cache.stats.hits;
+                    cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+                    return it->second->second;
+                }
+            }
+        }
+
+        // The creator is called without the lock because it may be slow.
+        std::shared_ptr<const GsubFunc_t> func{std::make_shared<const GsubFunc_t>(creator(pattern, repl, global))};
+        if (f == nullptr) {
+            return func;
+        }
+
+        std::lock_guard<std::mutex> lock{cache.mutex};
+        Key_t key{*f, pattern, repl, global};
+        const auto it = cache.index.find(key);
+        if (it != cache.index.end()) {
+            // Another thread has created it in the meantime.
+            ++cache.stats.hits;
+            cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+            return it->second->second;
+        }
+        ++cache.stats.misses;
+        if (cache.stats.capacity > 0) {
+            cache.entries.emplace_front(key, func);
+            cache.index.emplace(std::move(key), cache.entries.begin());
+            cache.shrink();
+        }
+        return func;
+    }
+
+    extern void set_gsub_cache_capacity(const std::size_t capacity)
+    {
+        Cache_t &cache{get_cache()};
+        std::lock_guard<std::mutex> lock{cache.mutex};
+        cache.stats.capacity = capacity;
+        cache.shrink();
+    }
+
+    extern GsubCacheStats_t get_gsub_cache_stats()
+    {
+        Cache_t &cache{get_cache()};
+        std::lock_guard<std::mutex> lock{cache.mutex};
+        return cache.stats;
+    }
+
+    extern void clear_gsub_cache()
+    {
+        Cache_t &cache{get_cache()};
+        std::lock_guard<std::mutex> lock{cache.mutex};
+        cache.index.clear();
+        cache.entries.clear();
+        cache.stats = GsubCacheStats_t{0, 0, 0, 0, 0, cache.stats.capacity};
+    }
+}
@@ -0,0 +1,78 @@
+/** The process-wide cache of the gsub functions.
+    \file gsub_cache.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_SRC_GSUB_CACHE_H_
+#define TPHRASE_SRC_GSUB_CACHE_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "tphrase/common/gsub_func.h"
+
+namespace tphrase {
+    /** Create a gsub function, or get the one created with the same parameters.
+        \param [in] creator The function to create the gsub functions.
+        \param [in] pattern The pattern parameter of gsub.
+        \param [in] repl The replacement parameter of gsub.
+        \param [in] global The global parameter of gsub.
+        \return The gsub function shared by all the users of the same parameters.
+        \note Only the gsub functions created by the creator that is a plain function are cached, because the identity of other creators is unknown.
+        \note It may throw an exception that the creator throws. The failures are not cached.
+        \note It's thread-safe, but the creator may be called concurrently for the different parameters.
+    */
+    extern std::shared_ptr<const GsubFunc_t> get_gsub_function(const GsubFuncCreator_t &creator,
+                                                               const std::string &pattern,
+                                                               const std::string &repl,
+                                                               bool global);
+
+    /** Set the maximum number of the gsub functions in the cache.
+        \param [in] capacity The maximum number. The cache is disabled if it's zero.
+        \note The least recently used gsub functions are removed from the cache if it's full. The removed functions are alive while they are used.
+    */
+    extern void set_gsub_cache_capacity(std::size_t capacity);
+
+    /** Get the statistics of the cache.
+        \return The statistics of the cache.
+    */
+    extern GsubCacheStats_t get_gsub_cache_stats();
+
+    /** Remove all the gsub functions from the cache and reset the statistics. */
+    extern void clear_gsub_cache();
+}
+
+#endif // TPHRASE_SRC_GSUB_CACHE_H_
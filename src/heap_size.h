@@ -0,0 +1,128 @@
+/** The estimation of the memory allocated by the data structures.
+    \file heap_size.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_SRC_HEAP_SIZE_H_
+#define TPHRASE_SRC_HEAP_SIZE_H_
+
+#include <cstddef>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "tphrase/common/memory_usage.h"
+#include "Arena.h"
+
+namespace tphrase {
+    /** The estimated number of the bytes of the control block of the object created by std::make_shared. */
+    constexpr std::size_t SHARED_OBJECT_OVERHEAD{sizeof(void *) + 2 * sizeof(int)};
+
+    /** Get the number of the bytes allocated by a string.
+        \param [in] s The string.
+        \return The number of the bytes, which is 0 if the characters are stored in the string object itself.
+    */
+    inline std::size_t get_heap_size(const std::string &s)
+    {
+        const char *object{reinterpret_cast<const char *>(&s)};
+        const char *data{s.data()};
+        if (data >= object && data < object + sizeof(s)) {
+            return 0;
+        }
+        return s.capacity() + 1;
+    }
+
+    /** Get the number of the bytes allocated by the strings in a vector.
+        \param [in] v The vector.
+        \return The number of the bytes, including the array of the strings.
+    */
+    template <typename T>
+    std::size_t get_heap_size(const std::vector<std::string, T> &v)
+    {
+        std::size_t size{v.capacity() * sizeof(std::string)};
+        for (const auto &s : v) {
+            size += get_heap_size(s);
+        }
+        return size;
+    }
+
+    /** The accumulator of the memory usage, which counts the shared objects once. */
+    class MemoryCounter {
+    public:
+        MemoryUsage_t usage; /**< The accumulated memory usage, except for MemoryUsage_t::arena_slack. */
+
+        /** Check whether the shared object is counted for the first time.
+            \param [in] p The shared object.
+            \return true if p is not counted yet. p is marked as counted.
+        */
+        bool is_first(const void *p)
+        {
+            return counted.insert(p).second;
+        }
+        /** Get the number of the bytes of the elements allocated by a vector, and count the arena used by it.
+            \param [in] v The vector.
+            \return The number of the bytes, excluding the objects that the elements own.
+        */
+        template <typename T>
+        std::size_t get_capacity_size(const ArenaVector_t<T> &v)
+        {
+            const std::size_t size{v.capacity() * sizeof(T)};
+            const Arena *arena{v.get_allocator().get_arena()};
+            if (arena != nullptr) {
+                if (is_first(arena)) {
+                    arena_size += arena->get_size();
+                }
+                arena_used += size;
+            }
+            return size;
+        }
+        /** Get the result.
+            \return The accumulated memory usage, including the slack of the arenas.
+        */
+        MemoryUsage_t get_usage() const
+        {
+            MemoryUsage_t result{usage};
+            result.arena_slack = arena_size > arena_used ? arena_size - arena_used : 0;
+            return result;
+        }
+
+    private:
+        std::unordered_set<const void *> counted; /**< The shared objects already counted. */
+        std::size_t arena_size{0}; /**< The total size of the arenas counted. */
+        std::size_t arena_used{0}; /**< The bytes of the arenas used by the vectors counted. */
+    };
+}
+
+#endif // TPHRASE_SRC_HEAP_SIZE_H_
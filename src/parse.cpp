@@ -35,6 +35,8 @@
     \endparblock
 */
 
+#include <cstddef>
+#include <functional>
 #include <limits>
 #include <locale>
 #include <stdexcept>
@@ -42,6 +44,7 @@
 #include <utility>
 
 #include "tphrase/common/InputIterator.h"
+#include "tphrase/common/config.h"
 #include "CharFeeder.h"
 #include "DataGsubs.h"
 #include "DataOptions.h"
@@ -51,44 +54,47 @@
 #include "parse.h"
 
 namespace {
-    /** An exception for the parse error.
-
-        parse() catches the exception, and handles it.
-    */
-    class ParseError : public std::runtime_error {
-    public:
-        /** The constructor.
-            \param [in] what_arg The explanation of the exception.
-        */
-        explicit ParseError(const std::string &what_arg);
-    };
-
     // Introduce some tphrase types into the local namespace.
     using CharFeeder = tphrase::CharFeeder;
+    using Config_t = tphrase::Config_t;
     using DataGsubs = tphrase::DataGsubs;
     using DataOptions = tphrase::DataOptions;
     using DataProductionRule = tphrase::DataProductionRule;
     using DataSyntax = tphrase::DataSyntax;
     using DataText = tphrase::DataText;
+    using AssignmentSpan_t = tphrase::AssignmentSpan_t;
+    using Symbol = tphrase::Symbol;
 
     // Forward declarations
-    void skip_space_nl(CharFeeder &it);
-    void parse_assignment(CharFeeder &it, DataSyntax &syntax);
-}
-
-namespace tphrase {
-
-    extern
-    DataSyntax parse(InputIteratorBase &p, std::vector<std::string> &err_msg)
+    bool parse_assignment(CharFeeder &it, const Config_t &config,
+                          const tphrase::ParsedAssignmentSink_t &sink,
+                          std::vector<AssignmentSpan_t> *spans,
+                          std::string &err);
+
+    /** Parse the assignments one by one.
+        \param [inout] p The source text.
+        \param [inout] err_msg The error messages are added if some errors are detected.
+        \param [in] config The configuration to create the gsub functions.
+        \param [in] sink The function to receive each assignment.
+        \param [out] spans The ranges of the assignments are added if it's not nullptr.
+        \note The assignment that has an error is skipped by the newline that doesn't continue the line.
+    */
+    void parse_assignments(tphrase::InputIteratorBase &p, std::vector<std::string> &err_msg,
+                           const Config_t &config,
+                           const tphrase::ParsedAssignmentSink_t &sink,
+                           std::vector<AssignmentSpan_t> *spans)
     {
-        DataSyntax syntax;
         CharFeeder it{p};
 
         while (!it.is_end()) {
-            try {
-                parse_assignment(it, syntax);
-            } catch (const ParseError &e) {
-                err_msg.emplace_back(e.what());
+            std::string err;
+            const bool cont{parse_assignment(it, config, sink, spans, err)};
+            if (err.empty()) {
+                if (!cont) {
+                    break;
+                }
+            } else {
+                err_msg.emplace_back(std::move(err));
                 // Recovering from the error
                 bool cont_line{false};
                 for (; !it.is_end(); it.next()) {
@@ -105,48 +111,87 @@ namespace tphrase {
                 }
             }
         }
+    }
+}
+
+namespace tphrase {
+
+    extern
+    DataSyntax parse(InputIteratorBase &p, std::vector<std::string> &err_msg,
+                     const Config_t &config,
+                     std::vector<AssignmentSpan_t> *spans)
+    {
+        DataSyntax syntax;
+        parse_assignments(p, err_msg, config, [&syntax](const Symbol &nonterminal, DataProductionRule &&rule, std::string &msg) {
+            syntax.add(nonterminal, std::move(rule), msg);
+            return true;
+        }, spans);
         syntax.fix_local_nonterminal(err_msg);
         return syntax;
     }
+
+    extern
+    void parse_each(InputIteratorBase &p, std::vector<std::string> &err_msg,
+                    const Config_t &config,
+                    const ParsedSyntaxSink_t &sink)
+    {
+        // Only the local nonterminals are kept to copy them with the following assignments that refer to them.
+        DataSyntax locals;
+        parse_assignments(p, err_msg, config, [&](const Symbol &nonterminal, DataProductionRule &&rule, std::string &msg) {
+            const std::size_t num_errors{err_msg.size()};
+            rule.check_local_nonterminal(locals, err_msg);
+            if (err_msg.size() != num_errors) {
+                return true; // The assignment that refers to an undefined local nonterminal is skipped.
+            }
+            if (locals.is_local_nonterminal(nonterminal)) {
+                locals.add(nonterminal, std::move(rule), msg);
+                return true;
+            }
+            DataSyntax assignment;
+            assignment.add(nonterminal, std::move(rule), msg);
+            assignment.copy_local_nonterminals(locals);
+            return sink(nonterminal, std::move(assignment), msg);
+        }, nullptr);
+    }
 }
 
 namespace {
-    /** Utility function to generate a ParseError exception.
+    /** Utility function to set a parse error.
         \param [in] it The error position.
         \param [in] msg The error message.
-        \note It throws an exception, so doesn't return.
+        \param [out] err The error message with the position.
+        \note The parse functions return as soon as err is set, and parse_assignments() recovers from the error.
     */
-    void throw_parse_error(CharFeeder &it, const std::string &msg)
+    void set_parse_error(const CharFeeder &it, const std::string &msg, std::string &err)
     {
-        std::string e{"Line#"};
-        e += std::to_string(it.get_line_number());
-        e += ", Column#";
-        e += std::to_string(it.get_column_number());
-        e += ": ";
-        e += msg;
-        throw ParseError(e);
+        err = "Line#";
+        err += std::to_string(it.get_line_number());
+        err += ", Column#";
+        err += std::to_string(it.get_column_number());
+        err += ": ";
+        err += msg;
     }
 
     /** Skip spaces.
         \param [inout] it The character feeder.
+        \param [out] err The error message is set if an error is detected.
         \param [in] en_nl Skip also the newlines if en_nl is true.
     */
     /*
       space_opt = [ { space } ] ;
       space = " " | "\t" | ( "{*", [ { ? [^}] ? } ], "}" ) ;
     */
-    void skip_space(CharFeeder &it, const bool en_nl = false)
+    void skip_space(CharFeeder &it, std::string &err, const bool en_nl = false)
     {
         while (!it.is_end()) {
             const char c{it.getc()};
             if (c == '{' && it.get_nextc() == '*') {
                 it.next();
                 it.next();
-                while (!it.is_end() && it.getc() != '}') {
-                    it.next();
-                }
+                it.skip_until("}", 1);
                 if (it.is_end()) {
-                    throw_parse_error(it, "The end of the comment is expected.");
+                    set_parse_error(it, "The end of the comment is expected.", err);
+                    return;
                 }
             } else if (!(c == ' ' || c == '\t' || (en_nl && c == '\n'))) {
                 break;
@@ -157,28 +202,30 @@ namespace {
 
     /** Skip spaces and newlines.
         \param [inout] it The character feeder.
+        \param [out] err The error message is set if an error is detected.
     */
     /*
       space_nl_opt = [ { space | nl } ] ;
       nl = "\n" ;
     */
-    void skip_space_nl(CharFeeder &it)
+    void skip_space_nl(CharFeeder &it, std::string &err)
     {
-        skip_space(it, true);
+        skip_space(it, err, true);
     }
 
     /** Skip spaces and a newline.
         \param [inout] it The character feeder.
+        \param [out] err The error message is set if an error is detected.
     */
     /*
       space_one_nl_opt = space_opt, [ nl, space_opt ] ;
     */
-    void skip_space_one_nl(CharFeeder &it)
+    void skip_space_one_nl(CharFeeder &it, std::string &err)
     {
-        skip_space(it);
-        if (it.getc() == '\n') {
+        skip_space(it, err);
+        if (err.empty() && it.getc() == '\n') {
             it.next();
-            skip_space(it);
+            skip_space(it, err);
         }
     }
 
@@ -192,68 +239,96 @@ namespace {
     }
 
     // Forward declarations
-    std::string parse_nonterminal(CharFeeder &it);
-    double parse_weight(CharFeeder &it);
-    char parse_operator(CharFeeder &it);
-    DataProductionRule parse_production_rule(CharFeeder &it, char term_char = '\0');
+    std::string parse_nonterminal(CharFeeder &it, std::string &err);
+    double parse_weight(CharFeeder &it, std::string &err);
+    char parse_operator(CharFeeder &it, std::string &err);
+    DataProductionRule parse_production_rule(CharFeeder &it, const Config_t &config, std::string &err, char term_char = '\0');
 
     /** Parse an assignment.
         \param [inout] it The character feeder.
-        \param [inout] syntax The syntax into which the assignment is added.
+        \param [in] config The configuration to create the gsub functions.
+        \param [in] sink The function to receive the assignment.
+        \param [out] spans The range of the assignment is added if it's not nullptr.
+        \param [out] err The error message is set if an error is detected.
+        \return false if the sink stops parsing.
     */
     /*
       start = space_nl_opt, [ { assignment, space_nl_opt } ], $ ;
       assignment = nonterminal, space_opt, [ weight, space_opt ], operator, space_one_nl_opt, production_rule, ( nl | $ ) ; (* One of spaces before weight is necessary because nonterminal consumes the numeric character and the period. *)
     */
-    void parse_assignment(CharFeeder &it, DataSyntax &syntax)
+    bool parse_assignment(CharFeeder &it, const Config_t &config,
+                          const tphrase::ParsedAssignmentSink_t &sink,
+                          std::vector<AssignmentSpan_t> *spans,
+                          std::string &err)
     {
-        skip_space_nl(it);
-        if (it.is_end()) {
-            return;
+        const std::size_t begin{it.get_offset()};
+        skip_space_nl(it, err);
+        if (!err.empty() || it.is_end()) {
+            return true;
+        }
+        const Symbol nonterminal{parse_nonterminal(it, err)};
+        if (!err.empty()) {
+            return true;
+        }
+        skip_space(it, err);
+        if (!err.empty()) {
+            return true;
+        }
+        const double weight = parse_weight(it, err);
+        if (!err.empty()) {
+            return true;
+        }
+        skip_space(it, err);
+        if (!err.empty()) {
+            return true;
+        }
+        const char op_type{parse_operator(it, err)};
+        if (!err.empty()) {
+            return true;
+        }
+        skip_space_one_nl(it, err);
+        if (!err.empty()) {
+            return true;
         }
-        std::string nonterminal{parse_nonterminal(it)};
-        skip_space(it);
-        const double weight = parse_weight(it);
-        skip_space(it);
-        const char op_type{parse_operator(it)};
-        skip_space_one_nl(it);
-        DataProductionRule rule{parse_production_rule(it)};
+        const DataProductionRule parsed{parse_production_rule(it, config, err)};
+        if (!err.empty()) {
+            return true;
+        }
+        // The production rule has its own arena, which is released as soon as the assignment is removed or replaced.
+        DataProductionRule rule{parsed.copy_in_arena()};
         rule.set_weight(weight);
-        if (it.is_end() || it.getc() == '\n') {
-            if (op_type == ':') {
-                rule.equalize_chance(true);
-            }
-            std::string err_msg;
-            syntax.add(std::move(nonterminal), std::move(rule), err_msg);
-            if (!err_msg.empty()) {
-                throw_parse_error(it, err_msg);
-            }
-        } else {
-            throw_parse_error(it, "The end of the text or \"\\n\" is expected.");
+        if (!(it.is_end() || it.getc() == '\n')) {
+            set_parse_error(it, "The end of the text or \"\\n\" is expected.", err);
+            return true;
+        }
+        if (op_type == ':') {
+            rule.equalize_chance(true);
+        }
+        if (spans) {
+            spans->emplace_back(AssignmentSpan_t{nonterminal, begin, it.get_offset()});
         }
+        std::string msg;
+        const bool cont{sink(nonterminal, std::move(rule), msg)};
+        if (!msg.empty()) {
+            set_parse_error(it, msg, err);
+        }
+        return cont;
     }
 
     /** Parse a nonterminal.
         \param [inout] it The character feeder.
+        \param [out] err The error message is set if an error is detected.
         \return The nonterminal.
     */
     /*
       nonterminal = { ? [A-Za-z0-9_.] ? } ;
     */
-    std::string parse_nonterminal(CharFeeder &it)
+    std::string parse_nonterminal(CharFeeder &it, std::string &err)
     {
         std::string nonterminal;
-        while (!it.is_end()) {
-            const char c{it.getc()};
-            if (is_nonterminal_char(c)) {
-                nonterminal += c;
-                it.next();
-            } else {
-                break;
-            }
-        }
+        it.read_while(nonterminal, is_nonterminal_char);
         if (nonterminal.empty()) {
-            throw_parse_error(it, "A nonterminal \"[A-Za-z0-9_.]+\" is expected.");
+            set_parse_error(it, "A nonterminal \"[A-Za-z0-9_.]+\" is expected.", err);
         }
         return nonterminal;
     }
@@ -269,12 +344,13 @@ namespace {
 
     /** Parse a weight number.
         \param [inout] it The character feeder.
+        \param [out] err The error message is set if an error is detected.
         \return weight number if weight is specified, or NaN.
     */
     /*
       weight = ( ( { ? [0-9] ? }, [ "." ] ) | ( ".", ? [0-9] ? ) ), [ { ? [0-9] ? } ] ;
     */
-    double parse_weight(CharFeeder &it)
+    double parse_weight(CharFeeder &it, std::string &err)
     {
         std::string s;
         char c{it.getc()};
@@ -287,7 +363,8 @@ namespace {
                 it.next();
                 c = it.getc();
             } else {
-                throw_parse_error(it, "A number is expected. (\".\" is not a number.)");
+                set_parse_error(it, "A number is expected. (\".\" is not a number.)", err);
+                return std::numeric_limits<double>::quiet_NaN();
             }
         } else if (is_decimal_number_char(c)) {
             do {
@@ -313,12 +390,13 @@ namespace {
 
     /** Parse an operator.
         \param [inout] it The character feeder.
+        \param [out] err The error message is set if an error is detected.
         \return ":" if the operator is ":=", or "=".
     */
     /*
       operator = "=" | ":=" ;
     */
-    char parse_operator(CharFeeder &it)
+    char parse_operator(CharFeeder &it, std::string &err)
     {
         const char c{it.getc()};
         if (c == '=') {
@@ -330,76 +408,95 @@ namespace {
                 it.next();
                 return ':';
             } else {
-                throw_parse_error(it, "\"=\" is expected.");
+                set_parse_error(it, "\"=\" is expected.", err);
             }
         } else {
-            throw_parse_error(it, "\"=\" or \":=\" is expected.");
+            set_parse_error(it, "\"=\" or \":=\" is expected.", err);
         }
         return c;
     }
 
     // Forward declarations
-    DataOptions parse_options(CharFeeder &it);
-    DataGsubs parse_gsubs(CharFeeder &it);
+    DataOptions parse_options(CharFeeder &it, const Config_t &config, std::string &err);
+    DataGsubs parse_gsubs(CharFeeder &it, const Config_t &config, std::string &err);
 
     /** Parse a production rule.
         \param [inout] it The character feeder.
+        \param [in] config The configuration to create the gsub functions.
+        \param [out] err The error message is set if an error is detected.
         \param [in] term_char The expected character after the production rule. If it's '\0', no special character is expected.
         \return The production rule.
     */
     /*
       production_rule = options, gsubs ;
     */
-    DataProductionRule parse_production_rule(CharFeeder &it, const char term_char)
+    DataProductionRule parse_production_rule(CharFeeder &it, const Config_t &config, std::string &err, const char term_char)
     {
-        DataOptions options{parse_options(it)};
-        DataGsubs gsubs{parse_gsubs(it)};
+        DataOptions options{parse_options(it, config, err)};
+        DataGsubs gsubs;
+        if (err.empty()) {
+            gsubs = parse_gsubs(it, config, err);
+        }
         DataProductionRule rule{std::move(options), std::move(gsubs)};
-        if (term_char != '\0') {
-            skip_space_nl(it);
+        if (err.empty() && term_char != '\0') {
+            skip_space_nl(it, err);
+            if (!err.empty()) {
+                return rule;
+            }
             if (it.getc() == term_char) {
                 it.next();
             } else {
                 std::string s{"\""};
                 s += term_char;
                 s += "\" is expected.";
-                throw_parse_error(it, s);
+                set_parse_error(it, s, err);
             }
         }
         return rule;
     }
 
     // Forward declaration
-    DataText parse_text(CharFeeder &it);
+    DataText parse_text(CharFeeder &it, const Config_t &config, std::string &err);
 
     /** Parse an options.
         \param [inout] it The character feeder.
+        \param [in] config The configuration to create the gsub functions.
+        \param [out] err The error message is set if an error is detected.
         \return The options.
     */
     /*
       options = text, space_opt, [ { "|", space_one_nl_opt, text, space_opt } ] ;
     */
-    DataOptions parse_options(CharFeeder &it)
+    DataOptions parse_options(CharFeeder &it, const Config_t &config, std::string &err)
     {
         DataOptions options;
-        options.add_text(parse_text(it));
-        skip_space(it);
-        while (it.getc() == '|') {
+        options.add_text(parse_text(it, config, err));
+        if (err.empty()) {
+            skip_space(it, err);
+        }
+        while (err.empty() && it.getc() == '|') {
             it.next();
-            skip_space_one_nl(it);
-            options.add_text(parse_text(it));
-            skip_space(it);
+            skip_space_one_nl(it, err);
+            if (!err.empty()) {
+                break;
+            }
+            options.add_text(parse_text(it, config, err));
+            if (err.empty()) {
+                skip_space(it, err);
+            }
         }
         return options;
     }
 
     // Forward declarations
-    DataText parse_quoted_text(CharFeeder &it);
-    DataText parse_non_quoted_text(CharFeeder &it);
-    void parse_expansion(CharFeeder &it, DataText &text, std::string &s);
+    DataText parse_quoted_text(CharFeeder &it, const Config_t &config, std::string &err);
+    DataText parse_non_quoted_text(CharFeeder &it, const Config_t &config, std::string &err);
+    void parse_expansion(CharFeeder &it, const Config_t &config, DataText &text, std::string &s, std::string &err);
 
     /** Parse a text.
         \param [inout] it The character feeder.
+        \param [in] config The configuration to create the gsub functions.
+        \param [out] err The error message is set if an error is detected.
         \return The text.
     */
     /*
@@ -411,7 +508,7 @@ namespace {
       expansion = "{", [ { ? [^}] ? } ], "}" ;
       weight = ( ( { ? [0-9] ? }, [ "." ] ) | ( ".", ? [0-9] ? ) ), [ { ? [0-9] ? } ] ;
     */
-    DataText parse_text(CharFeeder &it)
+    DataText parse_text(CharFeeder &it, const Config_t &config, std::string &err)
     {
         const char c{it.getc()};
         if (it.is_end()
@@ -421,17 +518,19 @@ namespace {
             || c == '|'
             || c == '~'
             || c == '}') {
-            throw_parse_error(it, "A text is expected.");
+            set_parse_error(it, "A text is expected.", err);
             return DataText{};
         } else if (c == '"' || c == '\'' || c == '`') {
-            return parse_quoted_text(it);
+            return parse_quoted_text(it, config, err);
         } else {
-            return parse_non_quoted_text(it);
+            return parse_non_quoted_text(it, config, err);
         }
     }
 
     /** Parse a quoted text.
         \param [inout] it The character feeder.
+        \param [in] config The configuration to create the gsub functions.
+        \param [out] err The error message is set if an error is detected.
         \return The text.
     */
     /*
@@ -440,7 +539,7 @@ namespace {
           "'", [ { ? [^'{] ? | expansion } ], "'", space_opt, [ number ] |
           "`", [ { ? [^`{] ? | expansion } ], "`", space_opt, [ number ] ;
     */
-    DataText parse_quoted_text(CharFeeder &it)
+    DataText parse_quoted_text(CharFeeder &it, const Config_t &config, std::string &err)
     {
         DataText text;
         std::string s;
@@ -448,10 +547,13 @@ namespace {
         it.next();
         while (!it.is_end() && it.getc() != quote) {
             if (it.getc() == '{') {
-                parse_expansion(it, text, s);
+                parse_expansion(it, config, text, s, err);
+                if (!err.empty()) {
+                    return text;
+                }
             } else {
-                s += it.getc();
-                it.next();
+                const char stops[]{quote, '{'};
+                it.read_until(s, stops, sizeof(stops));
             }
         }
         if (it.is_end()) {
@@ -460,19 +562,29 @@ namespace {
             msg += "quoted text";
             msg += quote;
             msg += " is expected.";
-            throw_parse_error(it, msg);
+            set_parse_error(it, msg, err);
+            return text;
         }
         if (!s.empty()) {
             text.add_string(std::move(s));
         }
         it.next();
-        skip_space(it);
-        text.set_weight(parse_weight(it));
+        skip_space(it, err);
+        if (err.empty()) {
+            text.set_weight(parse_weight(it, err));
+        }
         return text;
     }
 
+    /** The characters that stop a part of a non quoted text without a special meaning.
+        \note They are the spaces, the end of the text, and the beginning of an expansion.
+    */
+    const char plain_text_stops[]{' ', '\t', '\n', '|', '~', '{', '}'};
+
     /** Parse a non quoted text.
         \param [inout] it The character feeder.
+        \param [in] config The configuration to create the gsub functions.
+        \param [out] err The error message is set if an error is detected.
         \return The text.
     */
     /*
@@ -482,7 +594,7 @@ namespace {
       text_body = { ? [^\n|~{}] ? | expansion } ;
       text_postfix = ? space_opt(?=($|[\n|~}])) ? ; (* text_postfix greedily matches with space_opt preceding the end of the text, newline, "|", "~", or "}", but it consumes only space_opt. *)
     */
-    DataText parse_non_quoted_text(CharFeeder &it)
+    DataText parse_non_quoted_text(CharFeeder &it, const Config_t &config, std::string &err)
     {
         // The caller ensures it.getc() == text_begin or EOT.
         DataText text;
@@ -508,23 +620,24 @@ namespace {
                         // The comment block can match "text_postfix" rule, so don't clear "spaces" if it's a comment block.
                         it.next();
                         it.next();
-                        while (!it.is_end() && it.getc() != '}') {
-                            it.next();
-                        }
+                        it.skip_until("}", 1);
                         if (it.is_end()) {
-                            throw_parse_error(it, "The end of the comment is expected.");
+                            set_parse_error(it, "The end of the comment is expected.", err);
+                            break;
                         }
                         it.next();
                     } else {
                         s += spaces;
                         spaces.clear();
-                        parse_expansion(it, text, s);
+                        parse_expansion(it, config, text, s, err);
+                        if (!err.empty()) {
+                            break;
+                        }
                     }
                 } else {
                     s += spaces;
-                    s += c;
                     spaces.clear();
-                    it.next();
+                    it.read_until(s, plain_text_stops, sizeof(plain_text_stops));
                 }
             }
         }
@@ -533,14 +646,16 @@ namespace {
 
     /** Parse an expansion.
         \param [inout] it The character feeder.
+        \param [in] config The configuration to create the gsub functions.
         \param [inout] text The text into which the parts are added.
         \param [inout] s The unsolved string.
+        \param [out] err The error message is set if an error is detected.
         \note Accomplish the definitive conversions here. (If the string enclosed by "{" and "}" may be a nonterminal, it's a non-definitive conversion.)
     */
     /*
       expansion = "{", [ { ? [^}] ? } ], "}" ;
     */
-    void parse_expansion(CharFeeder &it, DataText &text, std::string &s)
+    void parse_expansion(CharFeeder &it, const Config_t &config, DataText &text, std::string &s, std::string &err)
     {
         it.next();
         const char c{it.getc()};
@@ -565,10 +680,16 @@ namespace {
                 it.next();
             }
             it.next();
-            skip_space_nl(it);
+            skip_space_nl(it, err);
+            if (!err.empty()) {
+                return;
+            }
             text.add_string(s);
             s.clear();
-            DataProductionRule rule{parse_production_rule(it, '}')};
+            DataProductionRule rule{parse_production_rule(it, config, err, '}')};
+            if (!err.empty()) {
+                return;
+            }
             if (c == ':') {
                 rule.equalize_chance();
             }
@@ -587,7 +708,7 @@ namespace {
                             text.add_string(s);
                             s.clear();
                         }
-                        text.add_expansion(std::move(name));
+                        text.add_expansion(Symbol{name});
                         return;
                     } else if (is_comment) {
                         return;
@@ -603,50 +724,69 @@ namespace {
                 }
             }
         }
-        throw_parse_error(it, "The end of the brace expansion is expected.");
+        set_parse_error(it, "The end of the brace expansion is expected.", err);
     }
 
     // Forward declarations
-    std::string parse_pattern(CharFeeder &it, char sep, bool allow_empty);
+    std::string parse_pattern(CharFeeder &it, char sep, bool allow_empty, std::string &err);
 
     /** Parse a gsubs.
         \param [inout] it The character feeder.
+        \param [in] config The configuration to create the gsub functions.
+        \param [out] err The error message is set if an error is detected.
         \return The gsubs.
     */
     /*
       gsubs = [ { "~", space_one_nl_opt, sep, { pat }, sep2, [ { pat } ], sep2, [ "g" ], space_opt } ] ; (* 'sep2' is the same character of 'sep'. *)
       sep = ? 7 bit character - [ \t\n{] ? ; (* '{' may be the beginning of the comment block. *)
     */
-    DataGsubs parse_gsubs(CharFeeder &it)
+    DataGsubs parse_gsubs(CharFeeder &it, const Config_t &config, std::string &err)
     {
         DataGsubs gsubs;
         while (it.getc() == '~') {
             it.next();
-            skip_space_one_nl(it);
+            skip_space_one_nl(it, err);
+            if (!err.empty()) {
+                break;
+            }
             const char sep{it.getc()};
             if (it.is_end()) {
-                throw_parse_error(it, "Unexpected EOT.");
+                set_parse_error(it, "Unexpected EOT.", err);
+                break;
             } else if (sep == '{') {
-                throw_parse_error(it, "\"{\" isn't allowable as a separator.");
+                set_parse_error(it, "\"{\" isn't allowable as a separator.", err);
+                break;
             } else if (static_cast<unsigned char>(sep) > 0x7F) {
-                throw_parse_error(it, "The separator must be a 7 bit character.");
+                set_parse_error(it, "The separator must be a 7 bit character.", err);
+                break;
             }
             it.next();
 
-            const std::string pattern{parse_pattern(it, sep, false)};
-            const std::string repl{parse_pattern(it, sep, true)};
+            const std::string pattern{parse_pattern(it, sep, false, err)};
+            if (!err.empty()) {
+                break;
+            }
+            const std::string repl{parse_pattern(it, sep, true, err)};
+            if (!err.empty()) {
+                break;
+            }
             const bool global{it.getc() == 'g'};
             if (global) {
                 it.next();
             }
+            // The gsub function creator reports an invalid pattern by an exception.
             try {
-                gsubs.add_parameter(pattern, repl, global);
+                gsubs.add_parameter(pattern, repl, global, config);
             } catch (const std::runtime_error &e) {
                 std::string msg{"Gsub error: "};
                 msg += e.what();
-                throw_parse_error(it, msg);
+                set_parse_error(it, msg, err);
+                break;
+            }
+            skip_space(it, err);
+            if (!err.empty()) {
+                break;
             }
-            skip_space(it);
         }
         return gsubs;
     }
@@ -655,31 +795,23 @@ namespace {
         \param [inout] it The character feeder.
         \param [in] sep The separator character.
         \param [in] allow_empty Is the empty string allowed?
+        \param [out] err The error message is set if an error is detected.
         \return The pattern or the repl.
     */
     /*
       pat = ? all characters ? - sep2 ; (* 'sep2' is the character precedes 'pat' in the parent 'gsubs'. *)
     */
-    std::string parse_pattern(CharFeeder &it, const char sep, const bool allow_empty)
+    std::string parse_pattern(CharFeeder &it, const char sep, const bool allow_empty, std::string &err)
     {
         std::string pat;
-        while (!it.is_end() && it.getc() != sep) {
-            pat += it.getc();
-            it.next();
-        }
+        it.read_until(pat, &sep, 1);
         if (!allow_empty && pat.empty()) {
-            throw_parse_error(it, "A nonempty pattern is expected.");
-        }
-        if (it.is_end()) {
-            throw_parse_error(it, "Unexpected EOT.");
+            set_parse_error(it, "A nonempty pattern is expected.", err);
+        } else if (it.is_end()) {
+            set_parse_error(it, "Unexpected EOT.", err);
+        } else {
+            it.next();
         }
-        it.next();
         return pat;
     }
-
-
-    ParseError::ParseError(const std::string &what_arg)
-        : std::runtime_error(what_arg)
-    {
-    }
 }
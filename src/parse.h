@@ -38,20 +38,61 @@
 #ifndef TPHRASE_SRC_PARSE_H_
 #define TPHRASE_SRC_PARSE_H_
 
+#include <cstddef>
+#include <functional>
 #include <string>
 #include <vector>
 
 #include "tphrase/common/InputIterator.h"
+#include "tphrase/common/config.h"
+#include "DataProductionRule.h"
 #include "DataSyntax.h"
+#include "Symbol.h"
 
 namespace tphrase {
+    /** The type of the range of an assignment in the source text. */
+    struct AssignmentSpan_t {
+        Symbol nonterminal; /**< The nonterminal of the assignment. */
+        std::size_t begin; /**< The offset where the parser starts to read the assignment, including the preceding spaces and newlines. */
+        std::size_t end; /**< The offset of the end of the assignment, that is, the newline or the end of the text. */
+    };
+
     /** Parse a phrase syntax.
         \param [inout] p The source text.
         \param [inout] err_msg The error messages are added if some errors are detected.
+        \param [in] config The configuration to create the gsub functions. Its gsub_creator must not be empty.
+        \param [out] spans The ranges of the assignments are added in the order of the source text, if it's not nullptr.
         \return The phrase syntax.
         \note The return value is bound on no syntax.
+        \note The spans are contiguous, so the end of a span is the beginning of the next span.
+    */
+    extern DataSyntax parse(InputIteratorBase &p, std::vector<std::string> &err_msg,
+                            const Config_t &config,
+                            std::vector<AssignmentSpan_t> *spans = nullptr);
+
+    /** The type of the function to receive an assignment from parse_each().
+
+        The arguments are the nonterminal, the production rule, and the error message that the function sets if it doesn't accept the assignment. It returns false to stop parsing.
+    */
+    using ParsedAssignmentSink_t = std::function<bool(const Symbol &nonterminal, DataProductionRule &&rule, std::string &err_msg)>;
+    /** The type of the function to receive a syntax that has an assignment from parse_each().
+
+        The arguments are the nonterminal, the syntax that has the assignment and the local nonterminals that it refers to, and the error message that the function sets if it doesn't accept the assignment. It returns false to stop parsing.
+    */
+    using ParsedSyntaxSink_t = std::function<bool(const Symbol &nonterminal, DataSyntax &&assignment, std::string &err_msg)>;
+
+    /** Parse a phrase syntax, and pass each assignment to a function as soon as it's parsed.
+        \param [inout] p The source text.
+        \param [inout] err_msg The error messages are added if some errors are detected.
+        \param [in] config The configuration to create the gsub functions. Its gsub_creator must not be empty.
+        \param [in] sink The function to receive the assignments.
+        \note The local nonterminals are not passed to sink. They are kept to be copied with the following assignments that refer to them, so a local nonterminal must be assigned before it's used.
+        \note The assignment that has an error is skipped, and the following assignments are passed.
+        \note The production rules are bound on no syntax.
     */
-    extern DataSyntax parse(InputIteratorBase &p, std::vector<std::string> &err_msg);
+    extern void parse_each(InputIteratorBase &p, std::vector<std::string> &err_msg,
+                           const Config_t &config,
+                           const ParsedSyntaxSink_t &sink);
 }
 
 #endif // TPHRASE_SRC_PARSE_H_
@@ -0,0 +1,304 @@
+/** Analysis of the parameters of the gsub.
+    \file pattern_analysis.cpp
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#include <cctype>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#include "pattern_analysis.h"
+
+namespace {
+    /** Is it a special character in the ECMAScript regex?
+        \param [in] c The character to be tested.
+        \return It's a special character.
+    */
+    bool is_regex_special_char(const char c)
+    {
+        return c != '\0' && std::strchr("^$\\.*+?()[]{}|", c) != nullptr;
+    }
+
+    /** Is it an ASCII punctuation character?
+        \param [in] c The character to be tested.
+        \return It's a punctuation character.
+        \note The escaped punctuation character is the character itself in the ECMAScript regex.
+    */
+    bool is_ascii_punct(const char c)
+    {
+        return ('!' <= c && c <= '/')
+            || (':' <= c && c <= '@')
+            || ('[' <= c && c <= '`')
+            || ('{' <= c && c <= '~');
+    }
+
+    /** Skip a group or a character class.
+        \param [in] pattern The pattern.
+        \param [in] i The position of '(' or '['.
+        \return The position next to the corresponding ')' or ']', or std::string::npos if it's not terminated.
+    */
+    std::size_t skip_bracket(const std::string &pattern, std::size_t i)
+    {
+        std::size_t depth{0};
+        bool in_class{false};
+        for (; i < pattern.size(); ++i) {
+            const char c{pattern[i]};
+            if (c == '\\') {
+                ++i;
+            } else if (in_class) {
+                in_class = c != ']';
+                if (!in_class && depth == 0) {
+                    return i + 1;
+                }
+            } else if (c == '[') {
+                in_class = true;
+            } else if (c == '(') {
+                ++depth;
+            } else if (c == ')') {
+                if (depth <= 1) {
+                    return i + 1;
+                }
+                --depth;
+            }
+        }
+        return std::string::npos;
+    }
+
+    /** Skip an escape sequence.
+        \param [in] pattern The pattern.
+        \param [in] i The position of '\\'.
+        \return The position next to the escape sequence.
+        \note The payload of "\\x", "\\u", "\\c", "\\p", "\\P", "\\k", and the backreference is skipped.
+    */
+    std::size_t skip_escape(const std::string &pattern, std::size_t i)
+    {
+        i += 2;
+        if (i > pattern.size()) {
+            return pattern.size();
+        }
+        const char c{pattern[i - 1]};
+        if ((c == 'u' || c == 'p' || c == 'P' || c == 'k')
+            && i < pattern.size() && (pattern[i] == '{' || pattern[i] == '<')) {
+            const std::size_t end{pattern.find(pattern[i] == '{' ? '}' : '>', i)};
+            return end == std::string::npos ? pattern.size() : end + 1;
+        }
+        std::size_t max_len{0};
+        if (c == 'x') {
+            max_len = 2;
+        } else if (c == 'u') {
+            max_len = 4;
+        } else if (c == 'c') {
+            max_len = 1;
+        } else if (std::isdigit(static_cast<unsigned char>(c))) {
+            max_len = pattern.size();
+        }
+        for (std::size_t n = 0; n < max_len && i < pattern.size(); ++n) {
+            const unsigned char d{static_cast<unsigned char>(pattern[i])};
+            if (c == 'c' ? !std::isalpha(d)
+                : std::isdigit(static_cast<unsigned char>(c)) ? !std::isdigit(d)
+                : !std::isxdigit(d)) {
+                break;
+            }
+            ++i;
+        }
+        return i;
+    }
+
+    /** Parse a quantifier.
+        \param [in] pattern The pattern.
+        \param [inout] i The position of the quantifier. It's moved to the next of the quantifier if the quantifier exists.
+        \param [out] min The minimum number of the repetition.
+        \return true if the quantifier exists.
+        \note The quantifier following the quantifier isn't parsed.
+        \note The '{' that isn't a quantifier is regarded as a quantifier with min = 0 to be conservative.
+    */
+    bool parse_quantifier(const std::string &pattern, std::size_t &i, std::size_t &min)
+    {
+        if (i >= pattern.size()) {
+            return false;
+        }
+        const char c{pattern[i]};
+        if (c == '*' || c == '?') {
+            min = 0;
+            ++i;
+        } else if (c == '+') {
+            min = 1;
+            ++i;
+        } else if (c == '{') {
+            std::size_t j{i + 1};
+            std::size_t n{0};
+            while (j < pattern.size() && '0' <= pattern[j] && pattern[j] <= '9') {
+                n = n > 100 ? n : n * 10 + (pattern[j] - '0');
+                ++j;
+            }
+            const std::size_t num_digits{j - i - 1};
+            if (j < pattern.size() && pattern[j] == ',') {
+                ++j;
+                while (j < pattern.size() && '0' <= pattern[j] && pattern[j] <= '9') {
+                    ++j;
+                }
+            }
+            if (num_digits > 0 && j < pattern.size() && pattern[j] == '}') {
+                min = n;
+                i = j + 1;
+            } else {
+                min = 0;
+                ++i;
+            }
+        } else {
+            return false;
+        }
+        if (i < pattern.size() && pattern[i] == '?') {
+            // Lazy quantifier
+            ++i;
+        }
+        return true;
+    }
+}
+
+namespace tphrase {
+    extern bool get_literal_pattern(const std::string &pattern, std::string &literal)
+    {
+        literal.clear();
+        for (std::size_t i = 0; i < pattern.size(); ++i) {
+            const char c{pattern[i]};
+            if (c == '\\') {
+                ++i;
+                if (i < pattern.size() && is_ascii_punct(pattern[i])) {
+                    literal += pattern[i];
+                } else {
+                    return false;
+                }
+            } else if (is_regex_special_char(c)) {
+                return false;
+            } else {
+                literal += c;
+            }
+        }
+        return !literal.empty();
+    }
+
+    extern std::string get_required_literal(const std::string &pattern)
+    {
+        // An alternative at the top level may not contain the literal string.
+        for (std::size_t i = 0; i < pattern.size(); ++i) {
+            const char c{pattern[i]};
+            if (c == '\\') {
+                ++i;
+            } else if (c == '(' || c == '[') {
+                i = skip_bracket(pattern, i);
+                if (i == std::string::npos) {
+                    return std::string{};
+                }
+                --i;
+            } else if (c == '|') {
+                return std::string{};
+            }
+        }
+
+        std::string longest;
+        std::string run;
+        std::size_t i{0};
+        while (i < pattern.size()) {
+            const char c{pattern[i]};
+            bool is_literal{false};
+            std::string literal;
+            if (c == '\\') {
+                is_literal = i + 1 < pattern.size() && is_ascii_punct(pattern[i + 1]);
+                if (is_literal) {
+                    literal = pattern[i + 1];
+                }
+                i = is_literal ? i + 2 : skip_escape(pattern, i);
+            } else if (c == '(' || c == '[') {
+                i = skip_bracket(pattern, i);
+                if (i == std::string::npos) {
+                    return std::string{};
+                }
+            } else {
+                is_literal = !is_regex_special_char(c);
+                literal = c;
+                ++i;
+                // A quantifier may apply to the whole character in UTF-8.
+                while (static_cast<unsigned char>(c) >= 0x80
+                       && i < pattern.size()
+                       && (static_cast<unsigned char>(pattern[i]) & 0xC0) == 0x80) {
+                    literal += pattern[i];
+                    ++i;
+                }
+            }
+
+            std::size_t min{1};
+            const bool has_quantifier{parse_quantifier(pattern, i, min)};
+            if (has_quantifier && i < pattern.size() && std::strchr("*+?{", pattern[i]) != nullptr) {
+                // The stacked quantifiers such as "b{1,}{0,1}" and "c+*" may repeat the preceding
+                // quantified atom zero times, so nothing is required.
+                return std::string{};
+            }
+            if (is_literal && min > 0) {
+                run += literal;
+            }
+            if (!is_literal || has_quantifier) {
+                if (run.size() > longest.size()) {
+                    longest = run;
+                }
+                run.clear();
+            }
+        }
+        if (run.size() > longest.size()) {
+            longest = run;
+        }
+        return longest;
+    }
+
+    extern bool get_literal_replacement(const std::string &repl, std::string &literal)
+    {
+        literal.clear();
+        for (std::size_t i = 0; i < repl.size(); ++i) {
+            const char c{repl[i]};
+            if (c == '$') {
+                ++i;
+                if (i < repl.size() && repl[i] == '$') {
+                    literal += '$';
+                } else {
+                    return false;
+                }
+            } else {
+                literal += c;
+            }
+        }
+        return true;
+    }
+}
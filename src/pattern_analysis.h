@@ -0,0 +1,70 @@
+/** Analysis of the parameters of the gsub.
+    \file pattern_analysis.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_SRC_PATTERN_ANALYSIS_H_
+#define TPHRASE_SRC_PATTERN_ANALYSIS_H_
+
+#include <string>
+
+namespace tphrase {
+    /** Get the literal string that a pattern matches.
+        \param [in] pattern The pattern parameter of gsub in the ECMAScript regex grammar.
+        \param [out] literal The string that the pattern matches, if the pattern is a literal.
+        \return true if the pattern matches only a fixed string.
+        \note A pattern with a special character is not a literal, except for an escaped punctuation character (an identity escape).
+    */
+    extern bool get_literal_pattern(const std::string &pattern, std::string &literal);
+
+    /** Get the longest literal string that every match of a pattern contains.
+        \param [in] pattern The pattern parameter of gsub in the ECMAScript regex grammar.
+        \return The literal string, or an empty string if no literal string is found.
+        \note The analysis is conservative: the alternatives, the groups, the character classes, and the escape sequences except for an identity escape of a punctuation character are regarded as unknown.
+        \note The pattern with the stacked quantifiers (e.g. "a+*") has no literal string.
+        \note A gsub can't match a string that doesn't contain the literal string.
+    */
+    extern std::string get_required_literal(const std::string &pattern);
+
+    /** Get the literal string that a replacement generates.
+        \param [in] repl The replacement parameter of gsub in the ECMAScript format.
+        \param [out] literal The string that the replacement generates, if the replacement is a literal.
+        \return true if the replacement generates a fixed string.
+        \note "$$" is a literal "$", and the other "$" is not a literal.
+    */
+    extern bool get_literal_replacement(const std::string &repl, std::string &literal);
+}
+
+#endif // TPHRASE_SRC_PATTERN_ANALYSIS_H_
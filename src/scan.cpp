@@ -0,0 +1,184 @@
+/** The scanner of the runs of characters.
+    \file scan.cpp
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#include <cstddef>
+#include <cstring>
+
+#if defined(__GNUC__) && defined(__SSE2__) && (defined(__x86_64__) || defined(__i386__))
+#define TPHRASE_SCAN_SSE2 1
+#include <immintrin.h>
+#endif
+
+#include "scan.h"
+
+namespace {
+    /** Find the first stop character one by one.
+        \param [in] begin The beginning of the range.
+        \param [in] end The end of the range.
+        \param [in] stops The stop characters.
+        \param [in] num_stops The number of the stop characters.
+        \return The position of the first stop character, or end.
+    */
+    const char *find_first_of_scalar(const char *begin, const char *end, const char *stops, const std::size_t num_stops)
+    {
+        for (; begin != end; ++begin) {
+            for (std::size_t i = 0; i < num_stops; ++i) {
+                if (*begin == stops[i]) {
+                    return begin;
+                }
+            }
+        }
+        return end;
+    }
+
+#ifdef TPHRASE_SCAN_SSE2
+    /** The number of the stop characters that the vectorized scanners support. */
+    constexpr std::size_t max_vector_stops{8};
+
+    /** Find the first stop character 16 bytes at a time.
+        \param [in] begin The beginning of the range.
+        \param [in] end The end of the range.
+        \param [in] stops The stop characters.
+        \param [in] num_stops The number of the stop characters. It must be max_vector_stops or less.
+        \return The position of the first stop character, or end.
+    */
+    const char *find_first_of_sse2(const char *begin, const char *end, const char *stops, const std::size_t num_stops)
+    {
+        __m128i v_stops[max_vector_stops];
+        for (std::size_t i = 0; i < num_stops; ++i) {
+            v_stops[i] = _mm_set1_epi8(stops[i]);
+        }
+        for (; end - begin >= 16; begin += 16) {
+            const __m128i v{_mm_loadu_si128(reinterpret_cast<const __m128i *>(begin))};
+            __m128i hit{_mm_setzero_si128()};
+            for (std::size_t i = 0; i < num_stops; ++i) {
+                hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, v_stops[i]));
+            }
+            const unsigned mask{static_cast<unsigned>(_mm_movemask_epi8(hit))};
+            if (mask != 0) {
+                return begin + __builtin_ctz(mask);
+            }
+        }
+        return find_first_of_scalar(begin, end, stops, num_stops);
+    }
+
+    /** Find the first stop character 32 bytes at a time.
+        \param [in] begin The beginning of the range.
+        \param [in] end The end of the range.
+        \param [in] stops The stop characters.
+        \param [in] num_stops The number of the stop characters. It must be max_vector_stops or less.
+        \return The position of the first stop character, or end.
+        \note The caller must check that the CPU supports AVX2.
+    */
+    __attribute__((target("avx2")))
+    const char *find_first_of_avx2(const char *begin, const char *end, const char *stops, const std::size_t num_stops)
+    {
+        __m256i v_stops[max_vector_stops];
+        for (std::size_t i = 0; i < num_stops; ++i) {
+            v_stops[i] = _mm256_set1_epi8(stops[i]);
+        }
+        for (; end - begin >= 32; begin += 32) {
+            const __m256i v{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin))};
+            __m256i hit{_mm256_setzero_si256()};
+            for (std::size_t i = 0; i < num_stops; ++i) {
+                hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, v_stops[i]));
+            }
+            const unsigned mask{static_cast<unsigned>(_mm256_movemask_epi8(hit))};
+            if (mask != 0) {
+                return begin + __builtin_ctz(mask);
+            }
+        }
+        return find_first_of_sse2(begin, end, stops, num_stops);
+    }
+
+    /** The type of the scanners. */
+    using FindFirstOf_t = const char *(*)(const char *, const char *, const char *, std::size_t);
+
+    /** Select the scanner that the CPU supports.
+        \return The scanner.
+    */
+    FindFirstOf_t select_find_first_of()
+    {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return find_first_of_avx2;
+        }
+        return find_first_of_sse2;
+    }
+#endif
+}
+
+namespace tphrase {
+    const char *find_first_of(const char *begin, const char *end, const char *stops, const std::size_t num_stops)
+    {
+        if (num_stops == 1) {
+            // memchr() is vectorized by the C library.
+            const void *p{std::memchr(begin, stops[0], end - begin)};
+            return p ? static_cast<const char *>(p) : end;
+        }
+#ifdef TPHRASE_SCAN_SSE2
+        if (num_stops <= max_vector_stops) {
+            static const FindFirstOf_t f{select_find_first_of()};
+            return f(begin, end, stops, num_stops);
+        }
+#endif
+        return find_first_of_scalar(begin, end, stops, num_stops);
+    }
+
+    std::size_t count_newlines(const char *begin, const char *end, const char *&last)
+    {
+        std::size_t n{0};
+#ifdef TPHRASE_SCAN_SSE2
+        const __m128i nl{_mm_set1_epi8('\n')};
+        for (; end - begin >= 16; begin += 16) {
+            const __m128i v{_mm_loadu_si128(reinterpret_cast<const __m128i *>(begin))};
+            const unsigned mask{static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, nl)))};
+            if (mask != 0) {
+                n += __builtin_popcount(mask);
+                last = begin + (31 - __builtin_clz(mask));
+            }
+        }
+#endif
+        for (; begin != end; ++begin) {
+            if (*begin == '\n') {
+                ++n;
+                last = begin;
+            }
+        }
+        return n;
+    }
+}
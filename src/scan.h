@@ -0,0 +1,63 @@
+/** The scanner of the runs of characters.
+    \file scan.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_SRC_SCAN_H_
+#define TPHRASE_SRC_SCAN_H_
+
+#include <cstddef>
+
+namespace tphrase {
+    /** Find the first character that is one of the stop characters.
+        \param [in] begin The beginning of the range.
+        \param [in] end The end of the range.
+        \param [in] stops The stop characters.
+        \param [in] num_stops The number of the stop characters.
+        \return The position of the first stop character, or end if no stop characters are found.
+        \note It scans the range with SSE2 or AVX2 if the platform supports them. AVX2 is used only if the CPU supports it at run time.
+    */
+    extern const char *find_first_of(const char *begin, const char *end, const char *stops, std::size_t num_stops);
+
+    /** Count the newlines in a range.
+        \param [in] begin The beginning of the range.
+        \param [in] end The end of the range.
+        \param [out] last The position of the last newline. It's unchanged if no newlines are found.
+        \return The number of the newlines.
+    */
+    extern std::size_t count_newlines(const char *begin, const char *end, const char *&last);
+}
+
+#endif // TPHRASE_SRC_SCAN_H_
@@ -40,34 +40,68 @@
 
 #include <algorithm>
 #include <cmath>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "tphrase/common/ext_context.h"
-#include "random.h"
+#include "tphrase/common/random_func.h"
 
 namespace tphrase {
 
+    /** Generate a string by an item.
+        \tparam T The type of the item.
+        \param [in] item The item.
+        \param [in] ext_context The external context that has some nonterminals and the substitutions.
+        \param [in] rand The random function.
+        \return The generated string.
+    */
+    template<typename T>
+    std::string
+    generate_by(const T &item, const ExtContext_t &ext_context, const RandomFunc_t &rand)
+    {
+        return item.generate(ext_context, rand);
+    }
+
+    /** Generate a string by a shared item.
+        \tparam T The type of the item.
+        \param [in] item The pointer to the item.
+        \param [in] ext_context The external context that has some nonterminals and the substitutions.
+        \param [in] rand The random function.
+        \return The generated string.
+    */
+    template<typename T>
+    std::string
+    generate_by(const std::shared_ptr<T> &item, const ExtContext_t &ext_context, const RandomFunc_t &rand)
+    {
+        return item->generate(ext_context, rand);
+    }
+
     /** Select an item, and a string is generated by it.
         \tparam T The type of the items.
+        \tparam TA The allocator of target.
+        \tparam WA The allocator of weights.
         \param [in] target A set from which an item is selected.
         \param [in] weights weights[i] is the sum of weights[i-1] and the weight to select target[i].
         \param [in] equalized_chance Equalize the chance to select the items.
         \param [in] ext_context The external context that has some nonterminals and the substitutions.
+        \param [in] rand The random function.
         \return The generated string.
     */
-    template<typename T>
+    template<typename T, typename TA, typename WA>
     std::string
-    select_and_generate(const std::vector<T> &target,
-                        const std::vector<double> &weights,
+    select_and_generate(const std::vector<T, TA> &target,
+                        const std::vector<double, WA> &weights,
                         const bool equalized_chance,
-                        const ExtContext_t &ext_context)
+                        const ExtContext_t &ext_context,
+                        const RandomFunc_t &rand)
     {
         if (target.empty()) {
             return "nil";
         } else if (target.size() == 1) {
-            return target[0].generate(ext_context);
+            return generate_by(target[0], ext_context, rand);
         } else {
-            double r{random()};
+            double r{rand()};
             size_t i{0};
             if (equalized_chance) {
                 i = std::floor(r * target.size());
@@ -79,7 +113,7 @@ namespace tphrase {
                     i = 0;
                 }
             }
-            return target[i].generate(ext_context);
+            return generate_by(target[i], ext_context, rand);
         }
     }
 }
@@ -0,0 +1,222 @@
+/** The binary snapshot of the phrase syntaxes.
+    \file snapshot.cpp
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <string>
+
+#include "snapshot.h"
+
+namespace {
+    /** The magic number at the beginning of the snapshot. */
+    const char magic[8] = {'T', 'P', 'h', 'r', 'a', 's', 'e', '\0'};
+
+    /** The version of the snapshot format. It must be changed if the format is changed. */
+    constexpr std::uint64_t format_version{3};
+
+    /** The maximum size of the chunk to read a string, so the broken length can't exhaust the memory before the end of the stream is detected. */
+    constexpr std::size_t max_chunk{0x10000};
+}
+
+namespace tphrase {
+    SnapshotWriter::SnapshotWriter(std::ostream &in_os)
+        : os(in_os)
+    {
+    }
+
+    void SnapshotWriter::write_header(const SnapshotKind_t kind)
+    {
+        os.write(magic, sizeof(magic));
+        write_byte(static_cast<unsigned char>(kind));
+        write_u64(format_version);
+    }
+
+    void SnapshotWriter::write_u64(const std::uint64_t v)
+    {
+        char buf[8];
+        for (std::size_t i = 0; i < sizeof(buf); ++i) {
+            buf[i] = static_cast<char>((v >> (i * 8)) & 0xFF);
+        }
+        os.write(buf, sizeof(buf));
+    }
+
+    void SnapshotWriter::write_size(const std::size_t v)
+    {
+        write_u64(v);
+    }
+
+    void SnapshotWriter::write_int(const int v)
+    {
+        write_u64(static_cast<std::uint64_t>(static_cast<std::int64_t>(v)));
+    }
+
+    void SnapshotWriter::write_double(const double v)
+    {
+        static_assert(sizeof(double) == sizeof(std::uint64_t), "double must be 64 bits.");
+        std::uint64_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        write_u64(bits);
+    }
+
+    void SnapshotWriter::write_bool(const bool v)
+    {
+        write_byte(v ? 1 : 0);
+    }
+
+    void SnapshotWriter::write_byte(const unsigned char v)
+    {
+        os.put(static_cast<char>(v));
+    }
+
+    void SnapshotWriter::write_string(const std::string &s)
+    {
+        write_size(s.size());
+        os.write(s.data(), s.size());
+    }
+
+    bool SnapshotWriter::good() const
+    {
+        return static_cast<bool>(os);
+    }
+
+
+    SnapshotReader::SnapshotReader(std::istream &in_is)
+        : is(in_is), err_msg{}
+    {
+    }
+
+    bool SnapshotReader::read_header(const SnapshotKind_t kind)
+    {
+        char buf[sizeof(magic)];
+        if (!is.read(buf, sizeof(buf)) || std::memcmp(buf, magic, sizeof(magic)) != 0) {
+            fail("The data is not a snapshot of TPhrase.");
+            return false;
+        }
+        if (read_byte() != static_cast<unsigned char>(kind)) {
+            if (kind == SnapshotKind_t::SYNTAX) {
+                fail("The snapshot is not for Syntax.");
+            } else {
+                fail("The snapshot is not for Generator.");
+            }
+            return false;
+        }
+        if (read_u64() != format_version) {
+            fail("The version of the snapshot is not supported.");
+            return false;
+        }
+        return good();
+    }
+
+    std::uint64_t SnapshotReader::read_u64()
+    {
+        char buf[8];
+        if (!good() || !is.read(buf, sizeof(buf))) {
+            fail("The snapshot is truncated.");
+            return 0;
+        }
+        std::uint64_t v{0};
+        for (std::size_t i = 0; i < sizeof(buf); ++i) {
+            v |= static_cast<std::uint64_t>(static_cast<unsigned char>(buf[i])) << (i * 8);
+        }
+        return v;
+    }
+
+    std::size_t SnapshotReader::read_size()
+    {
+        const std::uint64_t v{read_u64()};
+        if (v > static_cast<std::uint64_t>(static_cast<std::size_t>(-1))) {
+            fail("The snapshot is broken.");
+            return 0;
+        }
+        return static_cast<std::size_t>(v);
+    }
+
+    int SnapshotReader::read_int()
+    {
+        return static_cast<int>(static_cast<std::int64_t>(read_u64()));
+    }
+
+    double SnapshotReader::read_double()
+    {
+        const std::uint64_t bits{read_u64()};
+        double v;
+        std::memcpy(&v, &bits, sizeof(v));
+        return v;
+    }
+
+    bool SnapshotReader::read_bool()
+    {
+        return read_byte() != 0;
+    }
+
+    unsigned char SnapshotReader::read_byte()
+    {
+        char c;
+        if (!good() || !is.get(c)) {
+            fail("The snapshot is truncated.");
+            return 0;
+        }
+        return static_cast<unsigned char>(c);
+    }
+
+    std::string SnapshotReader::read_string()
+    {
+        std::size_t len{read_size()};
+        std::string s;
+        while (good() && len > 0) {
+            const std::size_t chunk{len < max_chunk ? len : max_chunk};
+            const std::size_t prev_len{s.size()};
+            s.resize(prev_len + chunk);
+            if (!is.read(&s[prev_len], chunk)) {
+                fail("The snapshot is truncated.");
+                return std::string{};
+            }
+            len -= chunk;
+        }
+        return s;
+    }
+
+    void SnapshotReader::fail(const std::string &msg)
+    {
+        if (err_msg.empty()) {
+            err_msg = msg;
+        }
+    }
+}
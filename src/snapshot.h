@@ -0,0 +1,191 @@
+/** The binary snapshot of the phrase syntaxes.
+    \file snapshot.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_SRC_SNAPSHOT_H_
+#define TPHRASE_SRC_SNAPSHOT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace tphrase {
+    /** The kind of the contents of a snapshot. */
+    enum class SnapshotKind_t : char {
+        SYNTAX = 'S', /**< The snapshot of Syntax. */
+        GENERATOR = 'G', /**< The snapshot of Generator. */
+    };
+
+    /** The writer of the binary snapshot.
+
+        The integers are written in the little endian, and the floating point numbers are written as the bit patterns, so the snapshot is portable among the platforms that use IEEE 754.
+    */
+    class SnapshotWriter {
+    public:
+        SnapshotWriter() = delete;
+        /** The constructor.
+            \param [inout] os The output stream.
+        */
+        explicit SnapshotWriter(std::ostream &os);
+        SnapshotWriter(const SnapshotWriter &a) = delete;
+        SnapshotWriter &operator=(const SnapshotWriter &a) = delete;
+
+        /** Write the header of the snapshot.
+            \param [in] kind The kind of the contents.
+        */
+        void write_header(SnapshotKind_t kind);
+        /** Write an unsigned integer.
+            \param [in] v The value.
+        */
+        void write_size(std::size_t v);
+        /** Write a signed integer.
+            \param [in] v The value.
+        */
+        void write_int(int v);
+        /** Write a floating point number.
+            \param [in] v The value. It may be NaN.
+        */
+        void write_double(double v);
+        /** Write a boolean value.
+            \param [in] v The value.
+        */
+        void write_bool(bool v);
+        /** Write a byte.
+            \param [in] v The value.
+        */
+        void write_byte(unsigned char v);
+        /** Write a string.
+            \param [in] s The string.
+        */
+        void write_string(const std::string &s);
+
+        /** Has no errors been detected?
+            \return true if the output stream is good.
+        */
+        bool good() const;
+
+    private:
+        /** Write a 64-bit unsigned integer.
+            \param [in] v The value.
+        */
+        void write_u64(std::uint64_t v);
+
+        std::ostream &os; /**< The output stream. */
+    };
+
+    /** The reader of the binary snapshot.
+
+        The reader doesn't throw any exceptions for the broken snapshot. The first error is recorded, and the later reads return the default values.
+    */
+    class SnapshotReader {
+    public:
+        SnapshotReader() = delete;
+        /** The constructor.
+            \param [inout] is The input stream.
+        */
+        explicit SnapshotReader(std::istream &is);
+        SnapshotReader(const SnapshotReader &a) = delete;
+        SnapshotReader &operator=(const SnapshotReader &a) = delete;
+
+        /** Read and check the header of the snapshot.
+            \param [in] kind The kind of the contents expected.
+            \return true if the header is valid.
+        */
+        bool read_header(SnapshotKind_t kind);
+        /** Read an unsigned integer.
+            \return The value.
+        */
+        std::size_t read_size();
+        /** Read a signed integer.
+            \return The value.
+        */
+        int read_int();
+        /** Read a floating point number.
+            \return The value.
+        */
+        double read_double();
+        /** Read a boolean value.
+            \return The value.
+        */
+        bool read_bool();
+        /** Read a byte.
+            \return The value.
+        */
+        unsigned char read_byte();
+        /** Read a string.
+            \return The string.
+        */
+        std::string read_string();
+
+        /** Record an error.
+            \param [in] msg The error message.
+            \note Only the first error is recorded.
+        */
+        void fail(const std::string &msg);
+        /** Has no errors been detected?
+            \return true if no errors are detected.
+        */
+        bool good() const;
+        /** Get the error message.
+            \return The message of the first error, or an empty string.
+        */
+        const std::string &get_error_message() const;
+
+    private:
+        /** Read a 64-bit unsigned integer.
+            \return The value.
+        */
+        std::uint64_t read_u64();
+
+        std::istream &is; /**< The input stream. */
+        std::string err_msg; /**< The message of the first error. */
+    };
+
+    inline
+    bool SnapshotReader::good() const
+    {
+        return err_msg.empty();
+    }
+
+    inline
+    const std::string &SnapshotReader::get_error_message() const
+    {
+        return err_msg;
+    }
+}
+
+#endif // TPHRASE_SRC_SNAPSHOT_H_
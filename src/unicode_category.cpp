@@ -0,0 +1,1140 @@
+/** The table of the general category of Unicode.
+    \file unicode_category.cpp
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#include <cstddef>
+
+#include "unicode_category.h"
+
+namespace tphrase {
+    // The table is made from the Unicode Character Database 14.0.0. The unassigned code points are omitted.
+    const UnicodeCategoryRange_t unicode_category_table[] = {
+        {0x00000, 0x0001F, UnicodeCategory_t::CC}, {0x00020, 0x00020, UnicodeCategory_t::ZS}, {0x00021, 0x00023, UnicodeCategory_t::PO},
+        {0x00024, 0x00024, UnicodeCategory_t::SC}, {0x00025, 0x00027, UnicodeCategory_t::PO}, {0x00028, 0x00028, UnicodeCategory_t::PS},
+        {0x00029, 0x00029, UnicodeCategory_t::PE}, {0x0002A, 0x0002A, UnicodeCategory_t::PO}, {0x0002B, 0x0002B, UnicodeCategory_t::SM},
+        {0x0002C, 0x0002C, UnicodeCategory_t::PO}, {0x0002D, 0x0002D, UnicodeCategory_t::PD}, {0x0002E, 0x0002F, UnicodeCategory_t::PO},
+        {0x00030, 0x00039, UnicodeCategory_t::ND}, {0x0003A, 0x0003B, UnicodeCategory_t::PO}, {0x0003C, 0x0003E, UnicodeCategory_t::SM},
+        {0x0003F, 0x00040, UnicodeCategory_t::PO}, {0x00041, 0x0005A, UnicodeCategory_t::LU}, {0x0005B, 0x0005B, UnicodeCategory_t::PS},
+        {0x0005C, 0x0005C, UnicodeCategory_t::PO}, {0x0005D, 0x0005D, UnicodeCategory_t::PE}, {0x0005E, 0x0005E, UnicodeCategory_t::SK},
+        {0x0005F, 0x0005F, UnicodeCategory_t::PC}, {0x00060, 0x00060, UnicodeCategory_t::SK}, {0x00061, 0x0007A, UnicodeCategory_t::LL},
+        {0x0007B, 0x0007B, UnicodeCategory_t::PS}, {0x0007C, 0x0007C, UnicodeCategory_t::SM}, {0x0007D, 0x0007D, UnicodeCategory_t::PE},
+        {0x0007E, 0x0007E, UnicodeCategory_t::SM}, {0x0007F, 0x0009F, UnicodeCategory_t::CC}, {0x000A0, 0x000A0, UnicodeCategory_t::ZS},
+        {0x000A1, 0x000A1, UnicodeCategory_t::PO}, {0x000A2, 0x000A5, UnicodeCategory_t::SC}, {0x000A6, 0x000A6, UnicodeCategory_t::SO},
+        {0x000A7, 0x000A7, UnicodeCategory_t::PO}, {0x000A8, 0x000A8, UnicodeCategory_t::SK}, {0x000A9, 0x000A9, UnicodeCategory_t::SO},
+        {0x000AA, 0x000AA, UnicodeCategory_t::LO}, {0x000AB, 0x000AB, UnicodeCategory_t::PI}, {0x000AC, 0x000AC, UnicodeCategory_t::SM},
+        {0x000AD, 0x000AD, UnicodeCategory_t::CF}, {0x000AE, 0x000AE, UnicodeCategory_t::SO}, {0x000AF, 0x000AF, UnicodeCategory_t::SK},
+        {0x000B0, 0x000B0, UnicodeCategory_t::SO}, {0x000B1, 0x000B1, UnicodeCategory_t::SM}, {0x000B2, 0x000B3, UnicodeCategory_t::NO},
+        {0x000B4, 0x000B4, UnicodeCategory_t::SK}, {0x000B5, 0x000B5, UnicodeCategory_t::LL}, {0x000B6, 0x000B7, UnicodeCategory_t::PO},
+        {0x000B8, 0x000B8, UnicodeCategory_t::SK}, {0x000B9, 0x000B9, UnicodeCategory_t::NO}, {0x000BA, 0x000BA, UnicodeCategory_t::LO},
+        {0x000BB, 0x000BB, UnicodeCategory_t::PF}, {0x000BC, 0x000BE, UnicodeCategory_t::NO}, {0x000BF, 0x000BF, UnicodeCategory_t::PO},
+        {0x000C0, 0x000D6, UnicodeCategory_t::LU}, {0x000D7, 0x000D7, UnicodeCategory_t::SM}, {0x000D8, 0x000DE, UnicodeCategory_t::LU},
+        {0x000DF, 0x000F6, UnicodeCategory_t::LL}, {0x000F7, 0x000F7, UnicodeCategory_t::SM}, {0x000F8, 0x000FF, UnicodeCategory_t::LL},
+        {0x00100, 0x00100, UnicodeCategory_t::LU}, {0x00101, 0x00101, UnicodeCategory_t::LL}, {0x00102, 0x00102, UnicodeCategory_t::LU},
+        {0x00103, 0x00103, UnicodeCategory_t::LL}, {0x00104, 0x00104, UnicodeCategory_t::LU}, {0x00105, 0x00105, UnicodeCategory_t::LL},
+        {0x00106, 0x00106, UnicodeCategory_t::LU}, {0x00107, 0x00107, UnicodeCategory_t::LL}, {0x00108, 0x00108, UnicodeCategory_t::LU},
+        {0x00109, 0x00109, UnicodeCategory_t::LL}, {0x0010A, 0x0010A, UnicodeCategory_t::LU}, {0x0010B, 0x0010B, UnicodeCategory_t::LL},
+        {0x0010C, 0x0010C, UnicodeCategory_t::LU}, {0x0010D, 0x0010D, UnicodeCategory_t::LL}, {0x0010E, 0x0010E, UnicodeCategory_t::LU},
+        {0x0010F, 0x0010F, UnicodeCategory_t::LL}, {0x00110, 0x00110, UnicodeCategory_t::LU}, {0x00111, 0x00111, UnicodeCategory_t::LL},
+        {0x00112, 0x00112, UnicodeCategory_t::LU}, {0x00113, 0x00113, UnicodeCategory_t::LL}, {0x00114, 0x00114, UnicodeCategory_t::LU},
+        {0x00115, 0x00115, UnicodeCategory_t::LL}, {0x00116, 0x00116, UnicodeCategory_t::LU}, {0x00117, 0x00117, UnicodeCategory_t::LL},
+        {0x00118, 0x00118, UnicodeCategory_t::LU}, {0x00119, 0x00119, UnicodeCategory_t::LL}, {0x0011A, 0x0011A, UnicodeCategory_t::LU},
+        {0x0011B, 0x0011B, UnicodeCategory_t::LL}, {0x0011C, 0x0011C, UnicodeCategory_t::LU}, {0x0011D, 0x0011D, UnicodeCategory_t::LL},
+        {0x0011E, 0x0011E, UnicodeCategory_t::LU}, {0x0011F, 0x0011F, UnicodeCategory_t::LL}, {0x00120, 0x00120, UnicodeCategory_t::LU},
+        {0x00121, 0x00121, UnicodeCategory_t::LL}, {0x00122, 0x00122, UnicodeCategory_t::LU}, {0x00123, 0x00123, UnicodeCategory_t::LL},
+        {0x00124, 0x00124, UnicodeCategory_t::LU}, {0x00125, 0x00125, UnicodeCategory_t::LL}, {0x00126, 0x00126, UnicodeCategory_t::LU},
+        {0x00127, 0x00127, UnicodeCategory_t::LL}, {0x00128, 0x00128, UnicodeCategory_t::LU}, {0x00129, 0x00129, UnicodeCategory_t::LL},
+        {0x0012A, 0x0012A, UnicodeCategory_t::LU}, {0x0012B, 0x0012B, UnicodeCategory_t::LL}, {0x0012C, 0x0012C, UnicodeCategory_t::LU},
+        {0x0012D, 0x0012D, UnicodeCategory_t::LL}, {0x0012E, 0x0012E, UnicodeCategory_t::LU}, {0x0012F, 0x0012F, UnicodeCategory_t::LL},
+        {0x00130, 0x00130, UnicodeCategory_t::LU}, {0x00131, 0x00131, UnicodeCategory_t::LL}, {0x00132, 0x00132, UnicodeCategory_t::LU},
+        {0x00133, 0x00133, UnicodeCategory_t::LL}, {0x00134, 0x00134, UnicodeCategory_t::LU}, {0x00135, 0x00135, UnicodeCategory_t::LL},
+        {0x00136, 0x00136, UnicodeCategory_t::LU}, {0x00137, 0x00138, UnicodeCategory_t::LL}, {0x00139, 0x00139, UnicodeCategory_t::LU},
+        {0x0013A, 0x0013A, UnicodeCategory_t::LL}, {0x0013B, 0x0013B, UnicodeCategory_t::LU}, {0x0013C, 0x0013C, UnicodeCategory_t::LL},
+        {0x0013D, 0x0013D, UnicodeCategory_t::LU}, {0x0013E, 0x0013E, UnicodeCategory_t::LL}, {0x0013F, 0x0013F, UnicodeCategory_t::LU},
+        {0x00140, 0x00140, UnicodeCategory_t::LL}, {0x00141, 0x00141, UnicodeCategory_t::LU}, {0x00142, 0x00142, UnicodeCategory_t::LL},
+        {0x00143, 0x00143, UnicodeCategory_t::LU}, {0x00144, 0x00144, UnicodeCategory_t::LL}, {0x00145, 0x00145, UnicodeCategory_t::LU},
+        {0x00146, 0x00146, UnicodeCategory_t::LL}, {0x00147, 0x00147, UnicodeCategory_t::LU}, {0x00148, 0x00149, UnicodeCategory_t::LL},
+        {0x0014A, 0x0014A, UnicodeCategory_t::LU}, {0x0014B, 0x0014B, UnicodeCategory_t::LL}, {0x0014C, 0x0014C, UnicodeCategory_t::LU},
+        {0x0014D, 0x0014D, UnicodeCategory_t::LL}, {0x0014E, 0x0014E, UnicodeCategory_t::LU}, {0x0014F, 0x0014F, UnicodeCategory_t::LL},
+        {0x00150, 0x00150, UnicodeCategory_t::LU}, {0x00151, 0x00151, UnicodeCategory_t::LL}, {0x00152, 0x00152, UnicodeCategory_t::LU},
+        {0x00153, 0x00153, UnicodeCategory_t::LL}, {0x00154, 0x00154, UnicodeCategory_t::LU}, {0x00155, 0x00155, UnicodeCategory_t::LL},
+        {0x00156, 0x00156, UnicodeCategory_t::LU}, {0x00157, 0x00157, UnicodeCategory_t::LL}, {0x00158, 0x00158, UnicodeCategory_t::LU},
+        {0x00159, 0x00159, UnicodeCategory_t::LL}, {0x0015A, 0x0015A, UnicodeCategory_t::LU}, {0x0015B, 0x0015B, UnicodeCategory_t::LL},
+        {0x0015C, 0x0015C, UnicodeCategory_t::LU}, {0x0015D, 0x0015D, UnicodeCategory_t::LL}, {0x0015E, 0x0015E, UnicodeCategory_t::LU},
+        {0x0015F, 0x0015F, UnicodeCategory_t::LL}, {0x00160, 0x00160, UnicodeCategory_t::LU}, {0x00161, 0x00161, UnicodeCategory_t::LL},
+        {0x00162, 0x00162, UnicodeCategory_t::LU}, {0x00163, 0x00163, UnicodeCategory_t::LL}, {0x00164, 0x00164, UnicodeCategory_t::LU},
+        {0x00165, 0x00165, UnicodeCategory_t::LL}, {0x00166, 0x00166, UnicodeCategory_t::LU}, {0x00167, 0x00167, UnicodeCategory_t::LL},
+        {0x00168, 0x00168, UnicodeCategory_t::LU}, {0x00169, 0x00169, UnicodeCategory_t::LL}, {0x0016A, 0x0016A, UnicodeCategory_t::LU},
+        {0x0016B, 0x0016B, UnicodeCategory_t::LL}, {0x0016C, 0x0016C, UnicodeCategory_t::LU}, {0x0016D, 0x0016D, UnicodeCategory_t::LL},
+        {0x0016E, 0x0016E, UnicodeCategory_t::LU}, {0x0016F, 0x0016F, UnicodeCategory_t::LL}, {0x00170, 0x00170, UnicodeCategory_t::LU},
+        {0x00171, 0x00171, UnicodeCategory_t::LL}, {0x00172, 0x00172, UnicodeCategory_t::LU}, {0x00173, 0x00173, UnicodeCategory_t::LL},
+        {0x00174, 0x00174, UnicodeCategory_t::LU}, {0x00175, 0x00175, UnicodeCategory_t::LL}, {0x00176, 0x00176, UnicodeCategory_t::LU},
+        {0x00177, 0x00177, UnicodeCategory_t::LL}, {0x00178, 0x00179, UnicodeCategory_t::LU}, {0x0017A, 0x0017A, UnicodeCategory_t::LL},
+        {0x0017B, 0x0017B, UnicodeCategory_t::LU}, {0x0017C, 0x0017C, UnicodeCategory_t::LL}, {0x0017D, 0x0017D, UnicodeCategory_t::LU},
+        {0x0017E, 0x00180, UnicodeCategory_t::LL}, {0x00181, 0x00182, UnicodeCategory_t::LU}, {0x00183, 0x00183, UnicodeCategory_t::LL},
+        {0x00184, 0x00184, UnicodeCategory_t::LU}, {0x00185, 0x00185, UnicodeCategory_t::LL}, {0x00186, 0x00187, UnicodeCategory_t::LU},
+        {0x00188, 0x00188, UnicodeCategory_t::LL}, {0x00189, 0x0018B, UnicodeCategory_t::LU}, {0x0018C, 0x0018D, UnicodeCategory_t::LL},
+        {0x0018E, 0x00191, UnicodeCategory_t::LU}, {0x00192, 0x00192, UnicodeCategory_t::LL}, {0x00193, 0x00194, UnicodeCategory_t::LU},
+        {0x00195, 0x00195, UnicodeCategory_t::LL}, {0x00196, 0x00198, UnicodeCategory_t::LU}, {0x00199, 0x0019B, UnicodeCategory_t::LL},
+        {0x0019C, 0x0019D, UnicodeCategory_t::LU}, {0x0019E, 0x0019E, UnicodeCategory_t::LL}, {0x0019F, 0x001A0, UnicodeCategory_t::LU},
+        {0x001A1, 0x001A1, UnicodeCategory_t::LL}, {0x001A2, 0x001A2, UnicodeCategory_t::LU}, {0x001A3, 0x001A3, UnicodeCategory_t::LL},
+        {0x001A4, 0x001A4, UnicodeCategory_t::LU}, {0x001A5, 0x001A5, UnicodeCategory_t::LL}, {0x001A6, 0x001A7, UnicodeCategory_t::LU},
+        {0x001A8, 0x001A8, UnicodeCategory_t::LL}, {0x001A9, 0x001A9, UnicodeCategory_t::LU}, {0x001AA, 0x001AB, UnicodeCategory_t::LL},
+        {0x001AC, 0x001AC, UnicodeCategory_t::LU}, {0x001AD, 0x001AD, UnicodeCategory_t::LL}, {0x001AE, 0x001AF, UnicodeCategory_t::LU},
+        {0x001B0, 0x001B0, UnicodeCategory_t::LL}, {0x001B1, 0x001B3, UnicodeCategory_t::LU}, {0x001B4, 0x001B4, UnicodeCategory_t::LL},
+        {0x001B5, 0x001B5, UnicodeCategory_t::LU}, {0x001B6, 0x001B6, UnicodeCategory_t::LL}, {0x001B7, 0x001B8, UnicodeCategory_t::LU},
+        {0x001B9, 0x001BA, UnicodeCategory_t::LL}, {0x001BB, 0x001BB, UnicodeCategory_t::LO}, {0x001BC, 0x001BC, UnicodeCategory_t::LU},
+        {0x001BD, 0x001BF, UnicodeCategory_t::LL}, {0x001C0, 0x001C3, UnicodeCategory_t::LO}, {0x001C4, 0x001C4, UnicodeCategory_t::LU},
+        {0x001C5, 0x001C5, UnicodeCategory_t::LT}, {0x001C6, 0x001C6, UnicodeCategory_t::LL}, {0x001C7, 0x001C7, UnicodeCategory_t::LU},
+        {0x001C8, 0x001C8, UnicodeCategory_t::LT}, {0x001C9, 0x001C9, UnicodeCategory_t::LL}, {0x001CA, 0x001CA, UnicodeCategory_t::LU},
+        {0x001CB, 0x001CB, UnicodeCategory_t::LT}, {0x001CC, 0x001CC, UnicodeCategory_t::LL}, {0x001CD, 0x001CD, UnicodeCategory_t::LU},
+        {0x001CE, 0x001CE, UnicodeCategory_t::LL}, {0x001CF, 0x001CF, UnicodeCategory_t::LU}, {0x001D0, 0x001D0, UnicodeCategory_t::LL},
+        {0x001D1, 0x001D1, UnicodeCategory_t::LU}, {0x001D2, 0x001D2, UnicodeCategory_t::LL}, {0x001D3, 0x001D3, UnicodeCategory_t::LU},
+        {0x001D4, 0x001D4, UnicodeCategory_t::LL}, {0x001D5, 0x001D5, UnicodeCategory_t::LU}, {0x001D6, 0x001D6, UnicodeCategory_t::LL},
+        {0x001D7, 0x001D7, UnicodeCategory_t::LU}, {0x001D8, 0x001D8, UnicodeCategory_t::LL}, {0x001D9, 0x001D9, UnicodeCategory_t::LU},
+        {0x001DA, 0x001DA, UnicodeCategory_t::LL}, {0x001DB, 0x001DB, UnicodeCategory_t::LU}, {0x001DC, 0x001DD, UnicodeCategory_t::LL},
+        {0x001DE, 0x001DE, UnicodeCategory_t::LU}, {0x001DF, 0x001DF, UnicodeCategory_t::LL}, {0x001E0, 0x001E0, UnicodeCategory_t::LU},
+        {0x001E1, 0x001E1, UnicodeCategory_t::LL}, {0x001E2, 0x001E2, UnicodeCategory_t::LU}, {0x001E3, 0x001E3, UnicodeCategory_t::LL},
+        {0x001E4, 0x001E4, UnicodeCategory_t::LU}, {0x001E5, 0x001E5, UnicodeCategory_t::LL}, {0x001E6, 0x001E6, UnicodeCategory_t::LU},
+        {0x001E7, 0x001E7, UnicodeCategory_t::LL}, {0x001E8, 0x001E8, UnicodeCategory_t::LU}, {0x001E9, 0x001E9, UnicodeCategory_t::LL},
+        {0x001EA, 0x001EA, UnicodeCategory_t::LU}, {0x001EB, 0x001EB, UnicodeCategory_t::LL}, {0x001EC, 0x001EC, UnicodeCategory_t::LU},
+        {0x001ED, 0x001ED, UnicodeCategory_t::LL}, {0x001EE, 0x001EE, UnicodeCategory_t::LU}, {0x001EF, 0x001F0, UnicodeCategory_t::LL},
+        {0x001F1, 0x001F1, UnicodeCategory_t::LU}, {0x001F2, 0x001F2, UnicodeCategory_t::LT}, {0x001F3, 0x001F3, UnicodeCategory_t::LL},
+        {0x001F4, 0x001F4, UnicodeCategory_t::LU}, {0x001F5, 0x001F5, UnicodeCategory_t::LL}, {0x001F6, 0x001F8, UnicodeCategory_t::LU},
+        {0x001F9, 0x001F9, UnicodeCategory_t::LL}, {0x001FA, 0x001FA, UnicodeCategory_t::LU}, {0x001FB, 0x001FB, UnicodeCategory_t::LL},
+        {0x001FC, 0x001FC, UnicodeCategory_t::LU}, {0x001FD, 0x001FD, UnicodeCategory_t::LL}, {0x001FE, 0x001FE, UnicodeCategory_t::LU},
+        {0x001FF, 0x001FF, UnicodeCategory_t::LL}, {0x00200, 0x00200, UnicodeCategory_t::LU}, {0x00201, 0x00201, UnicodeCategory_t::LL},
+        {0x00202, 0x00202, UnicodeCategory_t::LU}, {0x00203, 0x00203, UnicodeCategory_t::LL}, {0x00204, 0x00204, UnicodeCategory_t::LU},
+        {0x00205, 0x00205, UnicodeCategory_t::LL}, {0x00206, 0x00206, UnicodeCategory_t::LU}, {0x00207, 0x00207, UnicodeCategory_t::LL},
+        {0x00208, 0x00208, UnicodeCategory_t::LU}, {0x00209, 0x00209, UnicodeCategory_t::LL}, {0x0020A, 0x0020A, UnicodeCategory_t::LU},
+        {0x0020B, 0x0020B, UnicodeCategory_t::LL}, {0x0020C, 0x0020C, UnicodeCategory_t::LU}, {0x0020D, 0x0020D, UnicodeCategory_t::LL},
+        {0x0020E, 0x0020E, UnicodeCategory_t::LU}, {0x0020F, 0x0020F, UnicodeCategory_t::LL}, {0x00210, 0x00210, UnicodeCategory_t::LU},
+        {0x00211, 0x00211, UnicodeCategory_t::LL}, {0x00212, 0x00212, UnicodeCategory_t::LU}, {0x00213, 0x00213, UnicodeCategory_t::LL},
+        {0x00214, 0x00214, UnicodeCategory_t::LU}, {0x00215, 0x00215, UnicodeCategory_t::LL}, {0x00216, 0x00216, UnicodeCategory_t::LU},
+        {0x00217, 0x00217, UnicodeCategory_t::LL}, {0x00218, 0x00218, UnicodeCategory_t::LU}, {0x00219, 0x00219, UnicodeCategory_t::LL},
+        {0x0021A, 0x0021A, UnicodeCategory_t::LU}, {0x0021B, 0x0021B, UnicodeCategory_t::LL}, {0x0021C, 0x0021C, UnicodeCategory_t::LU},
+        {0x0021D, 0x0021D, UnicodeCategory_t::LL}, {0x0021E, 0x0021E, UnicodeCategory_t::LU}, {0x0021F, 0x0021F, UnicodeCategory_t::LL},
+        {0x00220, 0x00220, UnicodeCategory_t::LU}, {0x00221, 0x00221, UnicodeCategory_t::LL}, {0x00222, 0x00222, UnicodeCategory_t::LU},
+        {0x00223, 0x00223, UnicodeCategory_t::LL}, {0x00224, 0x00224, UnicodeCategory_t::LU}, {0x00225, 0x00225, UnicodeCategory_t::LL},
+        {0x00226, 0x00226, UnicodeCategory_t::LU}, {0x00227, 0x00227, UnicodeCategory_t::LL}, {0x00228, 0x00228, UnicodeCategory_t::LU},
+        {0x00229, 0x00229, UnicodeCategory_t::LL}, {0x0022A, 0x0022A, UnicodeCategory_t::LU}, {0x0022B, 0x0022B, UnicodeCategory_t::LL},
+        {0x0022C, 0x0022C, UnicodeCategory_t::LU}, {0x0022D, 0x0022D, UnicodeCategory_t::LL}, {0x0022E, 0x0022E, UnicodeCategory_t::LU},
+        {0x0022F, 0x0022F, UnicodeCategory_t::LL}, {0x00230, 0x00230, UnicodeCategory_t::LU}, {0x00231, 0x00231, UnicodeCategory_t::LL},
+        {0x00232, 0x00232, UnicodeCategory_t::LU}, {0x00233, 0x00239, UnicodeCategory_t::LL}, {0x0023A, 0x0023B, UnicodeCategory_t::LU},
+        {0x0023C, 0x0023C, UnicodeCategory_t::LL}, {0x0023D, 0x0023E, UnicodeCategory_t::LU}, {0x0023F, 0x00240, UnicodeCategory_t::LL},
+        {0x00241, 0x00241, UnicodeCategory_t::LU}, {0x00242, 0x00242, UnicodeCategory_t::LL}, {0x00243, 0x00246, UnicodeCategory_t::LU},
+        {0x00247, 0x00247, UnicodeCategory_t::LL}, {0x00248, 0x00248, UnicodeCategory_t::LU}, {0x00249, 0x00249, UnicodeCategory_t::LL},
+        {0x0024A, 0x0024A, UnicodeCategory_t::LU}, {0x0024B, 0x0024B, UnicodeCategory_t::LL}, {0x0024C, 0x0024C, UnicodeCategory_t::LU},
+        {0x0024D, 0x0024D, UnicodeCategory_t::LL}, {0x0024E, 0x0024E, UnicodeCategory_t::LU}, {0x0024F, 0x00293, UnicodeCategory_t::LL},
+        {0x00294, 0x00294, UnicodeCategory_t::LO}, {0x00295, 0x002AF, UnicodeCategory_t::LL}, {0x002B0, 0x002C1, UnicodeCategory_t::LM},
+        {0x002C2, 0x002C5, UnicodeCategory_t::SK}, {0x002C6, 0x002D1, UnicodeCategory_t::LM}, {0x002D2, 0x002DF, UnicodeCategory_t::SK},
+        {0x002E0, 0x002E4, UnicodeCategory_t::LM}, {0x002E5, 0x002EB, UnicodeCategory_t::SK}, {0x002EC, 0x002EC, UnicodeCategory_t::LM},
+        {0x002ED, 0x002ED, UnicodeCategory_t::SK}, {0x002EE, 0x002EE, UnicodeCategory_t::LM}, {0x002EF, 0x002FF, UnicodeCategory_t::SK},
+        {0x00300, 0x0036F, UnicodeCategory_t::MN}, {0x00370, 0x00370, UnicodeCategory_t::LU}, {0x00371, 0x00371, UnicodeCategory_t::LL},
+        {0x00372, 0x00372, UnicodeCategory_t::LU}, {0x00373, 0x00373, UnicodeCategory_t::LL}, {0x00374, 0x00374, UnicodeCategory_t::LM},
+        {0x00375, 0x00375, UnicodeCategory_t::SK}, {0x00376, 0x00376, UnicodeCategory_t::LU}, {0x00377, 0x00377, UnicodeCategory_t::LL},
+        {0x0037A, 0x0037A, UnicodeCategory_t::LM}, {0x0037B, 0x0037D, UnicodeCategory_t::LL}, {0x0037E, 0x0037E, UnicodeCategory_t::PO},
+        {0x0037F, 0x0037F, UnicodeCategory_t::LU}, {0x00384, 0x00385, UnicodeCategory_t::SK}, {0x00386, 0x00386, UnicodeCategory_t::LU},
+        {0x00387, 0x00387, UnicodeCategory_t::PO}, {0x00388, 0x0038A, UnicodeCategory_t::LU}, {0x0038C, 0x0038C, UnicodeCategory_t::LU},
+        {0x0038E, 0x0038F, UnicodeCategory_t::LU}, {0x00390, 0x00390, UnicodeCategory_t::LL}, {0x00391, 0x003A1, UnicodeCategory_t::LU},
+        {0x003A3, 0x003AB, UnicodeCategory_t::LU}, {0x003AC, 0x003CE, UnicodeCategory_t::LL}, {0x003CF, 0x003CF, UnicodeCategory_t::LU},
+        {0x003D0, 0x003D1, UnicodeCategory_t::LL}, {0x003D2, 0x003D4, UnicodeCategory_t::LU}, {0x003D5, 0x003D7, UnicodeCategory_t::LL},
+        {0x003D8, 0x003D8, UnicodeCategory_t::LU}, {0x003D9, 0x003D9, UnicodeCategory_t::LL}, {0x003DA, 0x003DA, UnicodeCategory_t::LU},
+        {0x003DB, 0x003DB, UnicodeCategory_t::LL}, {0x003DC, 0x003DC, UnicodeCategory_t::LU}, {0x003DD, 0x003DD, UnicodeCategory_t::LL},
+        {0x003DE, 0x003DE, UnicodeCategory_t::LU}, {0x003DF, 0x003DF, UnicodeCategory_t::LL}, {0x003E0, 0x003E0, UnicodeCategory_t::LU},
+        {0x003E1, 0x003E1, UnicodeCategory_t::LL}, {0x003E2, 0x003E2, UnicodeCategory_t::LU}, {0x003E3, 0x003E3, UnicodeCategory_t::LL},
+        {0x003E4, 0x003E4, UnicodeCategory_t::LU}, {0x003E5, 0x003E5, UnicodeCategory_t::LL}, {0x003E6, 0x003E6, UnicodeCategory_t::LU},
+        {0x003E7, 0x003E7, UnicodeCategory_t::LL}, {0x003E8, 0x003E8, UnicodeCategory_t::LU}, {0x003E9, 0x003E9, UnicodeCategory_t::LL},
+        {0x003EA, 0x003EA, UnicodeCategory_t::LU}, {0x003EB, 0x003EB, UnicodeCategory_t::LL}, {0x003EC, 0x003EC, UnicodeCategory_t::LU},
+        {0x003ED, 0x003ED, UnicodeCategory_t::LL}, {0x003EE, 0x003EE, UnicodeCategory_t::LU}, {0x003EF, 0x003F3, UnicodeCategory_t::LL},
+        {0x003F4, 0x003F4, UnicodeCategory_t::LU}, {0x003F5, 0x003F5, UnicodeCategory_t::LL}, {0x003F6, 0x003F6, UnicodeCategory_t::SM},
+        {0x003F7, 0x003F7, UnicodeCategory_t::LU}, {0x003F8, 0x003F8, UnicodeCategory_t::LL}, {0x003F9, 0x003FA, UnicodeCategory_t::LU},
+        {0x003FB, 0x003FC, UnicodeCategory_t::LL}, {0x003FD, 0x0042F, UnicodeCategory_t::LU}, {0x00430, 0x0045F, UnicodeCategory_t::LL},
+        {0x00460, 0x00460, UnicodeCategory_t::LU}, {0x00461, 0x00461, UnicodeCategory_t::LL}, {0x00462, 0x00462, UnicodeCategory_t::LU},
+        {0x00463, 0x00463, UnicodeCategory_t::LL}, {0x00464, 0x00464, UnicodeCategory_t::LU}, {0x00465, 0x00465, UnicodeCategory_t::LL},
+        {0x00466, 0x00466, UnicodeCategory_t::LU}, {0x00467, 0x00467, UnicodeCategory_t::LL}, {0x00468, 0x00468, UnicodeCategory_t::LU},
+        {0x00469, 0x00469, UnicodeCategory_t::LL}, {0x0046A, 0x0046A, UnicodeCategory_t::LU}, {0x0046B, 0x0046B, UnicodeCategory_t::LL},
+        {0x0046C, 0x0046C, UnicodeCategory_t::LU}, {0x0046D, 0x0046D, UnicodeCategory_t::LL}, {0x0046E, 0x0046E, UnicodeCategory_t::LU},
+        {0x0046F, 0x0046F, UnicodeCategory_t::LL}, {0x00470, 0x00470, UnicodeCategory_t::LU}, {0x00471, 0x00471, UnicodeCategory_t::LL},
+        {0x00472, 0x00472, UnicodeCategory_t::LU}, {0x00473, 0x00473, UnicodeCategory_t::LL}, {0x00474, 0x00474, UnicodeCategory_t::LU},
+        {0x00475, 0x00475, UnicodeCategory_t::LL}, {0x00476, 0x00476, UnicodeCategory_t::LU}, {0x00477, 0x00477, UnicodeCategory_t::LL},
+        {0x00478, 0x00478, UnicodeCategory_t::LU}, {0x00479, 0x00479, UnicodeCategory_t::LL}, {0x0047A, 0x0047A, UnicodeCategory_t::LU},
+        {0x0047B, 0x0047B, UnicodeCategory_t::LL}, {0x0047C, 0x0047C, UnicodeCategory_t::LU}, {0x0047D, 0x0047D, UnicodeCategory_t::LL},
+        {0x0047E, 0x0047E, UnicodeCategory_t::LU}, {0x0047F, 0x0047F, UnicodeCategory_t::LL}, {0x00480, 0x00480, UnicodeCategory_t::LU},
+        {0x00481, 0x00481, UnicodeCategory_t::LL}, {0x00482, 0x00482, UnicodeCategory_t::SO}, {0x00483, 0x00487, UnicodeCategory_t::MN},
+        {0x00488, 0x00489, UnicodeCategory_t::ME}, {0x0048A, 0x0048A, UnicodeCategory_t::LU}, {0x0048B, 0x0048B, UnicodeCategory_t::LL},
+        {0x0048C, 0x0048C, UnicodeCategory_t::LU}, {0x0048D, 0x0048D, UnicodeCategory_t::LL}, {0x0048E, 0x0048E, UnicodeCategory_t::LU},
+        {0x0048F, 0x0048F, UnicodeCategory_t::LL}, {0x00490, 0x00490, UnicodeCategory_t::LU}, {0x00491, 0x00491, UnicodeCategory_t::LL},
+        {0x00492, 0x00492, UnicodeCategory_t::LU}, {0x00493, 0x00493, UnicodeCategory_t::LL}, {0x00494, 0x00494, UnicodeCategory_t::LU},
+        {0x00495, 0x00495, UnicodeCategory_t::LL}, {0x00496, 0x00496, UnicodeCategory_t::LU}, {0x00497, 0x00497, UnicodeCategory_t::LL},
+        {0x00498, 0x00498, UnicodeCategory_t::LU}, {0x00499, 0x00499, UnicodeCategory_t::LL}, {0x0049A, 0x0049A, UnicodeCategory_t::LU},
+        {0x0049B, 0x0049B, UnicodeCategory_t::LL}, {0x0049C, 0x0049C, UnicodeCategory_t::LU}, {0x0049D, 0x0049D, UnicodeCategory_t::LL},
+        {0x0049E, 0x0049E, UnicodeCategory_t::LU}, {0x0049F, 0x0049F, UnicodeCategory_t::LL}, {0x004A0, 0x004A0, UnicodeCategory_t::LU},
+        {0x004A1, 0x004A1, UnicodeCategory_t::LL}, {0x004A2, 0x004A2, UnicodeCategory_t::LU}, {0x004A3, 0x004A3, UnicodeCategory_t::LL},
+        {0x004A4, 0x004A4, UnicodeCategory_t::LU}, {0x004A5, 0x004A5, UnicodeCategory_t::LL}, {0x004A6, 0x004A6, UnicodeCategory_t::LU},
+        {0x004A7, 0x004A7, UnicodeCategory_t::LL}, {0x004A8, 0x004A8, UnicodeCategory_t::LU}, {0x004A9, 0x004A9, UnicodeCategory_t::LL},
+        {0x004AA, 0x004AA, UnicodeCategory_t::LU}, {0x004AB, 0x004AB, UnicodeCategory_t::LL}, {0x004AC, 0x004AC, UnicodeCategory_t::LU},
+        {0x004AD, 0x004AD, UnicodeCategory_t::LL}, {0x004AE, 0x004AE, UnicodeCategory_t::LU}, {0x004AF, 0x004AF, UnicodeCategory_t::LL},
+        {0x004B0, 0x004B0, UnicodeCategory_t::LU}, {0x004B1, 0x004B1, UnicodeCategory_t::LL}, {0x004B2, 0x004B2, UnicodeCategory_t::LU},
+        {0x004B3, 0x004B3, UnicodeCategory_t::LL}, {0x004B4, 0x004B4, UnicodeCategory_t::LU}, {0x004B5, 0x004B5, UnicodeCategory_t::LL},
+        {0x004B6, 0x004B6, UnicodeCategory_t::LU}, {0x004B7, 0x004B7, UnicodeCategory_t::LL}, {0x004B8, 0x004B8, UnicodeCategory_t::LU},
+        {0x004B9, 0x004B9, UnicodeCategory_t::LL}, {0x004BA, 0x004BA, UnicodeCategory_t::LU}, {0x004BB, 0x004BB, UnicodeCategory_t::LL},
+        {0x004BC, 0x004BC, UnicodeCategory_t::LU}, {0x004BD, 0x004BD, UnicodeCategory_t::LL}, {0x004BE, 0x004BE, UnicodeCategory_t::LU},
+        {0x004BF, 0x004BF, UnicodeCategory_t::LL}, {0x004C0, 0x004C1, UnicodeCategory_t::LU}, {0x004C2, 0x004C2, UnicodeCategory_t::LL},
+        {0x004C3, 0x004C3, UnicodeCategory_t::LU}, {0x004C4, 0x004C4, UnicodeCategory_t::LL}, {0x004C5, 0x004C5, UnicodeCategory_t::LU},
+        {0x004C6, 0x004C6, UnicodeCategory_t::LL}, {0x004C7, 0x004C7, UnicodeCategory_t::LU}, {0x004C8, 0x004C8, UnicodeCategory_t::LL},
+        {0x004C9, 0x004C9, UnicodeCategory_t::LU}, {0x004CA, 0x004CA, UnicodeCategory_t::LL}, {0x004CB, 0x004CB, UnicodeCategory_t::LU},
+        {0x004CC, 0x004CC, UnicodeCategory_t::LL}, {0x004CD, 0x004CD, UnicodeCategory_t::LU}, {0x004CE, 0x004CF, UnicodeCategory_t::LL},
+        {0x004D0, 0x004D0, UnicodeCategory_t::LU}, {0x004D1, 0x004D1, UnicodeCategory_t::LL}, {0x004D2, 0x004D2, UnicodeCategory_t::LU},
+        {0x004D3, 0x004D3, UnicodeCategory_t::LL}, {0x004D4, 0x004D4, UnicodeCategory_t::LU}, {0x004D5, 0x004D5, UnicodeCategory_t::LL},
+        {0x004D6, 0x004D6, UnicodeCategory_t::LU}, {0x004D7, 0x004D7, UnicodeCategory_t::LL}, {0x004D8, 0x004D8, UnicodeCategory_t::LU},
+        {0x004D9, 0x004D9, UnicodeCategory_t::LL}, {0x004DA, 0x004DA, UnicodeCategory_t::LU}, {0x004DB, 0x004DB, UnicodeCategory_t::LL},
+        {0x004DC, 0x004DC, UnicodeCategory_t::LU}, {0x004DD, 0x004DD, UnicodeCategory_t::LL}, {0x004DE, 0x004DE, UnicodeCategory_t::LU},
+        {0x004DF, 0x004DF, UnicodeCategory_t::LL}, {0x004E0, 0x004E0, UnicodeCategory_t::LU}, {0x004E1, 0x004E1, UnicodeCategory_t::LL},
+        {0x004E2, 0x004E2, UnicodeCategory_t::LU}, {0x004E3, 0x004E3, UnicodeCategory_t::LL}, {0x004E4, 0x004E4, UnicodeCategory_t::LU},
+        {0x004E5, 0x004E5, UnicodeCategory_t::LL}, {0x004E6, 0x004E6, UnicodeCategory_t::LU}, {0x004E7, 0x004E7, UnicodeCategory_t::LL},
+        {0x004E8, 0x004E8, UnicodeCategory_t::LU}, {0x004E9, 0x004E9, UnicodeCategory_t::LL}, {0x004EA, 0x004EA, UnicodeCategory_t::LU},
+        {0x004EB, 0x004EB, UnicodeCategory_t::LL}, {0x004EC, 0x004EC, UnicodeCategory_t::LU}, {0x004ED, 0x004ED, UnicodeCategory_t::LL},
+        {0x004EE, 0x004EE, UnicodeCategory_t::LU}, {0x004EF, 0x004EF, UnicodeCategory_t::LL}, {0x004F0, 0x004F0, UnicodeCategory_t::LU},
+        {0x004F1, 0x004F1, UnicodeCategory_t::LL}, {0x004F2, 0x004F2, UnicodeCategory_t::LU}, {0x004F3, 0x004F3, UnicodeCategory_t::LL},
+        {0x004F4, 0x004F4, UnicodeCategory_t::LU}, {0x004F5, 0x004F5, UnicodeCategory_t::LL}, {0x004F6, 0x004F6, UnicodeCategory_t::LU},
+        {0x004F7, 0x004F7, UnicodeCategory_t::LL}, {0x004F8, 0x004F8, UnicodeCategory_t::LU}, {0x004F9, 0x004F9, UnicodeCategory_t::LL},
+        {0x004FA, 0x004FA, UnicodeCategory_t::LU}, {0x004FB, 0x004FB, UnicodeCategory_t::LL}, {0x004FC, 0x004FC, UnicodeCategory_t::LU},
+        {0x004FD, 0x004FD, UnicodeCategory_t::LL}, {0x004FE, 0x004FE, UnicodeCategory_t::LU}, {0x004FF, 0x004FF, UnicodeCategory_t::LL},
+        {0x00500, 0x00500, UnicodeCategory_t::LU}, {0x00501, 0x00501, UnicodeCategory_t::LL}, {0x00502, 0x00502, UnicodeCategory_t::LU},
+        {0x00503, 0x00503, UnicodeCategory_t::LL}, {0x00504, 0x00504, UnicodeCategory_t::LU}, {0x00505, 0x00505, UnicodeCategory_t::LL},
+        {0x00506, 0x00506, UnicodeCategory_t::LU}, {0x00507, 0x00507, UnicodeCategory_t::LL}, {0x00508, 0x00508, UnicodeCategory_t::LU},
+        {0x00509, 0x00509, UnicodeCategory_t::LL}, {0x0050A, 0x0050A, UnicodeCategory_t::LU}, {0x0050B, 0x0050B, UnicodeCategory_t::LL},
+        {0x0050C, 0x0050C, UnicodeCategory_t::LU}, {0x0050D, 0x0050D, UnicodeCategory_t::LL}, {0x0050E, 0x0050E, UnicodeCategory_t::LU},
+        {0x0050F, 0x0050F, UnicodeCategory_t::LL}, {0x00510, 0x00510, UnicodeCategory_t::LU}, {0x00511, 0x00511, UnicodeCategory_t::LL},
+        {0x00512, 0x00512, UnicodeCategory_t::LU}, {0x00513, 0x00513, UnicodeCategory_t::LL}, {0x00514, 0x00514, UnicodeCategory_t::LU},
+        {0x00515, 0x00515, UnicodeCategory_t::LL}, {0x00516, 0x00516, UnicodeCategory_t::LU}, {0x00517, 0x00517, UnicodeCategory_t::LL},
+        {0x00518, 0x00518, UnicodeCategory_t::LU}, {0x00519, 0x00519, UnicodeCategory_t::LL}, {0x0051A, 0x0051A, UnicodeCategory_t::LU},
+        {0x0051B, 0x0051B, UnicodeCategory_t::LL}, {0x0051C, 0x0051C, UnicodeCategory_t::LU}, {0x0051D, 0x0051D, UnicodeCategory_t::LL},
+        {0x0051E, 0x0051E, UnicodeCategory_t::LU}, {0x0051F, 0x0051F, UnicodeCategory_t::LL}, {0x00520, 0x00520, UnicodeCategory_t::LU},
+        {0x00521, 0x00521, UnicodeCategory_t::LL}, {0x00522, 0x00522, UnicodeCategory_t::LU}, {0x00523, 0x00523, UnicodeCategory_t::LL},
+        {0x00524, 0x00524, UnicodeCategory_t::LU}, {0x00525, 0x00525, UnicodeCategory_t::LL}, {0x00526, 0x00526, UnicodeCategory_t::LU},
+        {0x00527, 0x00527, UnicodeCategory_t::LL}, {0x00528, 0x00528, UnicodeCategory_t::LU}, {0x00529, 0x00529, UnicodeCategory_t::LL},
+        {0x0052A, 0x0052A, UnicodeCategory_t::LU}, {0x0052B, 0x0052B, UnicodeCategory_t::LL}, {0x0052C, 0x0052C, UnicodeCategory_t::LU},
+        {0x0052D, 0x0052D, UnicodeCategory_t::LL}, {0x0052E, 0x0052E, UnicodeCategory_t::LU}, {0x0052F, 0x0052F, UnicodeCategory_t::LL},
+        {0x00531, 0x00556, UnicodeCategory_t::LU}, {0x00559, 0x00559, UnicodeCategory_t::LM}, {0x0055A, 0x0055F, UnicodeCategory_t::PO},
+        {0x00560, 0x00588, UnicodeCategory_t::LL}, {0x00589, 0x00589, UnicodeCategory_t::PO}, {0x0058A, 0x0058A, UnicodeCategory_t::PD},
+        {0x0058D, 0x0058E, UnicodeCategory_t::SO}, {0x0058F, 0x0058F, UnicodeCategory_t::SC}, {0x00591, 0x005BD, UnicodeCategory_t::MN},
+        {0x005BE, 0x005BE, UnicodeCategory_t::PD}, {0x005BF, 0x005BF, UnicodeCategory_t::MN}, {0x005C0, 0x005C0, UnicodeCategory_t::PO},
+        {0x005C1, 0x005C2, UnicodeCategory_t::MN}, {0x005C3, 0x005C3, UnicodeCategory_t::PO}, {0x005C4, 0x005C5, UnicodeCategory_t::MN},
+        {0x005C6, 0x005C6, UnicodeCategory_t::PO}, {0x005C7, 0x005C7, UnicodeCategory_t::MN}, {0x005D0, 0x005EA, UnicodeCategory_t::LO},
+        {0x005EF, 0x005F2, UnicodeCategory_t::LO}, {0x005F3, 0x005F4, UnicodeCategory_t::PO}, {0x00600, 0x00605, UnicodeCategory_t::CF},
+        {0x00606, 0x00608, UnicodeCategory_t::SM}, {0x00609, 0x0060A, UnicodeCategory_t::PO}, {0x0060B, 0x0060B, UnicodeCategory_t::SC},
+        {0x0060C, 0x0060D, UnicodeCategory_t::PO}, {0x0060E, 0x0060F, UnicodeCategory_t::SO}, {0x00610, 0x0061A, UnicodeCategory_t::MN},
+        {0x0061B, 0x0061B, UnicodeCategory_t::PO}, {0x0061C, 0x0061C, UnicodeCategory_t::CF}, {0x0061D, 0x0061F, UnicodeCategory_t::PO},
+        {0x00620, 0x0063F, UnicodeCategory_t::LO}, {0x00640, 0x00640, UnicodeCategory_t::LM}, {0x00641, 0x0064A, UnicodeCategory_t::LO},
+        {0x0064B, 0x0065F, UnicodeCategory_t::MN}, {0x00660, 0x00669, UnicodeCategory_t::ND}, {0x0066A, 0x0066D, UnicodeCategory_t::PO},
+        {0x0066E, 0x0066F, UnicodeCategory_t::LO}, {0x00670, 0x00670, UnicodeCategory_t::MN}, {0x00671, 0x006D3, UnicodeCategory_t::LO},
+        {0x006D4, 0x006D4, UnicodeCategory_t::PO}, {0x006D5, 0x006D5, UnicodeCategory_t::LO}, {0x006D6, 0x006DC, UnicodeCategory_t::MN},
+        {0x006DD, 0x006DD, UnicodeCategory_t::CF}, {0x006DE, 0x006DE, UnicodeCategory_t::SO}, {0x006DF, 0x006E4, UnicodeCategory_t::MN},
+        {0x006E5, 0x006E6, UnicodeCategory_t::LM}, {0x006E7, 0x006E8, UnicodeCategory_t::MN}, {0x006E9, 0x006E9, UnicodeCategory_t::SO},
+        {0x006EA, 0x006ED, UnicodeCategory_t::MN}, {0x006EE, 0x006EF, UnicodeCategory_t::LO}, {0x006F0, 0x006F9, UnicodeCategory_t::ND},
+        {0x006FA, 0x006FC, UnicodeCategory_t::LO}, {0x006FD, 0x006FE, UnicodeCategory_t::SO}, {0x006FF, 0x006FF, UnicodeCategory_t::LO},
+        {0x00700, 0x0070D, UnicodeCategory_t::PO}, {0x0070F, 0x0070F, UnicodeCategory_t::CF}, {0x00710, 0x00710, UnicodeCategory_t::LO},
+        {0x00711, 0x00711, UnicodeCategory_t::MN}, {0x00712, 0x0072F, UnicodeCategory_t::LO}, {0x00730, 0x0074A, UnicodeCategory_t::MN},
+        {0x0074D, 0x007A5, UnicodeCategory_t::LO}, {0x007A6, 0x007B0, UnicodeCategory_t::MN}, {0x007B1, 0x007B1, UnicodeCategory_t::LO},
+        {0x007C0, 0x007C9, UnicodeCategory_t::ND}, {0x007CA, 0x007EA, UnicodeCategory_t::LO}, {0x007EB, 0x007F3, UnicodeCategory_t::MN},
+        {0x007F4, 0x007F5, UnicodeCategory_t::LM}, {0x007F6, 0x007F6, UnicodeCategory_t::SO}, {0x007F7, 0x007F9, UnicodeCategory_t::PO},
+        {0x007FA, 0x007FA, UnicodeCategory_t::LM}, {0x007FD, 0x007FD, UnicodeCategory_t::MN}, {0x007FE, 0x007FF, UnicodeCategory_t::SC},
+        {0x00800, 0x00815, UnicodeCategory_t::LO}, {0x00816, 0x00819, UnicodeCategory_t::MN}, {0x0081A, 0x0081A, UnicodeCategory_t::LM},
+        {0x0081B, 0x00823, UnicodeCategory_t::MN}, {0x00824, 0x00824, UnicodeCategory_t::LM}, {0x00825, 0x00827, UnicodeCategory_t::MN},
+        {0x00828, 0x00828, UnicodeCategory_t::LM}, {0x00829, 0x0082D, UnicodeCategory_t::MN}, {0x00830, 0x0083E, UnicodeCategory_t::PO},
+        {0x00840, 0x00858, UnicodeCategory_t::LO}, {0x00859, 0x0085B, UnicodeCategory_t::MN}, {0x0085E, 0x0085E, UnicodeCategory_t::PO},
+        {0x00860, 0x0086A, UnicodeCategory_t::LO}, {0x00870, 0x00887, UnicodeCategory_t::LO}, {0x00888, 0x00888, UnicodeCategory_t::SK},
+        {0x00889, 0x0088E, UnicodeCategory_t::LO}, {0x00890, 0x00891, UnicodeCategory_t::CF}, {0x00898, 0x0089F, UnicodeCategory_t::MN},
+        {0x008A0, 0x008C8, UnicodeCategory_t::LO}, {0x008C9, 0x008C9, UnicodeCategory_t::LM}, {0x008CA, 0x008E1, UnicodeCategory_t::MN},
+        {0x008E2, 0x008E2, UnicodeCategory_t::CF}, {0x008E3, 0x00902, UnicodeCategory_t::MN}, {0x00903, 0x00903, UnicodeCategory_t::MC},
+        {0x00904, 0x00939, UnicodeCategory_t::LO}, {0x0093A, 0x0093A, UnicodeCategory_t::MN}, {0x0093B, 0x0093B, UnicodeCategory_t::MC},
+        {0x0093C, 0x0093C, UnicodeCategory_t::MN}, {0x0093D, 0x0093D, UnicodeCategory_t::LO}, {0x0093E, 0x00940, UnicodeCategory_t::MC},
+        {0x00941, 0x00948, UnicodeCategory_t::MN}, {0x00949, 0x0094C, UnicodeCategory_t::MC}, {0x0094D, 0x0094D, UnicodeCategory_t::MN},
+        {0x0094E, 0x0094F, UnicodeCategory_t::MC}, {0x00950, 0x00950, UnicodeCategory_t::LO}, {0x00951, 0x00957, UnicodeCategory_t::MN},
+        {0x00958, 0x00961, UnicodeCategory_t::LO}, {0x00962, 0x00963, UnicodeCategory_t::MN}, {0x00964, 0x00965, UnicodeCategory_t::PO},
+        {0x00966, 0x0096F, UnicodeCategory_t::ND}, {0x00970, 0x00970, UnicodeCategory_t::PO}, {0x00971, 0x00971, UnicodeCategory_t::LM},
+        {0x00972, 0x00980, UnicodeCategory_t::LO}, {0x00981, 0x00981, UnicodeCategory_t::MN}, {0x00982, 0x00983, UnicodeCategory_t::MC},
+        {0x00985, 0x0098C, UnicodeCategory_t::LO}, {0x0098F, 0x00990, UnicodeCategory_t::LO}, {0x00993, 0x009A8, UnicodeCategory_t::LO},
+        {0x009AA, 0x009B0, UnicodeCategory_t::LO}, {0x009B2, 0x009B2, UnicodeCategory_t::LO}, {0x009B6, 0x009B9, UnicodeCategory_t::LO},
+        {0x009BC, 0x009BC, UnicodeCategory_t::MN}, {0x009BD, 0x009BD, UnicodeCategory_t::LO}, {0x009BE, 0x009C0, UnicodeCategory_t::MC},
+        {0x009C1, 0x009C4, UnicodeCategory_t::MN}, {0x009C7, 0x009C8, UnicodeCategory_t::MC}, {0x009CB, 0x009CC, UnicodeCategory_t::MC},
+        {0x009CD, 0x009CD, UnicodeCategory_t::MN}, {0x009CE, 0x009CE, UnicodeCategory_t::LO}, {0x009D7, 0x009D7, UnicodeCategory_t::MC},
+        {0x009DC, 0x009DD, UnicodeCategory_t::LO}, {0x009DF, 0x009E1, UnicodeCategory_t::LO}, {0x009E2, 0x009E3, UnicodeCategory_t::MN},
+        {0x009E6, 0x009EF, UnicodeCategory_t::ND}, {0x009F0, 0x009F1, UnicodeCategory_t::LO}, {0x009F2, 0x009F3, UnicodeCategory_t::SC},
+        {0x009F4, 0x009F9, UnicodeCategory_t::NO}, {0x009FA, 0x009FA, UnicodeCategory_t::SO}, {0x009FB, 0x009FB, UnicodeCategory_t::SC},
+        {0x009FC, 0x009FC, UnicodeCategory_t::LO}, {0x009FD, 0x009FD, UnicodeCategory_t::PO}, {0x009FE, 0x009FE, UnicodeCategory_t::MN},
+        {0x00A01, 0x00A02, UnicodeCategory_t::MN}, {0x00A03, 0x00A03, UnicodeCategory_t::MC}, {0x00A05, 0x00A0A, UnicodeCategory_t::LO},
+        {0x00A0F, 0x00A10, UnicodeCategory_t::LO}, {0x00A13, 0x00A28, UnicodeCategory_t::LO}, {0x00A2A, 0x00A30, UnicodeCategory_t::LO},
+        {0x00A32, 0x00A33, UnicodeCategory_t::LO}, {0x00A35, 0x00A36, UnicodeCategory_t::LO}, {0x00A38, 0x00A39, UnicodeCategory_t::LO},
+        {0x00A3C, 0x00A3C, UnicodeCategory_t::MN}, {0x00A3E, 0x00A40, UnicodeCategory_t::MC}, {0x00A41, 0x00A42, UnicodeCategory_t::MN},
+        {0x00A47, 0x00A48, UnicodeCategory_t::MN}, {0x00A4B, 0x00A4D, UnicodeCategory_t::MN}, {0x00A51, 0x00A51, UnicodeCategory_t::MN},
+        {0x00A59, 0x00A5C, UnicodeCategory_t::LO}, {0x00A5E, 0x00A5E, UnicodeCategory_t::LO}, {0x00A66, 0x00A6F, UnicodeCategory_t::ND},
+        {0x00A70, 0x00A71, UnicodeCategory_t::MN}, {0x00A72, 0x00A74, UnicodeCategory_t::LO}, {0x00A75, 0x00A75, UnicodeCategory_t::MN},
+        {0x00A76, 0x00A76, UnicodeCategory_t::PO}, {0x00A81, 0x00A82, UnicodeCategory_t::MN}, {0x00A83, 0x00A83, UnicodeCategory_t::MC},
+        {0x00A85, 0x00A8D, UnicodeCategory_t::LO}, {0x00A8F, 0x00A91, UnicodeCategory_t::LO}, {0x00A93, 0x00AA8, UnicodeCategory_t::LO},
+        {0x00AAA, 0x00AB0, UnicodeCategory_t::LO}, {0x00AB2, 0x00AB3, UnicodeCategory_t::LO}, {0x00AB5, 0x00AB9, UnicodeCategory_t::LO},
+        {0x00ABC, 0x00ABC, UnicodeCategory_t::MN}, {0x00ABD, 0x00ABD, UnicodeCategory_t::LO}, {0x00ABE, 0x00AC0, UnicodeCategory_t::MC},
+        {0x00AC1, 0x00AC5, UnicodeCategory_t::MN}, {0x00AC7, 0x00AC8, UnicodeCategory_t::MN}, {0x00AC9, 0x00AC9, UnicodeCategory_t::MC},
+        {0x00ACB, 0x00ACC, UnicodeCategory_t::MC}, {0x00ACD, 0x00ACD, UnicodeCategory_t::MN}, {0x00AD0, 0x00AD0, UnicodeCategory_t::LO},
+        {0x00AE0, 0x00AE1, UnicodeCategory_t::LO}, {0x00AE2, 0x00AE3, UnicodeCategory_t::MN}, {0x00AE6, 0x00AEF, UnicodeCategory_t::ND},
+        {0x00AF0, 0x00AF0, UnicodeCategory_t::PO}, {0x00AF1, 0x00AF1, UnicodeCategory_t::SC}, {0x00AF9, 0x00AF9, UnicodeCategory_t::LO},
+        {0x00AFA, 0x00AFF, UnicodeCategory_t::MN}, {0x00B01, 0x00B01, UnicodeCategory_t::MN}, {0x00B02, 0x00B03, UnicodeCategory_t::MC},
+        {0x00B05, 0x00B0C, UnicodeCategory_t::LO}, {0x00B0F, 0x00B10, UnicodeCategory_t::LO}, {0x00B13, 0x00B28, UnicodeCategory_t::LO},
+        {0x00B2A, 0x00B30, UnicodeCategory_t::LO}, {0x00B32, 0x00B33, UnicodeCategory_t::LO}, {0x00B35, 0x00B39, UnicodeCategory_t::LO},
+        {0x00B3C, 0x00B3C, UnicodeCategory_t::MN}, {0x00B3D, 0x00B3D, UnicodeCategory_t::LO}, {0x00B3E, 0x00B3E, UnicodeCategory_t::MC},
+        {0x00B3F, 0x00B3F, UnicodeCategory_t::MN}, {0x00B40, 0x00B40, UnicodeCategory_t::MC}, {0x00B41, 0x00B44, UnicodeCategory_t::MN},
+        {0x00B47, 0x00B48, UnicodeCategory_t::MC}, {0x00B4B, 0x00B4C, UnicodeCategory_t::MC}, {0x00B4D, 0x00B4D, UnicodeCategory_t::MN},
+        {0x00B55, 0x00B56, UnicodeCategory_t::MN}, {0x00B57, 0x00B57, UnicodeCategory_t::MC}, {0x00B5C, 0x00B5D, UnicodeCategory_t::LO},
+        {0x00B5F, 0x00B61, UnicodeCategory_t::LO}, {0x00B62, 0x00B63, UnicodeCategory_t::MN}, {0x00B66, 0x00B6F, UnicodeCategory_t::ND},
+        {0x00B70, 0x00B70, UnicodeCategory_t::SO}, {0x00B71, 0x00B71, UnicodeCategory_t::LO}, {0x00B72, 0x00B77, UnicodeCategory_t::NO},
+        {0x00B82, 0x00B82, UnicodeCategory_t::MN}, {0x00B83, 0x00B83, UnicodeCategory_t::LO}, {0x00B85, 0x00B8A, UnicodeCategory_t::LO},
+        {0x00B8E, 0x00B90, UnicodeCategory_t::LO}, {0x00B92, 0x00B95, UnicodeCategory_t::LO}, {0x00B99, 0x00B9A, UnicodeCategory_t::LO},
+        {0x00B9C, 0x00B9C, UnicodeCategory_t::LO}, {0x00B9E, 0x00B9F, UnicodeCategory_t::LO}, {0x00BA3, 0x00BA4, UnicodeCategory_t::LO},
+        {0x00BA8, 0x00BAA, UnicodeCategory_t::LO}, {0x00BAE, 0x00BB9, UnicodeCategory_t::LO}, {0x00BBE, 0x00BBF, UnicodeCategory_t::MC},
+        {0x00BC0, 0x00BC0, UnicodeCategory_t::MN}, {0x00BC1, 0x00BC2, UnicodeCategory_t::MC}, {0x00BC6, 0x00BC8, UnicodeCategory_t::MC},
+        {0x00BCA, 0x00BCC, UnicodeCategory_t::MC}, {0x00BCD, 0x00BCD, UnicodeCategory_t::MN}, {0x00BD0, 0x00BD0, UnicodeCategory_t::LO},
+        {0x00BD7, 0x00BD7, UnicodeCategory_t::MC}, {0x00BE6, 0x00BEF, UnicodeCategory_t::ND}, {0x00BF0, 0x00BF2, UnicodeCategory_t::NO},
+        {0x00BF3, 0x00BF8, UnicodeCategory_t::SO}, {0x00BF9, 0x00BF9, UnicodeCategory_t::SC}, {0x00BFA, 0x00BFA, UnicodeCategory_t::SO},
+        {0x00C00, 0x00C00, UnicodeCategory_t::MN}, {0x00C01, 0x00C03, UnicodeCategory_t::MC}, {0x00C04, 0x00C04, UnicodeCategory_t::MN},
+        {0x00C05, 0x00C0C, UnicodeCategory_t::LO}, {0x00C0E, 0x00C10, UnicodeCategory_t::LO}, {0x00C12, 0x00C28, UnicodeCategory_t::LO},
+        {0x00C2A, 0x00C39, UnicodeCategory_t::LO}, {0x00C3C, 0x00C3C, UnicodeCategory_t::MN}, {0x00C3D, 0x00C3D, UnicodeCategory_t::LO},
+        {0x00C3E, 0x00C40, UnicodeCategory_t::MN}, {0x00C41, 0x00C44, UnicodeCategory_t::MC}, {0x00C46, 0x00C48, UnicodeCategory_t::MN},
+        {0x00C4A, 0x00C4D, UnicodeCategory_t::MN}, {0x00C55, 0x00C56, UnicodeCategory_t::MN}, {0x00C58, 0x00C5A, UnicodeCategory_t::LO},
+        {0x00C5D, 0x00C5D, UnicodeCategory_t::LO}, {0x00C60, 0x00C61, UnicodeCategory_t::LO}, {0x00C62, 0x00C63, UnicodeCategory_t::MN},
+        {0x00C66, 0x00C6F, UnicodeCategory_t::ND}, {0x00C77, 0x00C77, UnicodeCategory_t::PO}, {0x00C78, 0x00C7E, UnicodeCategory_t::NO},
+        {0x00C7F, 0x00C7F, UnicodeCategory_t::SO}, {0x00C80, 0x00C80, UnicodeCategory_t::LO}, {0x00C81, 0x00C81, UnicodeCategory_t::MN},
+        {0x00C82, 0x00C83, UnicodeCategory_t::MC}, {0x00C84, 0x00C84, UnicodeCategory_t::PO}, {0x00C85, 0x00C8C, UnicodeCategory_t::LO},
+        {0x00C8E, 0x00C90, UnicodeCategory_t::LO}, {0x00C92, 0x00CA8, UnicodeCategory_t::LO}, {0x00CAA, 0x00CB3, UnicodeCategory_t::LO},
+        {0x00CB5, 0x00CB9, UnicodeCategory_t::LO}, {0x00CBC, 0x00CBC, UnicodeCategory_t::MN}, {0x00CBD, 0x00CBD, UnicodeCategory_t::LO},
+        {0x00CBE, 0x00CBE, UnicodeCategory_t::MC}, {0x00CBF, 0x00CBF, UnicodeCategory_t::MN}, {0x00CC0, 0x00CC4, UnicodeCategory_t::MC},
+        {0x00CC6, 0x00CC6, UnicodeCategory_t::MN}, {0x00CC7, 0x00CC8, UnicodeCategory_t::MC}, {0x00CCA, 0x00CCB, UnicodeCategory_t::MC},
+        {0x00CCC, 0x00CCD, UnicodeCategory_t::MN}, {0x00CD5, 0x00CD6, UnicodeCategory_t::MC}, {0x00CDD, 0x00CDE, UnicodeCategory_t::LO},
+        {0x00CE0, 0x00CE1, UnicodeCategory_t::LO}, {0x00CE2, 0x00CE3, UnicodeCategory_t::MN}, {0x00CE6, 0x00CEF, UnicodeCategory_t::ND},
+        {0x00CF1, 0x00CF2, UnicodeCategory_t::LO}, {0x00D00, 0x00D01, UnicodeCategory_t::MN}, {0x00D02, 0x00D03, UnicodeCategory_t::MC},
+        {0x00D04, 0x00D0C, UnicodeCategory_t::LO}, {0x00D0E, 0x00D10, UnicodeCategory_t::LO}, {0x00D12, 0x00D3A, UnicodeCategory_t::LO},
+        {0x00D3B, 0x00D3C, UnicodeCategory_t::MN}, {0x00D3D, 0x00D3D, UnicodeCategory_t::LO}, {0x00D3E, 0x00D40, UnicodeCategory_t::MC},
+        {0x00D41, 0x00D44, UnicodeCategory_t::MN}, {0x00D46, 0x00D48, UnicodeCategory_t::MC}, {0x00D4A, 0x00D4C, UnicodeCategory_t::MC},
+        {0x00D4D, 0x00D4D, UnicodeCategory_t::MN}, {0x00D4E, 0x00D4E, UnicodeCategory_t::LO}, {0x00D4F, 0x00D4F, UnicodeCategory_t::SO},
+        {0x00D54, 0x00D56, UnicodeCategory_t::LO}, {0x00D57, 0x00D57, UnicodeCategory_t::MC}, {0x00D58, 0x00D5E, UnicodeCategory_t::NO},
+        {0x00D5F, 0x00D61, UnicodeCategory_t::LO}, {0x00D62, 0x00D63, UnicodeCategory_t::MN}, {0x00D66, 0x00D6F, UnicodeCategory_t::ND},
+        {0x00D70, 0x00D78, UnicodeCategory_t::NO}, {0x00D79, 0x00D79, UnicodeCategory_t::SO}, {0x00D7A, 0x00D7F, UnicodeCategory_t::LO},
+        {0x00D81, 0x00D81, UnicodeCategory_t::MN}, {0x00D82, 0x00D83, UnicodeCategory_t::MC}, {0x00D85, 0x00D96, UnicodeCategory_t::LO},
+        {0x00D9A, 0x00DB1, UnicodeCategory_t::LO}, {0x00DB3, 0x00DBB, UnicodeCategory_t::LO}, {0x00DBD, 0x00DBD, UnicodeCategory_t::LO},
+        {0x00DC0, 0x00DC6, UnicodeCategory_t::LO}, {0x00DCA, 0x00DCA, UnicodeCategory_t::MN}, {0x00DCF, 0x00DD1, UnicodeCategory_t::MC},
+        {0x00DD2, 0x00DD4, UnicodeCategory_t::MN}, {0x00DD6, 0x00DD6, UnicodeCategory_t::MN}, {0x00DD8, 0x00DDF, UnicodeCategory_t::MC},
+        {0x00DE6, 0x00DEF, UnicodeCategory_t::ND}, {0x00DF2, 0x00DF3, UnicodeCategory_t::MC}, {0x00DF4, 0x00DF4, UnicodeCategory_t::PO},
+        {0x00E01, 0x00E30, UnicodeCategory_t::LO}, {0x00E31, 0x00E31, UnicodeCategory_t::MN}, {0x00E32, 0x00E33, UnicodeCategory_t::LO},
+        {0x00E34, 0x00E3A, UnicodeCategory_t::MN}, {0x00E3F, 0x00E3F, UnicodeCategory_t::SC}, {0x00E40, 0x00E45, UnicodeCategory_t::LO},
+        {0x00E46, 0x00E46, UnicodeCategory_t::LM}, {0x00E47, 0x00E4E, UnicodeCategory_t::MN}, {0x00E4F, 0x00E4F, UnicodeCategory_t::PO},
+        {0x00E50, 0x00E59, UnicodeCategory_t::ND}, {0x00E5A, 0x00E5B, UnicodeCategory_t::PO}, {0x00E81, 0x00E82, UnicodeCategory_t::LO},
+        {0x00E84, 0x00E84, UnicodeCategory_t::LO}, {0x00E86, 0x00E8A, UnicodeCategory_t::LO}, {0x00E8C, 0x00EA3, UnicodeCategory_t::LO},
+        {0x00EA5, 0x00EA5, UnicodeCategory_t::LO}, {0x00EA7, 0x00EB0, UnicodeCategory_t::LO}, {0x00EB1, 0x00EB1, UnicodeCategory_t::MN},
+        {0x00EB2, 0x00EB3, UnicodeCategory_t::LO}, {0x00EB4, 0x00EBC, UnicodeCategory_t::MN}, {0x00EBD, 0x00EBD, UnicodeCategory_t::LO},
+        {0x00EC0, 0x00EC4, UnicodeCategory_t::LO}, {0x00EC6, 0x00EC6, UnicodeCategory_t::LM}, {0x00EC8, 0x00ECD, UnicodeCategory_t::MN},
+        {0x00ED0, 0x00ED9, UnicodeCategory_t::ND}, {0x00EDC, 0x00EDF, UnicodeCategory_t::LO}, {0x00F00, 0x00F00, UnicodeCategory_t::LO},
+        {0x00F01, 0x00F03, UnicodeCategory_t::SO}, {0x00F04, 0x00F12, UnicodeCategory_t::PO}, {0x00F13, 0x00F13, UnicodeCategory_t::SO},
+        {0x00F14, 0x00F14, UnicodeCategory_t::PO}, {0x00F15, 0x00F17, UnicodeCategory_t::SO}, {0x00F18, 0x00F19, UnicodeCategory_t::MN},
+        {0x00F1A, 0x00F1F, UnicodeCategory_t::SO}, {0x00F20, 0x00F29, UnicodeCategory_t::ND}, {0x00F2A, 0x00F33, UnicodeCategory_t::NO},
+        {0x00F34, 0x00F34, UnicodeCategory_t::SO}, {0x00F35, 0x00F35, UnicodeCategory_t::MN}, {0x00F36, 0x00F36, UnicodeCategory_t::SO},
+        {0x00F37, 0x00F37, UnicodeCategory_t::MN}, {0x00F38, 0x00F38, UnicodeCategory_t::SO}, {0x00F39, 0x00F39, UnicodeCategory_t::MN},
+        {0x00F3A, 0x00F3A, UnicodeCategory_t::PS}, {0x00F3B, 0x00F3B, UnicodeCategory_t::PE}, {0x00F3C, 0x00F3C, UnicodeCategory_t::PS},
+        {0x00F3D, 0x00F3D, UnicodeCategory_t::PE}, {0x00F3E, 0x00F3F, UnicodeCategory_t::MC}, {0x00F40, 0x00F47, UnicodeCategory_t::LO},
+        {0x00F49, 0x00F6C, UnicodeCategory_t::LO}, {0x00F71, 0x00F7E, UnicodeCategory_t::MN}, {0x00F7F, 0x00F7F, UnicodeCategory_t::MC},
+        {0x00F80, 0x00F84, UnicodeCategory_t::MN}, {0x00F85, 0x00F85, UnicodeCategory_t::PO}, {0x00F86, 0x00F87, UnicodeCategory_t::MN},
+        {0x00F88, 0x00F8C, UnicodeCategory_t::LO}, {0x00F8D, 0x00F97, UnicodeCategory_t::MN}, {0x00F99, 0x00FBC, UnicodeCategory_t::MN},
+        {0x00FBE, 0x00FC5, UnicodeCategory_t::SO}, {0x00FC6, 0x00FC6, UnicodeCategory_t::MN}, {0x00FC7, 0x00FCC, UnicodeCategory_t::SO},
+        {0x00FCE, 0x00FCF, UnicodeCategory_t::SO}, {0x00FD0, 0x00FD4, UnicodeCategory_t::PO}, {0x00FD5, 0x00FD8, UnicodeCategory_t::SO},
+        {0x00FD9, 0x00FDA, UnicodeCategory_t::PO}, {0x01000, 0x0102A, UnicodeCategory_t::LO}, {0x0102B, 0x0102C, UnicodeCategory_t::MC},
+        {0x0102D, 0x01030, UnicodeCategory_t::MN}, {0x01031, 0x01031, UnicodeCategory_t::MC}, {0x01032, 0x01037, UnicodeCategory_t::MN},
+        {0x01038, 0x01038, UnicodeCategory_t::MC}, {0x01039, 0x0103A, UnicodeCategory_t::MN}, {0x0103B, 0x0103C, UnicodeCategory_t::MC},
+        {0x0103D, 0x0103E, UnicodeCategory_t::MN}, {0x0103F, 0x0103F, UnicodeCategory_t::LO}, {0x01040, 0x01049, UnicodeCategory_t::ND},
+        {0x0104A, 0x0104F, UnicodeCategory_t::PO}, {0x01050, 0x01055, UnicodeCategory_t::LO}, {0x01056, 0x01057, UnicodeCategory_t::MC},
+        {0x01058, 0x01059, UnicodeCategory_t::MN}, {0x0105A, 0x0105D, UnicodeCategory_t::LO}, {0x0105E, 0x01060, UnicodeCategory_t::MN},
+        {0x01061, 0x01061, UnicodeCategory_t::LO}, {0x01062, 0x01064, UnicodeCategory_t::MC}, {0x01065, 0x01066, UnicodeCategory_t::LO},
+        {0x01067, 0x0106D, UnicodeCategory_t::MC}, {0x0106E, 0x01070, UnicodeCategory_t::LO}, {0x01071, 0x01074, UnicodeCategory_t::MN},
+        {0x01075, 0x01081, UnicodeCategory_t::LO}, {0x01082, 0x01082, UnicodeCategory_t::MN}, {0x01083, 0x01084, UnicodeCategory_t::MC},
+        {0x01085, 0x01086, UnicodeCategory_t::MN}, {0x01087, 0x0108C, UnicodeCategory_t::MC}, {0x0108D, 0x0108D, UnicodeCategory_t::MN},
+        {0x0108E, 0x0108E, UnicodeCategory_t::LO}, {0x0108F, 0x0108F, UnicodeCategory_t::MC}, {0x01090, 0x01099, UnicodeCategory_t::ND},
+        {0x0109A, 0x0109C, UnicodeCategory_t::MC}, {0x0109D, 0x0109D, UnicodeCategory_t::MN}, {0x0109E, 0x0109F, UnicodeCategory_t::SO},
+        {0x010A0, 0x010C5, UnicodeCategory_t::LU}, {0x010C7, 0x010C7, UnicodeCategory_t::LU}, {0x010CD, 0x010CD, UnicodeCategory_t::LU},
+        {0x010D0, 0x010FA, UnicodeCategory_t::LL}, {0x010FB, 0x010FB, UnicodeCategory_t::PO}, {0x010FC, 0x010FC, UnicodeCategory_t::LM},
+        {0x010FD, 0x010FF, UnicodeCategory_t::LL}, {0x01100, 0x01248, UnicodeCategory_t::LO}, {0x0124A, 0x0124D, UnicodeCategory_t::LO},
+        {0x01250, 0x01256, UnicodeCategory_t::LO}, {0x01258, 0x01258, UnicodeCategory_t::LO}, {0x0125A, 0x0125D, UnicodeCategory_t::LO},
+        {0x01260, 0x01288, UnicodeCategory_t::LO}, {0x0128A, 0x0128D, UnicodeCategory_t::LO}, {0x01290, 0x012B0, UnicodeCategory_t::LO},
+        {0x012B2, 0x012B5, UnicodeCategory_t::LO}, {0x012B8, 0x012BE, UnicodeCategory_t::LO}, {0x012C0, 0x012C0, UnicodeCategory_t::LO},
+        {0x012C2, 0x012C5, UnicodeCategory_t::LO}, {0x012C8, 0x012D6, UnicodeCategory_t::LO}, {0x012D8, 0x01310, UnicodeCategory_t::LO},
+        {0x01312, 0x01315, UnicodeCategory_t::LO}, {0x01318, 0x0135A, UnicodeCategory_t::LO}, {0x0135D, 0x0135F, UnicodeCategory_t::MN},
+        {0x01360, 0x01368, UnicodeCategory_t::PO}, {0x01369, 0x0137C, UnicodeCategory_t::NO}, {0x01380, 0x0138F, UnicodeCategory_t::LO},
+        {0x01390, 0x01399, UnicodeCategory_t::SO}, {0x013A0, 0x013F5, UnicodeCategory_t::LU}, {0x013F8, 0x013FD, UnicodeCategory_t::LL},
+        {0x01400, 0x01400, UnicodeCategory_t::PD}, {0x01401, 0x0166C, UnicodeCategory_t::LO}, {0x0166D, 0x0166D, UnicodeCategory_t::SO},
+        {0x0166E, 0x0166E, UnicodeCategory_t::PO}, {0x0166F, 0x0167F, UnicodeCategory_t::LO}, {0x01680, 0x01680, UnicodeCategory_t::ZS},
+        {0x01681, 0x0169A, UnicodeCategory_t::LO}, {0x0169B, 0x0169B, UnicodeCategory_t::PS}, {0x0169C, 0x0169C, UnicodeCategory_t::PE},
+        {0x016A0, 0x016EA, UnicodeCategory_t::LO}, {0x016EB, 0x016ED, UnicodeCategory_t::PO}, {0x016EE, 0x016F0, UnicodeCategory_t::NL},
+        {0x016F1, 0x016F8, UnicodeCategory_t::LO}, {0x01700, 0x01711, UnicodeCategory_t::LO}, {0x01712, 0x01714, UnicodeCategory_t::MN},
+        {0x01715, 0x01715, UnicodeCategory_t::MC}, {0x0171F, 0x01731, UnicodeCategory_t::LO}, {0x01732, 0x01733, UnicodeCategory_t::MN},
+        {0x01734, 0x01734, UnicodeCategory_t::MC}, {0x01735, 0x01736, UnicodeCategory_t::PO}, {0x01740, 0x01751, UnicodeCategory_t::LO},
+        {0x01752, 0x01753, UnicodeCategory_t::MN}, {0x01760, 0x0176C, UnicodeCategory_t::LO}, {0x0176E, 0x01770, UnicodeCategory_t::LO},
+        {0x01772, 0x01773, UnicodeCategory_t::MN}, {0x01780, 0x017B3, UnicodeCategory_t::LO}, {0x017B4, 0x017B5, UnicodeCategory_t::MN},
+        {0x017B6, 0x017B6, UnicodeCategory_t::MC}, {0x017B7, 0x017BD, UnicodeCategory_t::MN}, {0x017BE, 0x017C5, UnicodeCategory_t::MC},
+        {0x017C6, 0x017C6, UnicodeCategory_t::MN}, {0x017C7, 0x017C8, UnicodeCategory_t::MC}, {0x017C9, 0x017D3, UnicodeCategory_t::MN},
+        {0x017D4, 0x017D6, UnicodeCategory_t::PO}, {0x017D7, 0x017D7, UnicodeCategory_t::LM}, {0x017D8, 0x017DA, UnicodeCategory_t::PO},
+        {0x017DB, 0x017DB, UnicodeCategory_t::SC}, {0x017DC, 0x017DC, UnicodeCategory_t::LO}, {0x017DD, 0x017DD, UnicodeCategory_t::MN},
+        {0x017E0, 0x017E9, UnicodeCategory_t::ND}, {0x017F0, 0x017F9, UnicodeCategory_t::NO}, {0x01800, 0x01805, UnicodeCategory_t::PO},
+        {0x01806, 0x01806, UnicodeCategory_t::PD}, {0x01807, 0x0180A, UnicodeCategory_t::PO}, {0x0180B, 0x0180D, UnicodeCategory_t::MN},
+        {0x0180E, 0x0180E, UnicodeCategory_t::CF}, {0x0180F, 0x0180F, UnicodeCategory_t::MN}, {0x01810, 0x01819, UnicodeCategory_t::ND},
+        {0x01820, 0x01842, UnicodeCategory_t::LO}, {0x01843, 0x01843, UnicodeCategory_t::LM}, {0x01844, 0x01878, UnicodeCategory_t::LO},
+        {0x01880, 0x01884, UnicodeCategory_t::LO}, {0x01885, 0x01886, UnicodeCategory_t::MN}, {0x01887, 0x018A8, UnicodeCategory_t::LO},
+        {0x018A9, 0x018A9, UnicodeCategory_t::MN}, {0x018AA, 0x018AA, UnicodeCategory_t::LO}, {0x018B0, 0x018F5, UnicodeCategory_t::LO},
+        {0x01900, 0x0191E, UnicodeCategory_t::LO}, {0x01920, 0x01922, UnicodeCategory_t::MN}, {0x01923, 0x01926, UnicodeCategory_t::MC},
+        {0x01927, 0x01928, UnicodeCategory_t::MN}, {0x01929, 0x0192B, UnicodeCategory_t::MC}, {0x01930, 0x01931, UnicodeCategory_t::MC},
+        {0x01932, 0x01932, UnicodeCategory_t::MN}, {0x01933, 0x01938, UnicodeCategory_t::MC}, {0x01939, 0x0193B, UnicodeCategory_t::MN},
+        {0x01940, 0x01940, UnicodeCategory_t::SO}, {0x01944, 0x01945, UnicodeCategory_t::PO}, {0x01946, 0x0194F, UnicodeCategory_t::ND},
+        {0x01950, 0x0196D, UnicodeCategory_t::LO}, {0x01970, 0x01974, UnicodeCategory_t::LO}, {0x01980, 0x019AB, UnicodeCategory_t::LO},
+        {0x019B0, 0x019C9, UnicodeCategory_t::LO}, {0x019D0, 0x019D9, UnicodeCategory_t::ND}, {0x019DA, 0x019DA, UnicodeCategory_t::NO},
+        {0x019DE, 0x019FF, UnicodeCategory_t::SO}, {0x01A00, 0x01A16, UnicodeCategory_t::LO}, {0x01A17, 0x01A18, UnicodeCategory_t::MN},
+        {0x01A19, 0x01A1A, UnicodeCategory_t::MC}, {0x01A1B, 0x01A1B, UnicodeCategory_t::MN}, {0x01A1E, 0x01A1F, UnicodeCategory_t::PO},
+        {0x01A20, 0x01A54, UnicodeCategory_t::LO}, {0x01A55, 0x01A55, UnicodeCategory_t::MC}, {0x01A56, 0x01A56, UnicodeCategory_t::MN},
+        {0x01A57, 0x01A57, UnicodeCategory_t::MC}, {0x01A58, 0x01A5E, UnicodeCategory_t::MN}, {0x01A60, 0x01A60, UnicodeCategory_t::MN},
+        {0x01A61, 0x01A61, UnicodeCategory_t::MC}, {0x01A62, 0x01A62, UnicodeCategory_t::MN}, {0x01A63, 0x01A64, UnicodeCategory_t::MC},
+        {0x01A65, 0x01A6C, UnicodeCategory_t::MN}, {0x01A6D, 0x01A72, UnicodeCategory_t::MC}, {0x01A73, 0x01A7C, UnicodeCategory_t::MN},
+        {0x01A7F, 0x01A7F, UnicodeCategory_t::MN}, {0x01A80, 0x01A89, UnicodeCategory_t::ND}, {0x01A90, 0x01A99, UnicodeCategory_t::ND},
+        {0x01AA0, 0x01AA6, UnicodeCategory_t::PO}, {0x01AA7, 0x01AA7, UnicodeCategory_t::LM}, {0x01AA8, 0x01AAD, UnicodeCategory_t::PO},
+        {0x01AB0, 0x01ABD, UnicodeCategory_t::MN}, {0x01ABE, 0x01ABE, UnicodeCategory_t::ME}, {0x01ABF, 0x01ACE, UnicodeCategory_t::MN},
+        {0x01B00, 0x01B03, UnicodeCategory_t::MN}, {0x01B04, 0x01B04, UnicodeCategory_t::MC}, {0x01B05, 0x01B33, UnicodeCategory_t::LO},
+        {0x01B34, 0x01B34, UnicodeCategory_t::MN}, {0x01B35, 0x01B35, UnicodeCategory_t::MC}, {0x01B36, 0x01B3A, UnicodeCategory_t::MN},
+        {0x01B3B, 0x01B3B, UnicodeCategory_t::MC}, {0x01B3C, 0x01B3C, UnicodeCategory_t::MN}, {0x01B3D, 0x01B41, UnicodeCategory_t::MC},
+        {0x01B42, 0x01B42, UnicodeCategory_t::MN}, {0x01B43, 0x01B44, UnicodeCategory_t::MC}, {0x01B45, 0x01B4C, UnicodeCategory_t::LO},
+        {0x01B50, 0x01B59, UnicodeCategory_t::ND}, {0x01B5A, 0x01B60, UnicodeCategory_t::PO}, {0x01B61, 0x01B6A, UnicodeCategory_t::SO},
+        {0x01B6B, 0x01B73, UnicodeCategory_t::MN}, {0x01B74, 0x01B7C, UnicodeCategory_t::SO}, {0x01B7D, 0x01B7E, UnicodeCategory_t::PO},
+        {0x01B80, 0x01B81, UnicodeCategory_t::MN}, {0x01B82, 0x01B82, UnicodeCategory_t::MC}, {0x01B83, 0x01BA0, UnicodeCategory_t::LO},
+        {0x01BA1, 0x01BA1, UnicodeCategory_t::MC}, {0x01BA2, 0x01BA5, UnicodeCategory_t::MN}, {0x01BA6, 0x01BA7, UnicodeCategory_t::MC},
+        {0x01BA8, 0x01BA9, UnicodeCategory_t::MN}, {0x01BAA, 0x01BAA, UnicodeCategory_t::MC}, {0x01BAB, 0x01BAD, UnicodeCategory_t::MN},
+        {0x01BAE, 0x01BAF, UnicodeCategory_t::LO}, {0x01BB0, 0x01BB9, UnicodeCategory_t::ND}, {0x01BBA, 0x01BE5, UnicodeCategory_t::LO},
+        {0x01BE6, 0x01BE6, UnicodeCategory_t::MN}, {0x01BE7, 0x01BE7, UnicodeCategory_t::MC}, {0x01BE8, 0x01BE9, UnicodeCategory_t::MN},
+        {0x01BEA, 0x01BEC, UnicodeCategory_t::MC}, {0x01BED, 0x01BED, UnicodeCategory_t::MN}, {0x01BEE, 0x01BEE, UnicodeCategory_t::MC},
+        {0x01BEF, 0x01BF1, UnicodeCategory_t::MN}, {0x01BF2, 0x01BF3, UnicodeCategory_t::MC}, {0x01BFC, 0x01BFF, UnicodeCategory_t::PO},
+        {0x01C00, 0x01C23, UnicodeCategory_t::LO}, {0x01C24, 0x01C2B, UnicodeCategory_t::MC}, {0x01C2C, 0x01C33, UnicodeCategory_t::MN},
+        {0x01C34, 0x01C35, UnicodeCategory_t::MC}, {0x01C36, 0x01C37, UnicodeCategory_t::MN}, {0x01C3B, 0x01C3F, UnicodeCategory_t::PO},
+        {0x01C40, 0x01C49, UnicodeCategory_t::ND}, {0x01C4D, 0x01C4F, UnicodeCategory_t::LO}, {0x01C50, 0x01C59, UnicodeCategory_t::ND},
+        {0x01C5A, 0x01C77, UnicodeCategory_t::LO}, {0x01C78, 0x01C7D, UnicodeCategory_t::LM}, {0x01C7E, 0x01C7F, UnicodeCategory_t::PO},
+        {0x01C80, 0x01C88, UnicodeCategory_t::LL}, {0x01C90, 0x01CBA, UnicodeCategory_t::LU}, {0x01CBD, 0x01CBF, UnicodeCategory_t::LU},
+        {0x01CC0, 0x01CC7, UnicodeCategory_t::PO}, {0x01CD0, 0x01CD2, UnicodeCategory_t::MN}, {0x01CD3, 0x01CD3, UnicodeCategory_t::PO},
+        {0x01CD4, 0x01CE0, UnicodeCategory_t::MN}, {0x01CE1, 0x01CE1, UnicodeCategory_t::MC}, {0x01CE2, 0x01CE8, UnicodeCategory_t::MN},
+        {0x01CE9, 0x01CEC, UnicodeCategory_t::LO}, {0x01CED, 0x01CED, UnicodeCategory_t::MN}, {0x01CEE, 0x01CF3, UnicodeCategory_t::LO},
+        {0x01CF4, 0x01CF4, UnicodeCategory_t::MN}, {0x01CF5, 0x01CF6, UnicodeCategory_t::LO}, {0x01CF7, 0x01CF7, UnicodeCategory_t::MC},
+        {0x01CF8, 0x01CF9, UnicodeCategory_t::MN}, {0x01CFA, 0x01CFA, UnicodeCategory_t::LO}, {0x01D00, 0x01D2B, UnicodeCategory_t::LL},
+        {0x01D2C, 0x01D6A, UnicodeCategory_t::LM}, {0x01D6B, 0x01D77, UnicodeCategory_t::LL}, {0x01D78, 0x01D78, UnicodeCategory_t::LM},
+        {0x01D79, 0x01D9A, UnicodeCategory_t::LL}, {0x01D9B, 0x01DBF, UnicodeCategory_t::LM}, {0x01DC0, 0x01DFF, UnicodeCategory_t::MN},
+        {0x01E00, 0x01E00, UnicodeCategory_t::LU}, {0x01E01, 0x01E01, UnicodeCategory_t::LL}, {0x01E02, 0x01E02, UnicodeCategory_t::LU},
+        {0x01E03, 0x01E03, UnicodeCategory_t::LL}, {0x01E04, 0x01E04, UnicodeCategory_t::LU}, {0x01E05, 0x01E05, UnicodeCategory_t::LL},
+        {0x01E06, 0x01E06, UnicodeCategory_t::LU}, {0x01E07, 0x01E07, UnicodeCategory_t::LL}, {0x01E08, 0x01E08, UnicodeCategory_t::LU},
+        {0x01E09, 0x01E09, UnicodeCategory_t::LL}, {0x01E0A, 0x01E0A, UnicodeCategory_t::LU}, {0x01E0B, 0x01E0B, UnicodeCategory_t::LL},
+        {0x01E0C, 0x01E0C, UnicodeCategory_t::LU}, {0x01E0D, 0x01E0D, UnicodeCategory_t::LL}, {0x01E0E, 0x01E0E, UnicodeCategory_t::LU},
+        {0x01E0F, 0x01E0F, UnicodeCategory_t::LL}, {0x01E10, 0x01E10, UnicodeCategory_t::LU}, {0x01E11, 0x01E11, UnicodeCategory_t::LL},
+        {0x01E12, 0x01E12, UnicodeCategory_t::LU}, {0x01E13, 0x01E13, UnicodeCategory_t::LL}, {0x01E14, 0x01E14, UnicodeCategory_t::LU},
+        {0x01E15, 0x01E15, UnicodeCategory_t::LL}, {0x01E16, 0x01E16, UnicodeCategory_t::LU}, {0x01E17, 0x01E17, UnicodeCategory_t::LL},
+        {0x01E18, 0x01E18, UnicodeCategory_t::LU}, {0x01E19, 0x01E19, UnicodeCategory_t::LL}, {0x01E1A, 0x01E1A, UnicodeCategory_t::LU},
+        {0x01E1B, 0x01E1B, UnicodeCategory_t::LL}, {0x01E1C, 0x01E1C, UnicodeCategory_t::LU}, {0x01E1D, 0x01E1D, UnicodeCategory_t::LL},
+        {0x01E1E, 0x01E1E, UnicodeCategory_t::LU}, {0x01E1F, 0x01E1F, UnicodeCategory_t::LL}, {0x01E20, 0x01E20, UnicodeCategory_t::LU},
+        {0x01E21, 0x01E21, UnicodeCategory_t::LL}, {0x01E22, 0x01E22, UnicodeCategory_t::LU}, {0x01E23, 0x01E23, UnicodeCategory_t::LL},
+        {0x01E24, 0x01E24, UnicodeCategory_t::LU}, {0x01E25, 0x01E25, UnicodeCategory_t::LL}, {0x01E26, 0x01E26, UnicodeCategory_t::LU},
+        {0x01E27, 0x01E27, UnicodeCategory_t::LL}, {0x01E28, 0x01E28, UnicodeCategory_t::LU}, {0x01E29, 0x01E29, UnicodeCategory_t::LL},
+        {0x01E2A, 0x01E2A, UnicodeCategory_t::LU}, {0x01E2B, 0x01E2B, UnicodeCategory_t::LL}, {0x01E2C, 0x01E2C, UnicodeCategory_t::LU},
+        {0x01E2D, 0x01E2D, UnicodeCategory_t::LL}, {0x01E2E, 0x01E2E, UnicodeCategory_t::LU}, {0x01E2F, 0x01E2F, UnicodeCategory_t::LL},
+        {0x01E30, 0x01E30, UnicodeCategory_t::LU}, {0x01E31, 0x01E31, UnicodeCategory_t::LL}, {0x01E32, 0x01E32, UnicodeCategory_t::LU},
+        {0x01E33, 0x01E33, UnicodeCategory_t::LL}, {0x01E34, 0x01E34, UnicodeCategory_t::LU}, {0x01E35, 0x01E35, UnicodeCategory_t::LL},
+        {0x01E36, 0x01E36, UnicodeCategory_t::LU}, {0x01E37, 0x01E37, UnicodeCategory_t::LL}, {0x01E38, 0x01E38, UnicodeCategory_t::LU},
+        {0x01E39, 0x01E39, UnicodeCategory_t::LL}, {0x01E3A, 0x01E3A, UnicodeCategory_t::LU}, {0x01E3B, 0x01E3B, UnicodeCategory_t::LL},
+        {0x01E3C, 0x01E3C, UnicodeCategory_t::LU}, {0x01E3D, 0x01E3D, UnicodeCategory_t::LL}, {0x01E3E, 0x01E3E, UnicodeCategory_t::LU},
+        {0x01E3F, 0x01E3F, UnicodeCategory_t::LL}, {0x01E40, 0x01E40, UnicodeCategory_t::LU}, {0x01E41, 0x01E41, UnicodeCategory_t::LL},
+        {0x01E42, 0x01E42, UnicodeCategory_t::LU}, {0x01E43, 0x01E43, UnicodeCategory_t::LL}, {0x01E44, 0x01E44, UnicodeCategory_t::LU},
+        {0x01E45, 0x01E45, UnicodeCategory_t::LL}, {0x01E46, 0x01E46, UnicodeCategory_t::LU}, {0x01E47, 0x01E47, UnicodeCategory_t::LL},
+        {0x01E48, 0x01E48, UnicodeCategory_t::LU}, {0x01E49, 0x01E49, UnicodeCategory_t::LL}, {0x01E4A, 0x01E4A, UnicodeCategory_t::LU},
+        {0x01E4B, 0x01E4B, UnicodeCategory_t::LL}, {0x01E4C, 0x01E4C, UnicodeCategory_t::LU}, {0x01E4D, 0x01E4D, UnicodeCategory_t::LL},
+        {0x01E4E, 0x01E4E, UnicodeCategory_t::LU}, {0x01E4F, 0x01E4F, UnicodeCategory_t::LL}, {0x01E50, 0x01E50, UnicodeCategory_t::LU},
+        {0x01E51, 0x01E51, UnicodeCategory_t::LL}, {0x01E52, 0x01E52, UnicodeCategory_t::LU}, {0x01E53, 0x01E53, UnicodeCategory_t::LL},
+        {0x01E54, 0x01E54, UnicodeCategory_t::LU}, {0x01E55, 0x01E55, UnicodeCategory_t::LL}, {0x01E56, 0x01E56, UnicodeCategory_t::LU},
+        {0x01E57, 0x01E57, UnicodeCategory_t::LL}, {0x01E58, 0x01E58, UnicodeCategory_t::LU}, {0x01E59, 0x01E59, UnicodeCategory_t::LL},
+        {0x01E5A, 0x01E5A, UnicodeCategory_t::LU}, {0x01E5B, 0x01E5B, UnicodeCategory_t::LL}, {0x01E5C, 0x01E5C, UnicodeCategory_t::LU},
+        {0x01E5D, 0x01E5D, UnicodeCategory_t::LL}, {0x01E5E, 0x01E5E, UnicodeCategory_t::LU}, {0x01E5F, 0x01E5F, UnicodeCategory_t::LL},
+        {0x01E60, 0x01E60, UnicodeCategory_t::LU}, {0x01E61, 0x01E61, UnicodeCategory_t::LL}, {0x01E62, 0x01E62, UnicodeCategory_t::LU},
+        {0x01E63, 0x01E63, UnicodeCategory_t::LL}, {0x01E64, 0x01E64, UnicodeCategory_t::LU}, {0x01E65, 0x01E65, UnicodeCategory_t::LL},
+        {0x01E66, 0x01E66, UnicodeCategory_t::LU}, {0x01E67, 0x01E67, UnicodeCategory_t::LL}, {0x01E68, 0x01E68, UnicodeCategory_t::LU},
+        {0x01E69, 0x01E69, UnicodeCategory_t::LL}, {0x01E6A, 0x01E6A, UnicodeCategory_t::LU}, {0x01E6B, 0x01E6B, UnicodeCategory_t::LL},
+        {0x01E6C, 0x01E6C, UnicodeCategory_t::LU}, {0x01E6D, 0x01E6D, UnicodeCategory_t::LL}, {0x01E6E, 0x01E6E, UnicodeCategory_t::LU},
+        {0x01E6F, 0x01E6F, UnicodeCategory_t::LL}, {0x01E70, 0x01E70, UnicodeCategory_t::LU}, {0x01E71, 0x01E71, UnicodeCategory_t::LL},
+        {0x01E72, 0x01E72, UnicodeCategory_t::LU}, {0x01E73, 0x01E73, UnicodeCategory_t::LL}, {0x01E74, 0x01E74, UnicodeCategory_t::LU},
+        {0x01E75, 0x01E75, UnicodeCategory_t::LL}, {0x01E76, 0x01E76, UnicodeCategory_t::LU}, {0x01E77, 0x01E77, UnicodeCategory_t::LL},
+        {0x01E78, 0x01E78, UnicodeCategory_t::LU}, {0x01E79, 0x01E79, UnicodeCategory_t::LL}, {0x01E7A, 0x01E7A, UnicodeCategory_t::LU},
+        {0x01E7B, 0x01E7B, UnicodeCategory_t::LL}, {0x01E7C, 0x01E7C, UnicodeCategory_t::LU}, {0x01E7D, 0x01E7D, UnicodeCategory_t::LL},
+        {0x01E7E, 0x01E7E, UnicodeCategory_t::LU}, {0x01E7F, 0x01E7F, UnicodeCategory_t::LL}, {0x01E80, 0x01E80, UnicodeCategory_t::LU},
+        {0x01E81, 0x01E81, UnicodeCategory_t::LL}, {0x01E82, 0x01E82, UnicodeCategory_t::LU}, {0x01E83, 0x01E83, UnicodeCategory_t::LL},
+        {0x01E84, 0x01E84, UnicodeCategory_t::LU}, {0x01E85, 0x01E85, UnicodeCategory_t::LL}, {0x01E86, 0x01E86, UnicodeCategory_t::LU},
+        {0x01E87, 0x01E87, UnicodeCategory_t::LL}, {0x01E88, 0x01E88, UnicodeCategory_t::LU}, {0x01E89, 0x01E89, UnicodeCategory_t::LL},
+        {0x01E8A, 0x01E8A, UnicodeCategory_t::LU}, {0x01E8B, 0x01E8B, UnicodeCategory_t::LL}, {0x01E8C, 0x01E8C, UnicodeCategory_t::LU},
+        {0x01E8D, 0x01E8D, UnicodeCategory_t::LL}, {0x01E8E, 0x01E8E, UnicodeCategory_t::LU}, {0x01E8F, 0x01E8F, UnicodeCategory_t::LL},
+        {0x01E90, 0x01E90, UnicodeCategory_t::LU}, {0x01E91, 0x01E91, UnicodeCategory_t::LL}, {0x01E92, 0x01E92, UnicodeCategory_t::LU},
+        {0x01E93, 0x01E93, UnicodeCategory_t::LL}, {0x01E94, 0x01E94, UnicodeCategory_t::LU}, {0x01E95, 0x01E9D, UnicodeCategory_t::LL},
+        {0x01E9E, 0x01E9E, UnicodeCategory_t::LU}, {0x01E9F, 0x01E9F, UnicodeCategory_t::LL}, {0x01EA0, 0x01EA0, UnicodeCategory_t::LU},
+        {0x01EA1, 0x01EA1, UnicodeCategory_t::LL}, {0x01EA2, 0x01EA2, UnicodeCategory_t::LU}, {0x01EA3, 0x01EA3, UnicodeCategory_t::LL},
+        {0x01EA4, 0x01EA4, UnicodeCategory_t::LU}, {0x01EA5, 0x01EA5, UnicodeCategory_t::LL}, {0x01EA6, 0x01EA6, UnicodeCategory_t::LU},
+        {0x01EA7, 0x01EA7, UnicodeCategory_t::LL}, {0x01EA8, 0x01EA8, UnicodeCategory_t::LU}, {0x01EA9, 0x01EA9, UnicodeCategory_t::LL},
+        {0x01EAA, 0x01EAA, UnicodeCategory_t::LU}, {0x01EAB, 0x01EAB, UnicodeCategory_t::LL}, {0x01EAC, 0x01EAC, UnicodeCategory_t::LU},
+        {0x01EAD, 0x01EAD, UnicodeCategory_t::LL}, {0x01EAE, 0x01EAE, UnicodeCategory_t::LU}, {0x01EAF, 0x01EAF, UnicodeCategory_t::LL},
+        {0x01EB0, 0x01EB0, UnicodeCategory_t::LU}, {0x01EB1, 0x01EB1, UnicodeCategory_t::LL}, {0x01EB2, 0x01EB2, UnicodeCategory_t::LU},
+        {0x01EB3, 0x01EB3, UnicodeCategory_t::LL}, {0x01EB4, 0x01EB4, UnicodeCategory_t::LU}, {0x01EB5, 0x01EB5, UnicodeCategory_t::LL},
+        {0x01EB6, 0x01EB6, UnicodeCategory_t::LU}, {0x01EB7, 0x01EB7, UnicodeCategory_t::LL}, {0x01EB8, 0x01EB8, UnicodeCategory_t::LU},
+        {0x01EB9, 0x01EB9, UnicodeCategory_t::LL}, {0x01EBA, 0x01EBA, UnicodeCategory_t::LU}, {0x01EBB, 0x01EBB, UnicodeCategory_t::LL},
+        {0x01EBC, 0x01EBC, UnicodeCategory_t::LU}, {0x01EBD, 0x01EBD, UnicodeCategory_t::LL}, {0x01EBE, 0x01EBE, UnicodeCategory_t::LU},
+        {0x01EBF, 0x01EBF, UnicodeCategory_t::LL}, {0x01EC0, 0x01EC0, UnicodeCategory_t::LU}, {0x01EC1, 0x01EC1, UnicodeCategory_t::LL},
+        {0x01EC2, 0x01EC2, UnicodeCategory_t::LU}, {0x01EC3, 0x01EC3, UnicodeCategory_t::LL}, {0x01EC4, 0x01EC4, UnicodeCategory_t::LU},
+        {0x01EC5, 0x01EC5, UnicodeCategory_t::LL}, {0x01EC6, 0x01EC6, UnicodeCategory_t::LU}, {0x01EC7, 0x01EC7, UnicodeCategory_t::LL},
+        {0x01EC8, 0x01EC8, UnicodeCategory_t::LU}, {0x01EC9, 0x01EC9, UnicodeCategory_t::LL}, {0x01ECA, 0x01ECA, UnicodeCategory_t::LU},
+        {0x01ECB, 0x01ECB, UnicodeCategory_t::LL}, {0x01ECC, 0x01ECC, UnicodeCategory_t::LU}, {0x01ECD, 0x01ECD, UnicodeCategory_t::LL},
+        {0x01ECE, 0x01ECE, UnicodeCategory_t::LU}, {0x01ECF, 0x01ECF, UnicodeCategory_t::LL}, {0x01ED0, 0x01ED0, UnicodeCategory_t::LU},
+        {0x01ED1, 0x01ED1, UnicodeCategory_t::LL}, {0x01ED2, 0x01ED2, UnicodeCategory_t::LU}, {0x01ED3, 0x01ED3, UnicodeCategory_t::LL},
+        {0x01ED4, 0x01ED4, UnicodeCategory_t::LU}, {0x01ED5, 0x01ED5, UnicodeCategory_t::LL}, {0x01ED6, 0x01ED6, UnicodeCategory_t::LU},
+        {0x01ED7, 0x01ED7, UnicodeCategory_t::LL}, {0x01ED8, 0x01ED8, UnicodeCategory_t::LU}, {0x01ED9, 0x01ED9, UnicodeCategory_t::LL},
+        {0x01EDA, 0x01EDA, UnicodeCategory_t::LU}, {0x01EDB, 0x01EDB, UnicodeCategory_t::LL}, {0x01EDC, 0x01EDC, UnicodeCategory_t::LU},
+        {0x01EDD, 0x01EDD, UnicodeCategory_t::LL}, {0x01EDE, 0x01EDE, UnicodeCategory_t::LU}, {0x01EDF, 0x01EDF, UnicodeCategory_t::LL},
+        {0x01EE0, 0x01EE0, UnicodeCategory_t::LU}, {0x01EE1, 0x01EE1, UnicodeCategory_t::LL}, {0x01EE2, 0x01EE2, UnicodeCategory_t::LU},
+        {0x01EE3, 0x01EE3, UnicodeCategory_t::LL}, {0x01EE4, 0x01EE4, UnicodeCategory_t::LU}, {0x01EE5, 0x01EE5, UnicodeCategory_t::LL},
+        {0x01EE6, 0x01EE6, UnicodeCategory_t::LU}, {0x01EE7, 0x01EE7, UnicodeCategory_t::LL}, {0x01EE8, 0x01EE8, UnicodeCategory_t::LU},
+        {0x01EE9, 0x01EE9, UnicodeCategory_t::LL}, {0x01EEA, 0x01EEA, UnicodeCategory_t::LU}, {0x01EEB, 0x01EEB, UnicodeCategory_t::LL},
+        {0x01EEC, 0x01EEC, UnicodeCategory_t::LU}, {0x01EED, 0x01EED, UnicodeCategory_t::LL}, {0x01EEE, 0x01EEE, UnicodeCategory_t::LU},
+        {0x01EEF, 0x01EEF, UnicodeCategory_t::LL}, {0x01EF0, 0x01EF0, UnicodeCategory_t::LU}, {0x01EF1, 0x01EF1, UnicodeCategory_t::LL},
+        {0x01EF2, 0x01EF2, UnicodeCategory_t::LU}, {0x01EF3, 0x01EF3, UnicodeCategory_t::LL}, {0x01EF4, 0x01EF4, UnicodeCategory_t::LU},
+        {0x01EF5, 0x01EF5, UnicodeCategory_t::LL}, {0x01EF6, 0x01EF6, UnicodeCategory_t::LU}, {0x01EF7, 0x01EF7, UnicodeCategory_t::LL},
+        {0x01EF8, 0x01EF8, UnicodeCategory_t::LU}, {0x01EF9, 0x01EF9, UnicodeCategory_t::LL}, {0x01EFA, 0x01EFA, UnicodeCategory_t::LU},
+        {0x01EFB, 0x01EFB, UnicodeCategory_t::LL}, {0x01EFC, 0x01EFC, UnicodeCategory_t::LU}, {0x01EFD, 0x01EFD, UnicodeCategory_t::LL},
+        {0x01EFE, 0x01EFE, UnicodeCategory_t::LU}, {0x01EFF, 0x01F07, UnicodeCategory_t::LL}, {0x01F08, 0x01F0F, UnicodeCategory_t::LU},
+        {0x01F10, 0x01F15, UnicodeCategory_t::LL}, {0x01F18, 0x01F1D, UnicodeCategory_t::LU}, {0x01F20, 0x01F27, UnicodeCategory_t::LL},
+        {0x01F28, 0x01F2F, UnicodeCategory_t::LU}, {0x01F30, 0x01F37, UnicodeCategory_t::LL}, {0x01F38, 0x01F3F, UnicodeCategory_t::LU},
+        {0x01F40, 0x01F45, UnicodeCategory_t::LL}, {0x01F48, 0x01F4D, UnicodeCategory_t::LU}, {0x01F50, 0x01F57, UnicodeCategory_t::LL},
+        {0x01F59, 0x01F59, UnicodeCategory_t::LU}, {0x01F5B, 0x01F5B, UnicodeCategory_t::LU}, {0x01F5D, 0x01F5D, UnicodeCategory_t::LU},
+        {0x01F5F, 0x01F5F, UnicodeCategory_t::LU}, {0x01F60, 0x01F67, UnicodeCategory_t::LL}, {0x01F68, 0x01F6F, UnicodeCategory_t::LU},
+        {0x01F70, 0x01F7D, UnicodeCategory_t::LL}, {0x01F80, 0x01F87, UnicodeCategory_t::LL}, {0x01F88, 0x01F8F, UnicodeCategory_t::LT},
+        {0x01F90, 0x01F97, UnicodeCategory_t::LL}, {0x01F98, 0x01F9F, UnicodeCategory_t::LT}, {0x01FA0, 0x01FA7, UnicodeCategory_t::LL},
+        {0x01FA8, 0x01FAF, UnicodeCategory_t::LT}, {0x01FB0, 0x01FB4, UnicodeCategory_t::LL}, {0x01FB6, 0x01FB7, UnicodeCategory_t::LL},
+        {0x01FB8, 0x01FBB, UnicodeCategory_t::LU}, {0x01FBC, 0x01FBC, UnicodeCategory_t::LT}, {0x01FBD, 0x01FBD, UnicodeCategory_t::SK},
+        {0x01FBE, 0x01FBE, UnicodeCategory_t::LL}, {0x01FBF, 0x01FC1, UnicodeCategory_t::SK}, {0x01FC2, 0x01FC4, UnicodeCategory_t::LL},
+        {0x01FC6, 0x01FC7, UnicodeCategory_t::LL}, {0x01FC8, 0x01FCB, UnicodeCategory_t::LU}, {0x01FCC, 0x01FCC, UnicodeCategory_t::LT},
+        {0x01FCD, 0x01FCF, UnicodeCategory_t::SK}, {0x01FD0, 0x01FD3, UnicodeCategory_t::LL}, {0x01FD6, 0x01FD7, UnicodeCategory_t::LL},
+        {0x01FD8, 0x01FDB, UnicodeCategory_t::LU}, {0x01FDD, 0x01FDF, UnicodeCategory_t::SK}, {0x01FE0, 0x01FE7, UnicodeCategory_t::LL},
+        {0x01FE8, 0x01FEC, UnicodeCategory_t::LU}, {0x01FED, 0x01FEF, UnicodeCategory_t::SK}, {0x01FF2, 0x01FF4, UnicodeCategory_t::LL},
+        {0x01FF6, 0x01FF7, UnicodeCategory_t::LL}, {0x01FF8, 0x01FFB, UnicodeCategory_t::LU}, {0x01FFC, 0x01FFC, UnicodeCategory_t::LT},
+        {0x01FFD, 0x01FFE, UnicodeCategory_t::SK}, {0x02000, 0x0200A, UnicodeCategory_t::ZS}, {0x0200B, 0x0200F, UnicodeCategory_t::CF},
+        {0x02010, 0x02015, UnicodeCategory_t::PD}, {0x02016, 0x02017, UnicodeCategory_t::PO}, {0x02018, 0x02018, UnicodeCategory_t::PI},
+        {0x02019, 0x02019, UnicodeCategory_t::PF}, {0x0201A, 0x0201A, UnicodeCategory_t::PS}, {0x0201B, 0x0201C, UnicodeCategory_t::PI},
+        {0x0201D, 0x0201D, UnicodeCategory_t::PF}, {0x0201E, 0x0201E, UnicodeCategory_t::PS}, {0x0201F, 0x0201F, UnicodeCategory_t::PI},
+        {0x02020, 0x02027, UnicodeCategory_t::PO}, {0x02028, 0x02028, UnicodeCategory_t::ZL}, {0x02029, 0x02029, UnicodeCategory_t::ZP},
+        {0x0202A, 0x0202E, UnicodeCategory_t::CF}, {0x0202F, 0x0202F, UnicodeCategory_t::ZS}, {0x02030, 0x02038, UnicodeCategory_t::PO},
+        {0x02039, 0x02039, UnicodeCategory_t::PI}, {0x0203A, 0x0203A, UnicodeCategory_t::PF}, {0x0203B, 0x0203E, UnicodeCategory_t::PO},
+        {0x0203F, 0x02040, UnicodeCategory_t::PC}, {0x02041, 0x02043, UnicodeCategory_t::PO}, {0x02044, 0x02044, UnicodeCategory_t::SM},
+        {0x02045, 0x02045, UnicodeCategory_t::PS}, {0x02046, 0x02046, UnicodeCategory_t::PE}, {0x02047, 0x02051, UnicodeCategory_t::PO},
+        {0x02052, 0x02052, UnicodeCategory_t::SM}, {0x02053, 0x02053, UnicodeCategory_t::PO}, {0x02054, 0x02054, UnicodeCategory_t::PC},
+        {0x02055, 0x0205E, UnicodeCategory_t::PO}, {0x0205F, 0x0205F, UnicodeCategory_t::ZS}, {0x02060, 0x02064, UnicodeCategory_t::CF},
+        {0x02066, 0x0206F, UnicodeCategory_t::CF}, {0x02070, 0x02070, UnicodeCategory_t::NO}, {0x02071, 0x02071, UnicodeCategory_t::LM},
+        {0x02074, 0x02079, UnicodeCategory_t::NO}, {0x0207A, 0x0207C, UnicodeCategory_t::SM}, {0x0207D, 0x0207D, UnicodeCategory_t::PS},
+        {0x0207E, 0x0207E, UnicodeCategory_t::PE}, {0x0207F, 0x0207F, UnicodeCategory_t::LM}, {0x02080, 0x02089, UnicodeCategory_t::NO},
+        {0x0208A, 0x0208C, UnicodeCategory_t::SM}, {0x0208D, 0x0208D, UnicodeCategory_t::PS}, {0x0208E, 0x0208E, UnicodeCategory_t::PE},
+        {0x02090, 0x0209C, UnicodeCategory_t::LM}, {0x020A0, 0x020C0, UnicodeCategory_t::SC}, {0x020D0, 0x020DC, UnicodeCategory_t::MN},
+        {0x020DD, 0x020E0, UnicodeCategory_t::ME}, {0x020E1, 0x020E1, UnicodeCategory_t::MN}, {0x020E2, 0x020E4, UnicodeCategory_t::ME},
+        {0x020E5, 0x020F0, UnicodeCategory_t::MN}, {0x02100, 0x02101, UnicodeCategory_t::SO}, {0x02102, 0x02102, UnicodeCategory_t::LU},
+        {0x02103, 0x02106, UnicodeCategory_t::SO}, {0x02107, 0x02107, UnicodeCategory_t::LU}, {0x02108, 0x02109, UnicodeCategory_t::SO},
+        {0x0210A, 0x0210A, UnicodeCategory_t::LL}, {0x0210B, 0x0210D, UnicodeCategory_t::LU}, {0x0210E, 0x0210F, UnicodeCategory_t::LL},
+        {0x02110, 0x02112, UnicodeCategory_t::LU}, {0x02113, 0x02113, UnicodeCategory_t::LL}, {0x02114, 0x02114, UnicodeCategory_t::SO},
+        {0x02115, 0x02115, UnicodeCategory_t::LU}, {0x02116, 0x02117, UnicodeCategory_t::SO}, {0x02118, 0x02118, UnicodeCategory_t::SM},
+        {0x02119, 0x0211D, UnicodeCategory_t::LU}, {0x0211E, 0x02123, UnicodeCategory_t::SO}, {0x02124, 0x02124, UnicodeCategory_t::LU},
+        {0x02125, 0x02125, UnicodeCategory_t::SO}, {0x02126, 0x02126, UnicodeCategory_t::LU}, {0x02127, 0x02127, UnicodeCategory_t::SO},
+        {0x02128, 0x02128, UnicodeCategory_t::LU}, {0x02129, 0x02129, UnicodeCategory_t::SO}, {0x0212A, 0x0212D, UnicodeCategory_t::LU},
+        {0x0212E, 0x0212E, UnicodeCategory_t::SO}, {0x0212F, 0x0212F, UnicodeCategory_t::LL}, {0x02130, 0x02133, UnicodeCategory_t::LU},
+        {0x02134, 0x02134, UnicodeCategory_t::LL}, {0x02135, 0x02138, UnicodeCategory_t::LO}, {0x02139, 0x02139, UnicodeCategory_t::LL},
+        {0x0213A, 0x0213B, UnicodeCategory_t::SO}, {0x0213C, 0x0213D, UnicodeCategory_t::LL}, {0x0213E, 0x0213F, UnicodeCategory_t::LU},
+        {0x02140, 0x02144, UnicodeCategory_t::SM}, {0x02145, 0x02145, UnicodeCategory_t::LU}, {0x02146, 0x02149, UnicodeCategory_t::LL},
+        {0x0214A, 0x0214A, UnicodeCategory_t::SO}, {0x0214B, 0x0214B, UnicodeCategory_t::SM}, {0x0214C, 0x0214D, UnicodeCategory_t::SO},
+        {0x0214E, 0x0214E, UnicodeCategory_t::LL}, {0x0214F, 0x0214F, UnicodeCategory_t::SO}, {0x02150, 0x0215F, UnicodeCategory_t::NO},
+        {0x02160, 0x02182, UnicodeCategory_t::NL}, {0x02183, 0x02183, UnicodeCategory_t::LU}, {0x02184, 0x02184, UnicodeCategory_t::LL},
+        {0x02185, 0x02188, UnicodeCategory_t::NL}, {0x02189, 0x02189, UnicodeCategory_t::NO}, {0x0218A, 0x0218B, UnicodeCategory_t::SO},
+        {0x02190, 0x02194, UnicodeCategory_t::SM}, {0x02195, 0x02199, UnicodeCategory_t::SO}, {0x0219A, 0x0219B, UnicodeCategory_t::SM},
+        {0x0219C, 0x0219F, UnicodeCategory_t::SO}, {0x021A0, 0x021A0, UnicodeCategory_t::SM}, {0x021A1, 0x021A2, UnicodeCategory_t::SO},
+        {0x021A3, 0x021A3, UnicodeCategory_t::SM}, {0x021A4, 0x021A5, UnicodeCategory_t::SO}, {0x021A6, 0x021A6, UnicodeCategory_t::SM},
+        {0x021A7, 0x021AD, UnicodeCategory_t::SO}, {0x021AE, 0x021AE, UnicodeCategory_t::SM}, {0x021AF, 0x021CD, UnicodeCategory_t::SO},
+        {0x021CE, 0x021CF, UnicodeCategory_t::SM}, {0x021D0, 0x021D1, UnicodeCategory_t::SO}, {0x021D2, 0x021D2, UnicodeCategory_t::SM},
+        {0x021D3, 0x021D3, UnicodeCategory_t::SO}, {0x021D4, 0x021D4, UnicodeCategory_t::SM}, {0x021D5, 0x021F3, UnicodeCategory_t::SO},
+        {0x021F4, 0x022FF, UnicodeCategory_t::SM}, {0x02300, 0x02307, UnicodeCategory_t::SO}, {0x02308, 0x02308, UnicodeCategory_t::PS},
+        {0x02309, 0x02309, UnicodeCategory_t::PE}, {0x0230A, 0x0230A, UnicodeCategory_t::PS}, {0x0230B, 0x0230B, UnicodeCategory_t::PE},
+        {0x0230C, 0x0231F, UnicodeCategory_t::SO}, {0x02320, 0x02321, UnicodeCategory_t::SM}, {0x02322, 0x02328, UnicodeCategory_t::SO},
+        {0x02329, 0x02329, UnicodeCategory_t::PS}, {0x0232A, 0x0232A, UnicodeCategory_t::PE}, {0x0232B, 0x0237B, UnicodeCategory_t::SO},
+        {0x0237C, 0x0237C, UnicodeCategory_t::SM}, {0x0237D, 0x0239A, UnicodeCategory_t::SO}, {0x0239B, 0x023B3, UnicodeCategory_t::SM},
+        {0x023B4, 0x023DB, UnicodeCategory_t::SO}, {0x023DC, 0x023E1, UnicodeCategory_t::SM}, {0x023E2, 0x02426, UnicodeCategory_t::SO},
+        {0x02440, 0x0244A, UnicodeCategory_t::SO}, {0x02460, 0x0249B, UnicodeCategory_t::NO}, {0x0249C, 0x024E9, UnicodeCategory_t::SO},
+        {0x024EA, 0x024FF, UnicodeCategory_t::NO}, {0x02500, 0x025B6, UnicodeCategory_t::SO}, {0x025B7, 0x025B7, UnicodeCategory_t::SM},
+        {0x025B8, 0x025C0, UnicodeCategory_t::SO}, {0x025C1, 0x025C1, UnicodeCategory_t::SM}, {0x025C2, 0x025F7, UnicodeCategory_t::SO},
+        {0x025F8, 0x025FF, UnicodeCategory_t::SM}, {0x02600, 0x0266E, UnicodeCategory_t::SO}, {0x0266F, 0x0266F, UnicodeCategory_t::SM},
+        {0x02670, 0x02767, UnicodeCategory_t::SO}, {0x02768, 0x02768, UnicodeCategory_t::PS}, {0x02769, 0x02769, UnicodeCategory_t::PE},
+        {0x0276A, 0x0276A, UnicodeCategory_t::PS}, {0x0276B, 0x0276B, UnicodeCategory_t::PE}, {0x0276C, 0x0276C, UnicodeCategory_t::PS},
+        {0x0276D, 0x0276D, UnicodeCategory_t::PE}, {0x0276E, 0x0276E, UnicodeCategory_t::PS}, {0x0276F, 0x0276F, UnicodeCategory_t::PE},
+        {0x02770, 0x02770, UnicodeCategory_t::PS}, {0x02771, 0x02771, UnicodeCategory_t::PE}, {0x02772, 0x02772, UnicodeCategory_t::PS},
+        {0x02773, 0x02773, UnicodeCategory_t::PE}, {0x02774, 0x02774, UnicodeCategory_t::PS}, {0x02775, 0x02775, UnicodeCategory_t::PE},
+        {0x02776, 0x02793, UnicodeCategory_t::NO}, {0x02794, 0x027BF, UnicodeCategory_t::SO}, {0x027C0, 0x027C4, UnicodeCategory_t::SM},
+        {0x027C5, 0x027C5, UnicodeCategory_t::PS}, {0x027C6, 0x027C6, UnicodeCategory_t::PE}, {0x027C7, 0x027E5, UnicodeCategory_t::SM},
+        {0x027E6, 0x027E6, UnicodeCategory_t::PS}, {0x027E7, 0x027E7, UnicodeCategory_t::PE}, {0x027E8, 0x027E8, UnicodeCategory_t::PS},
+        {0x027E9, 0x027E9, UnicodeCategory_t::PE}, {0x027EA, 0x027EA, UnicodeCategory_t::PS}, {0x027EB, 0x027EB, UnicodeCategory_t::PE},
+        {0x027EC, 0x027EC, UnicodeCategory_t::PS}, {0x027ED, 0x027ED, UnicodeCategory_t::PE}, {0x027EE, 0x027EE, UnicodeCategory_t::PS},
+        {0x027EF, 0x027EF, UnicodeCategory_t::PE}, {0x027F0, 0x027FF, UnicodeCategory_t::SM}, {0x02800, 0x028FF, UnicodeCategory_t::SO},
+        {0x02900, 0x02982, UnicodeCategory_t::SM}, {0x02983, 0x02983, UnicodeCategory_t::PS}, {0x02984, 0x02984, UnicodeCategory_t::PE},
+        {0x02985, 0x02985, UnicodeCategory_t::PS}, {0x02986, 0x02986, UnicodeCategory_t::PE}, {0x02987, 0x02987, UnicodeCategory_t::PS},
+        {0x02988, 0x02988, UnicodeCategory_t::PE}, {0x02989, 0x02989, UnicodeCategory_t::PS}, {0x0298A, 0x0298A, UnicodeCategory_t::PE},
+        {0x0298B, 0x0298B, UnicodeCategory_t::PS}, {0x0298C, 0x0298C, UnicodeCategory_t::PE}, {0x0298D, 0x0298D, UnicodeCategory_t::PS},
+        {0x0298E, 0x0298E, UnicodeCategory_t::PE}, {0x0298F, 0x0298F, UnicodeCategory_t::PS}, {0x02990, 0x02990, UnicodeCategory_t::PE},
+        {0x02991, 0x02991, UnicodeCategory_t::PS}, {0x02992, 0x02992, UnicodeCategory_t::PE}, {0x02993, 0x02993, UnicodeCategory_t::PS},
+        {0x02994, 0x02994, UnicodeCategory_t::PE}, {0x02995, 0x02995, UnicodeCategory_t::PS}, {0x02996, 0x02996, UnicodeCategory_t::PE},
+        {0x02997, 0x02997, UnicodeCategory_t::PS}, {0x02998, 0x02998, UnicodeCategory_t::PE}, {0x02999, 0x029D7, UnicodeCategory_t::SM},
+        {0x029D8, 0x029D8, UnicodeCategory_t::PS}, {0x029D9, 0x029D9, UnicodeCategory_t::PE}, {0x029DA, 0x029DA, UnicodeCategory_t::PS},
+        {0x029DB, 0x029DB, UnicodeCategory_t::PE}, {0x029DC, 0x029FB, UnicodeCategory_t::SM}, {0x029FC, 0x029FC, UnicodeCategory_t::PS},
+        {0x029FD, 0x029FD, UnicodeCategory_t::PE}, {0x029FE, 0x02AFF, UnicodeCategory_t::SM}, {0x02B00, 0x02B2F, UnicodeCategory_t::SO},
+        {0x02B30, 0x02B44, UnicodeCategory_t::SM}, {0x02B45, 0x02B46, UnicodeCategory_t::SO}, {0x02B47, 0x02B4C, UnicodeCategory_t::SM},
+        {0x02B4D, 0x02B73, UnicodeCategory_t::SO}, {0x02B76, 0x02B95, UnicodeCategory_t::SO}, {0x02B97, 0x02BFF, UnicodeCategory_t::SO},
+        {0x02C00, 0x02C2F, UnicodeCategory_t::LU}, {0x02C30, 0x02C5F, UnicodeCategory_t::LL}, {0x02C60, 0x02C60, UnicodeCategory_t::LU},
+        {0x02C61, 0x02C61, UnicodeCategory_t::LL}, {0x02C62, 0x02C64, UnicodeCategory_t::LU}, {0x02C65, 0x02C66, UnicodeCategory_t::LL},
+        {0x02C67, 0x02C67, UnicodeCategory_t::LU}, {0x02C68, 0x02C68, UnicodeCategory_t::LL}, {0x02C69, 0x02C69, UnicodeCategory_t::LU},
+        {0x02C6A, 0x02C6A, UnicodeCategory_t::LL}, {0x02C6B, 0x02C6B, UnicodeCategory_t::LU}, {0x02C6C, 0x02C6C, UnicodeCategory_t::LL},
+        {0x02C6D, 0x02C70, UnicodeCategory_t::LU}, {0x02C71, 0x02C71, UnicodeCategory_t::LL}, {0x02C72, 0x02C72, UnicodeCategory_t::LU},
+        {0x02C73, 0x02C74, UnicodeCategory_t::LL}, {0x02C75, 0x02C75, UnicodeCategory_t::LU}, {0x02C76, 0x02C7B, UnicodeCategory_t::LL},
+        {0x02C7C, 0x02C7D, UnicodeCategory_t::LM}, {0x02C7E, 0x02C80, UnicodeCategory_t::LU}, {0x02C81, 0x02C81, UnicodeCategory_t::LL},
+        {0x02C82, 0x02C82, UnicodeCategory_t::LU}, {0x02C83, 0x02C83, UnicodeCategory_t::LL}, {0x02C84, 0x02C84, UnicodeCategory_t::LU},
+        {0x02C85, 0x02C85, UnicodeCategory_t::LL}, {0x02C86, 0x02C86, UnicodeCategory_t::LU}, {0x02C87, 0x02C87, UnicodeCategory_t::LL},
+        {0x02C88, 0x02C88, UnicodeCategory_t::LU}, {0x02C89, 0x02C89, UnicodeCategory_t::LL}, {0x02C8A, 0x02C8A, UnicodeCategory_t::LU},
+        {0x02C8B, 0x02C8B, UnicodeCategory_t::LL}, {0x02C8C, 0x02C8C, UnicodeCategory_t::LU}, {0x02C8D, 0x02C8D, UnicodeCategory_t::LL},
+        {0x02C8E, 0x02C8E, UnicodeCategory_t::LU}, {0x02C8F, 0x02C8F, UnicodeCategory_t::LL}, {0x02C90, 0x02C90, UnicodeCategory_t::LU},
+        {0x02C91, 0x02C91, UnicodeCategory_t::LL}, {0x02C92, 0x02C92, UnicodeCategory_t::LU}, {0x02C93, 0x02C93, UnicodeCategory_t::LL},
+        {0x02C94, 0x02C94, UnicodeCategory_t::LU}, {0x02C95, 0x02C95, UnicodeCategory_t::LL}, {0x02C96, 0x02C96, UnicodeCategory_t::LU},
+        {0x02C97, 0x02C97, UnicodeCategory_t::LL}, {0x02C98, 0x02C98, UnicodeCategory_t::LU}, {0x02C99, 0x02C99, UnicodeCategory_t::LL},
+        {0x02C9A, 0x02C9A, UnicodeCategory_t::LU}, {0x02C9B, 0x02C9B, UnicodeCategory_t::LL}, {0x02C9C, 0x02C9C, UnicodeCategory_t::LU},
+        {0x02C9D, 0x02C9D, UnicodeCategory_t::LL}, {0x02C9E, 0x02C9E, UnicodeCategory_t::LU}, {0x02C9F, 0x02C9F, UnicodeCategory_t::LL},
+        {0x02CA0, 0x02CA0, UnicodeCategory_t::LU}, {0x02CA1, 0x02CA1, UnicodeCategory_t::LL}, {0x02CA2, 0x02CA2, UnicodeCategory_t::LU},
+        {0x02CA3, 0x02CA3, UnicodeCategory_t::LL}, {0x02CA4, 0x02CA4, UnicodeCategory_t::LU}, {0x02CA5, 0x02CA5, UnicodeCategory_t::LL},
+        {0x02CA6, 0x02CA6, UnicodeCategory_t::LU}, {0x02CA7, 0x02CA7, UnicodeCategory_t::LL}, {0x02CA8, 0x02CA8, UnicodeCategory_t::LU},
+        {0x02CA9, 0x02CA9, UnicodeCategory_t::LL}, {0x02CAA, 0x02CAA, UnicodeCategory_t::LU}, {0x02CAB, 0x02CAB, UnicodeCategory_t::LL},
+        {0x02CAC, 0x02CAC, UnicodeCategory_t::LU}, {0x02CAD, 0x02CAD, UnicodeCategory_t::LL}, {0x02CAE, 0x02CAE, UnicodeCategory_t::LU},
+        {0x02CAF, 0x02CAF, UnicodeCategory_t::LL}, {0x02CB0, 0x02CB0, UnicodeCategory_t::LU}, {0x02CB1, 0x02CB1, UnicodeCategory_t::LL},
+        {0x02CB2, 0x02CB2, UnicodeCategory_t::LU}, {0x02CB3, 0x02CB3, UnicodeCategory_t::LL}, {0x02CB4, 0x02CB4, UnicodeCategory_t::LU},
+        {0x02CB5, 0x02CB5, UnicodeCategory_t::LL}, {0x02CB6, 0x02CB6, UnicodeCategory_t::LU}, {0x02CB7, 0x02CB7, UnicodeCategory_t::LL},
+        {0x02CB8, 0x02CB8, UnicodeCategory_t::LU}, {0x02CB9, 0x02CB9, UnicodeCategory_t::LL}, {0x02CBA, 0x02CBA, UnicodeCategory_t::LU},
+        {0x02CBB, 0x02CBB, UnicodeCategory_t::LL}, {0x02CBC, 0x02CBC, UnicodeCategory_t::LU}, {0x02CBD, 0x02CBD, UnicodeCategory_t::LL},
+        {0x02CBE, 0x02CBE, UnicodeCategory_t::LU}, {0x02CBF, 0x02CBF, UnicodeCategory_t::LL}, {0x02CC0, 0x02CC0, UnicodeCategory_t::LU},
+        {0x02CC1, 0x02CC1, UnicodeCategory_t::LL}, {0x02CC2, 0x02CC2, UnicodeCategory_t::LU}, {0x02CC3, 0x02CC3, UnicodeCategory_t::LL},
+        {0x02CC4, 0x02CC4, UnicodeCategory_t::LU}, {0x02CC5, 0x02CC5, UnicodeCategory_t::LL}, {0x02CC6, 0x02CC6, UnicodeCategory_t::LU},
+        {0x02CC7, 0x02CC7, UnicodeCategory_t::LL}, {0x02CC8, 0x02CC8, UnicodeCategory_t::LU}, {0x02CC9, 0x02CC9, UnicodeCategory_t::LL},
+        {0x02CCA, 0x02CCA, UnicodeCategory_t::LU}, {0x02CCB, 0x02CCB, UnicodeCategory_t::LL}, {0x02CCC, 0x02CCC, UnicodeCategory_t::LU},
+        {0x02CCD, 0x02CCD, UnicodeCategory_t::LL}, {0x02CCE, 0x02CCE, UnicodeCategory_t::LU}, {0x02CCF, 0x02CCF, UnicodeCategory_t::LL},
+        {0x02CD0, 0x02CD0, UnicodeCategory_t::LU}, {0x02CD1, 0x02CD1, UnicodeCategory_t::LL}, {0x02CD2, 0x02CD2, UnicodeCategory_t::LU},
+        {0x02CD3, 0x02CD3, UnicodeCategory_t::LL}, {0x02CD4, 0x02CD4, UnicodeCategory_t::LU}, {0x02CD5, 0x02CD5, UnicodeCategory_t::LL},
+        {0x02CD6, 0x02CD6, UnicodeCategory_t::LU}, {0x02CD7, 0x02CD7, UnicodeCategory_t::LL}, {0x02CD8, 0x02CD8, UnicodeCategory_t::LU},
+        {0x02CD9, 0x02CD9, UnicodeCategory_t::LL}, {0x02CDA, 0x02CDA, UnicodeCategory_t::LU}, {0x02CDB, 0x02CDB, UnicodeCategory_t::LL},
+        {0x02CDC, 0x02CDC, UnicodeCategory_t::LU}, {0x02CDD, 0x02CDD, UnicodeCategory_t::LL}, {0x02CDE, 0x02CDE, UnicodeCategory_t::LU},
+        {0x02CDF, 0x02CDF, UnicodeCategory_t::LL}, {0x02CE0, 0x02CE0, UnicodeCategory_t::LU}, {0x02CE1, 0x02CE1, UnicodeCategory_t::LL},
+        {0x02CE2, 0x02CE2, UnicodeCategory_t::LU}, {0x02CE3, 0x02CE4, UnicodeCategory_t::LL}, {0x02CE5, 0x02CEA, UnicodeCategory_t::SO},
+        {0x02CEB, 0x02CEB, UnicodeCategory_t::LU}, {0x02CEC, 0x02CEC, UnicodeCategory_t::LL}, {0x02CED, 0x02CED, UnicodeCategory_t::LU},
+        {0x02CEE, 0x02CEE, UnicodeCategory_t::LL}, {0x02CEF, 0x02CF1, UnicodeCategory_t::MN}, {0x02CF2, 0x02CF2, UnicodeCategory_t::LU},
+        {0x02CF3, 0x02CF3, UnicodeCategory_t::LL}, {0x02CF9, 0x02CFC, UnicodeCategory_t::PO}, {0x02CFD, 0x02CFD, UnicodeCategory_t::NO},
+        {0x02CFE, 0x02CFF, UnicodeCategory_t::PO}, {0x02D00, 0x02D25, UnicodeCategory_t::LL}, {0x02D27, 0x02D27, UnicodeCategory_t::LL},
+        {0x02D2D, 0x02D2D, UnicodeCategory_t::LL}, {0x02D30, 0x02D67, UnicodeCategory_t::LO}, {0x02D6F, 0x02D6F, UnicodeCategory_t::LM},
+        {0x02D70, 0x02D70, UnicodeCategory_t::PO}, {0x02D7F, 0x02D7F, UnicodeCategory_t::MN}, {0x02D80, 0x02D96, UnicodeCategory_t::LO},
+        {0x02DA0, 0x02DA6, UnicodeCategory_t::LO}, {0x02DA8, 0x02DAE, UnicodeCategory_t::LO}, {0x02DB0, 0x02DB6, UnicodeCategory_t::LO},
+        {0x02DB8, 0x02DBE, UnicodeCategory_t::LO}, {0x02DC0, 0x02DC6, UnicodeCategory_t::LO}, {0x02DC8, 0x02DCE, UnicodeCategory_t::LO},
+        {0x02DD0, 0x02DD6, UnicodeCategory_t::LO}, {0x02DD8, 0x02DDE, UnicodeCategory_t::LO}, {0x02DE0, 0x02DFF, UnicodeCategory_t::MN},
+        {0x02E00, 0x02E01, UnicodeCategory_t::PO}, {0x02E02, 0x02E02, UnicodeCategory_t::PI}, {0x02E03, 0x02E03, UnicodeCategory_t::PF},
+        {0x02E04, 0x02E04, UnicodeCategory_t::PI}, {0x02E05, 0x02E05, UnicodeCategory_t::PF}, {0x02E06, 0x02E08, UnicodeCategory_t::PO},
+        {0x02E09, 0x02E09, UnicodeCategory_t::PI}, {0x02E0A, 0x02E0A, UnicodeCategory_t::PF}, {0x02E0B, 0x02E0B, UnicodeCategory_t::PO},
+        {0x02E0C, 0x02E0C, UnicodeCategory_t::PI}, {0x02E0D, 0x02E0D, UnicodeCategory_t::PF}, {0x02E0E, 0x02E16, UnicodeCategory_t::PO},
+        {0x02E17, 0x02E17, UnicodeCategory_t::PD}, {0x02E18, 0x02E19, UnicodeCategory_t::PO}, {0x02E1A, 0x02E1A, UnicodeCategory_t::PD},
+        {0x02E1B, 0x02E1B, UnicodeCategory_t::PO}, {0x02E1C, 0x02E1C, UnicodeCategory_t::PI}, {0x02E1D, 0x02E1D, UnicodeCategory_t::PF},
+        {0x02E1E, 0x02E1F, UnicodeCategory_t::PO}, {0x02E20, 0x02E20, UnicodeCategory_t::PI}, {0x02E21, 0x02E21, UnicodeCategory_t::PF},
+        {0x02E22, 0x02E22, UnicodeCategory_t::PS}, {0x02E23, 0x02E23, UnicodeCategory_t::PE}, {0x02E24, 0x02E24, UnicodeCategory_t::PS},
+        {0x02E25, 0x02E25, UnicodeCategory_t::PE}, {0x02E26, 0x02E26, UnicodeCategory_t::PS}, {0x02E27, 0x02E27, UnicodeCategory_t::PE},
+        {0x02E28, 0x02E28, UnicodeCategory_t::PS}, {0x02E29, 0x02E29, UnicodeCategory_t::PE}, {0x02E2A, 0x02E2E, UnicodeCategory_t::PO},
+        {0x02E2F, 0x02E2F, UnicodeCategory_t::LM}, {0x02E30, 0x02E39, UnicodeCategory_t::PO}, {0x02E3A, 0x02E3B, UnicodeCategory_t::PD},
+        {0x02E3C, 0x02E3F, UnicodeCategory_t::PO}, {0x02E40, 0x02E40, UnicodeCategory_t::PD}, {0x02E41, 0x02E41, UnicodeCategory_t::PO},
+        {0x02E42, 0x02E42, UnicodeCategory_t::PS}, {0x02E43, 0x02E4F, UnicodeCategory_t::PO}, {0x02E50, 0x02E51, UnicodeCategory_t::SO},
+        {0x02E52, 0x02E54, UnicodeCategory_t::PO}, {0x02E55, 0x02E55, UnicodeCategory_t::PS}, {0x02E56, 0x02E56, UnicodeCategory_t::PE},
+        {0x02E57, 0x02E57, UnicodeCategory_t::PS}, {0x02E58, 0x02E58, UnicodeCategory_t::PE}, {0x02E59, 0x02E59, UnicodeCategory_t::PS},
+        {0x02E5A, 0x02E5A, UnicodeCategory_t::PE}, {0x02E5B, 0x02E5B, UnicodeCategory_t::PS}, {0x02E5C, 0x02E5C, UnicodeCategory_t::PE},
+        {0x02E5D, 0x02E5D, UnicodeCategory_t::PD}, {0x02E80, 0x02E99, UnicodeCategory_t::SO}, {0x02E9B, 0x02EF3, UnicodeCategory_t::SO},
+        {0x02F00, 0x02FD5, UnicodeCategory_t::SO}, {0x02FF0, 0x02FFB, UnicodeCategory_t::SO}, {0x03000, 0x03000, UnicodeCategory_t::ZS},
+        {0x03001, 0x03003, UnicodeCategory_t::PO}, {0x03004, 0x03004, UnicodeCategory_t::SO}, {0x03005, 0x03005, UnicodeCategory_t::LM},
+        {0x03006, 0x03006, UnicodeCategory_t::LO}, {0x03007, 0x03007, UnicodeCategory_t::NL}, {0x03008, 0x03008, UnicodeCategory_t::PS},
+        {0x03009, 0x03009, UnicodeCategory_t::PE}, {0x0300A, 0x0300A, UnicodeCategory_t::PS}, {0x0300B, 0x0300B, UnicodeCategory_t::PE},
+        {0x0300C, 0x0300C, UnicodeCategory_t::PS}, {0x0300D, 0x0300D, UnicodeCategory_t::PE}, {0x0300E, 0x0300E, UnicodeCategory_t::PS},
+        {0x0300F, 0x0300F, UnicodeCategory_t::PE}, {0x03010, 0x03010, UnicodeCategory_t::PS}, {0x03011, 0x03011, UnicodeCategory_t::PE},
+        {0x03012, 0x03013, UnicodeCategory_t::SO}, {0x03014, 0x03014, UnicodeCategory_t::PS}, {0x03015, 0x03015, UnicodeCategory_t::PE},
+        {0x03016, 0x03016, UnicodeCategory_t::PS}, {0x03017, 0x03017, UnicodeCategory_t::PE}, {0x03018, 0x03018, UnicodeCategory_t::PS},
+        {0x03019, 0x03019, UnicodeCategory_t::PE}, {0x0301A, 0x0301A, UnicodeCategory_t::PS}, {0x0301B, 0x0301B, UnicodeCategory_t::PE},
+        {0x0301C, 0x0301C, UnicodeCategory_t::PD}, {0x0301D, 0x0301D, UnicodeCategory_t::PS}, {0x0301E, 0x0301F, UnicodeCategory_t::PE},
+        {0x03020, 0x03020, UnicodeCategory_t::SO}, {0x03021, 0x03029, UnicodeCategory_t::NL}, {0x0302A, 0x0302D, UnicodeCategory_t::MN},
+        {0x0302E, 0x0302F, UnicodeCategory_t::MC}, {0x03030, 0x03030, UnicodeCategory_t::PD}, {0x03031, 0x03035, UnicodeCategory_t::LM},
+        {0x03036, 0x03037, UnicodeCategory_t::SO}, {0x03038, 0x0303A, UnicodeCategory_t::NL}, {0x0303B, 0x0303B, UnicodeCategory_t::LM},
+        {0x0303C, 0x0303C, UnicodeCategory_t::LO}, {0x0303D, 0x0303D, UnicodeCategory_t::PO}, {0x0303E, 0x0303F, UnicodeCategory_t::SO},
+        {0x03041, 0x03096, UnicodeCategory_t::LO}, {0x03099, 0x0309A, UnicodeCategory_t::MN}, {0x0309B, 0x0309C, UnicodeCategory_t::SK},
+        {0x0309D, 0x0309E, UnicodeCategory_t::LM}, {0x0309F, 0x0309F, UnicodeCategory_t::LO}, {0x030A0, 0x030A0, UnicodeCategory_t::PD},
+        {0x030A1, 0x030FA, UnicodeCategory_t::LO}, {0x030FB, 0x030FB, UnicodeCategory_t::PO}, {0x030FC, 0x030FE, UnicodeCategory_t::LM},
+        {0x030FF, 0x030FF, UnicodeCategory_t::LO}, {0x03105, 0x0312F, UnicodeCategory_t::LO}, {0x03131, 0x0318E, UnicodeCategory_t::LO},
+        {0x03190, 0x03191, UnicodeCategory_t::SO}, {0x03192, 0x03195, UnicodeCategory_t::NO}, {0x03196, 0x0319F, UnicodeCategory_t::SO},
+        {0x031A0, 0x031BF, UnicodeCategory_t::LO}, {0x031C0, 0x031E3, UnicodeCategory_t::SO}, {0x031F0, 0x031FF, UnicodeCategory_t::LO},
+        {0x03200, 0x0321E, UnicodeCategory_t::SO}, {0x03220, 0x03229, UnicodeCategory_t::NO}, {0x0322A, 0x03247, UnicodeCategory_t::SO},
+        {0x03248, 0x0324F, UnicodeCategory_t::NO}, {0x03250, 0x03250, UnicodeCategory_t::SO}, {0x03251, 0x0325F, UnicodeCategory_t::NO},
+        {0x03260, 0x0327F, UnicodeCategory_t::SO}, {0x03280, 0x03289, UnicodeCategory_t::NO}, {0x0328A, 0x032B0, UnicodeCategory_t::SO},
+        {0x032B1, 0x032BF, UnicodeCategory_t::NO}, {0x032C0, 0x033FF, UnicodeCategory_t::SO}, {0x03400, 0x04DBF, UnicodeCategory_t::LO},
+        {0x04DC0, 0x04DFF, UnicodeCategory_t::SO}, {0x04E00, 0x0A014, UnicodeCategory_t::LO}, {0x0A015, 0x0A015, UnicodeCategory_t::LM},
+        {0x0A016, 0x0A48C, UnicodeCategory_t::LO}, {0x0A490, 0x0A4C6, UnicodeCategory_t::SO}, {0x0A4D0, 0x0A4F7, UnicodeCategory_t::LO},
+        {0x0A4F8, 0x0A4FD, UnicodeCategory_t::LM}, {0x0A4FE, 0x0A4FF, UnicodeCategory_t::PO}, {0x0A500, 0x0A60B, UnicodeCategory_t::LO},
+        {0x0A60C, 0x0A60C, UnicodeCategory_t::LM}, {0x0A60D, 0x0A60F, UnicodeCategory_t::PO}, {0x0A610, 0x0A61F, UnicodeCategory_t::LO},
+        {0x0A620, 0x0A629, UnicodeCategory_t::ND}, {0x0A62A, 0x0A62B, UnicodeCategory_t::LO}, {0x0A640, 0x0A640, UnicodeCategory_t::LU},
+        {0x0A641, 0x0A641, UnicodeCategory_t::LL}, {0x0A642, 0x0A642, UnicodeCategory_t::LU}, {0x0A643, 0x0A643, UnicodeCategory_t::LL},
+        {0x0A644, 0x0A644, UnicodeCategory_t::LU}, {0x0A645, 0x0A645, UnicodeCategory_t::LL}, {0x0A646, 0x0A646, UnicodeCategory_t::LU},
+        {0x0A647, 0x0A647, UnicodeCategory_t::LL}, {0x0A648, 0x0A648, UnicodeCategory_t::LU}, {0x0A649, 0x0A649, UnicodeCategory_t::LL},
+        {0x0A64A, 0x0A64A, UnicodeCategory_t::LU}, {0x0A64B, 0x0A64B, UnicodeCategory_t::LL}, {0x0A64C, 0x0A64C, UnicodeCategory_t::LU},
+        {0x0A64D, 0x0A64D, UnicodeCategory_t::LL}, {0x0A64E, 0x0A64E, UnicodeCategory_t::LU}, {0x0A64F, 0x0A64F, UnicodeCategory_t::LL},
+        {0x0A650, 0x0A650, UnicodeCategory_t::LU}, {0x0A651, 0x0A651, UnicodeCategory_t::LL}, {0x0A652, 0x0A652, UnicodeCategory_t::LU},
+        {0x0A653, 0x0A653, UnicodeCategory_t::LL}, {0x0A654, 0x0A654, UnicodeCategory_t::LU}, {0x0A655, 0x0A655, UnicodeCategory_t::LL},
+        {0x0A656, 0x0A656, UnicodeCategory_t::LU}, {0x0A657, 0x0A657, UnicodeCategory_t::LL}, {0x0A658, 0x0A658, UnicodeCategory_t::LU},
+        {0x0A659, 0x0A659, UnicodeCategory_t::LL}, {0x0A65A, 0x0A65A, UnicodeCategory_t::LU}, {0x0A65B, 0x0A65B, UnicodeCategory_t::LL},
+        {0x0A65C, 0x0A65C, UnicodeCategory_t::LU}, {0x0A65D, 0x0A65D, UnicodeCategory_t::LL}, {0x0A65E, 0x0A65E, UnicodeCategory_t::LU},
+        {0x0A65F, 0x0A65F, UnicodeCategory_t::LL}, {0x0A660, 0x0A660, UnicodeCategory_t::LU}, {0x0A661, 0x0A661, UnicodeCategory_t::LL},
+        {0x0A662, 0x0A662, UnicodeCategory_t::LU}, {0x0A663, 0x0A663, UnicodeCategory_t::LL}, {0x0A664, 0x0A664, UnicodeCategory_t::LU},
+        {0x0A665, 0x0A665, UnicodeCategory_t::LL}, {0x0A666, 0x0A666, UnicodeCategory_t::LU}, {0x0A667, 0x0A667, UnicodeCategory_t::LL},
+        {0x0A668, 0x0A668, UnicodeCategory_t::LU}, {0x0A669, 0x0A669, UnicodeCategory_t::LL}, {0x0A66A, 0x0A66A, UnicodeCategory_t::LU},
+        {0x0A66B, 0x0A66B, UnicodeCategory_t::LL}, {0x0A66C, 0x0A66C, UnicodeCategory_t::LU}, {0x0A66D, 0x0A66D, UnicodeCategory_t::LL},
+        {0x0A66E, 0x0A66E, UnicodeCategory_t::LO}, {0x0A66F, 0x0A66F, UnicodeCategory_t::MN}, {0x0A670, 0x0A672, UnicodeCategory_t::ME},
+        {0x0A673, 0x0A673, UnicodeCategory_t::PO}, {0x0A674, 0x0A67D, UnicodeCategory_t::MN}, {0x0A67E, 0x0A67E, UnicodeCategory_t::PO},
+        {0x0A67F, 0x0A67F, UnicodeCategory_t::LM}, {0x0A680, 0x0A680, UnicodeCategory_t::LU}, {0x0A681, 0x0A681, UnicodeCategory_t::LL},
+        {0x0A682, 0x0A682, UnicodeCategory_t::LU}, {0x0A683, 0x0A683, UnicodeCategory_t::LL}, {0x0A684, 0x0A684, UnicodeCategory_t::LU},
+        {0x0A685, 0x0A685, UnicodeCategory_t::LL}, {0x0A686, 0x0A686, UnicodeCategory_t::LU}, {0x0A687, 0x0A687, UnicodeCategory_t::LL},
+        {0x0A688, 0x0A688, UnicodeCategory_t::LU}, {0x0A689, 0x0A689, UnicodeCategory_t::LL}, {0x0A68A, 0x0A68A, UnicodeCategory_t::LU},
+        {0x0A68B, 0x0A68B, UnicodeCategory_t::LL}, {0x0A68C, 0x0A68C, UnicodeCategory_t::LU}, {0x0A68D, 0x0A68D, UnicodeCategory_t::LL},
+        {0x0A68E, 0x0A68E, UnicodeCategory_t::LU}, {0x0A68F, 0x0A68F, UnicodeCategory_t::LL}, {0x0A690, 0x0A690, UnicodeCategory_t::LU},
+        {0x0A691, 0x0A691, UnicodeCategory_t::LL}, {0x0A692, 0x0A692, UnicodeCategory_t::LU}, {0x0A693, 0x0A693, UnicodeCategory_t::LL},
+        {0x0A694, 0x0A694, UnicodeCategory_t::LU}, {0x0A695, 0x0A695, UnicodeCategory_t::LL}, {0x0A696, 0x0A696, UnicodeCategory_t::LU},
+        {0x0A697, 0x0A697, UnicodeCategory_t::LL}, {0x0A698, 0x0A698, UnicodeCategory_t::LU}, {0x0A699, 0x0A699, UnicodeCategory_t::LL},
+        {0x0A69A, 0x0A69A, UnicodeCategory_t::LU}, {0x0A69B, 0x0A69B, UnicodeCategory_t::LL}, {0x0A69C, 0x0A69D, UnicodeCategory_t::LM},
+        {0x0A69E, 0x0A69F, UnicodeCategory_t::MN}, {0x0A6A0, 0x0A6E5, UnicodeCategory_t::LO}, {0x0A6E6, 0x0A6EF, UnicodeCategory_t::NL},
+        {0x0A6F0, 0x0A6F1, UnicodeCategory_t::MN}, {0x0A6F2, 0x0A6F7, UnicodeCategory_t::PO}, {0x0A700, 0x0A716, UnicodeCategory_t::SK},
+        {0x0A717, 0x0A71F, UnicodeCategory_t::LM}, {0x0A720, 0x0A721, UnicodeCategory_t::SK}, {0x0A722, 0x0A722, UnicodeCategory_t::LU},
+        {0x0A723, 0x0A723, UnicodeCategory_t::LL}, {0x0A724, 0x0A724, UnicodeCategory_t::LU}, {0x0A725, 0x0A725, UnicodeCategory_t::LL},
+        {0x0A726, 0x0A726, UnicodeCategory_t::LU}, {0x0A727, 0x0A727, UnicodeCategory_t::LL}, {0x0A728, 0x0A728, UnicodeCategory_t::LU},
+        {0x0A729, 0x0A729, UnicodeCategory_t::LL}, {0x0A72A, 0x0A72A, UnicodeCategory_t::LU}, {0x0A72B, 0x0A72B, UnicodeCategory_t::LL},
+        {0x0A72C, 0x0A72C, UnicodeCategory_t::LU}, {0x0A72D, 0x0A72D, UnicodeCategory_t::LL}, {0x0A72E, 0x0A72E, UnicodeCategory_t::LU},
+        {0x0A72F, 0x0A731, UnicodeCategory_t::LL}, {0x0A732, 0x0A732, UnicodeCategory_t::LU}, {0x0A733, 0x0A733, UnicodeCategory_t::LL},
+        {0x0A734, 0x0A734, UnicodeCategory_t::LU}, {0x0A735, 0x0A735, UnicodeCategory_t::LL}, {0x0A736, 0x0A736, UnicodeCategory_t::LU},
+        {0x0A737, 0x0A737, UnicodeCategory_t::LL}, {0x0A738, 0x0A738, UnicodeCategory_t::LU}, {0x0A739, 0x0A739, UnicodeCategory_t::LL},
+        {0x0A73A, 0x0A73A, UnicodeCategory_t::LU}, {0x0A73B, 0x0A73B, UnicodeCategory_t::LL}, {0x0A73C, 0x0A73C, UnicodeCategory_t::LU},
+        {0x0A73D, 0x0A73D, UnicodeCategory_t::LL}, {0x0A73E, 0x0A73E, UnicodeCategory_t::LU}, {0x0A73F, 0x0A73F, UnicodeCategory_t::LL},
+        {0x0A740, 0x0A740, UnicodeCategory_t::LU}, {0x0A741, 0x0A741, UnicodeCategory_t::LL}, {0x0A742, 0x0A742, UnicodeCategory_t::LU},
+        {0x0A743, 0x0A743, UnicodeCategory_t::LL}, {0x0A744, 0x0A744, UnicodeCategory_t::LU}, {0x0A745, 0x0A745, UnicodeCategory_t::LL},
+        {0x0A746, 0x0A746, UnicodeCategory_t::LU}, {0x0A747, 0x0A747, UnicodeCategory_t::LL}, {0x0A748, 0x0A748, UnicodeCategory_t::LU},
+        {0x0A749, 0x0A749, UnicodeCategory_t::LL}, {0x0A74A, 0x0A74A, UnicodeCategory_t::LU}, {0x0A74B, 0x0A74B, UnicodeCategory_t::LL},
+        {0x0A74C, 0x0A74C, UnicodeCategory_t::LU}, {0x0A74D, 0x0A74D, UnicodeCategory_t::LL}, {0x0A74E, 0x0A74E, UnicodeCategory_t::LU},
+        {0x0A74F, 0x0A74F, UnicodeCategory_t::LL}, {0x0A750, 0x0A750, UnicodeCategory_t::LU}, {0x0A751, 0x0A751, UnicodeCategory_t::LL},
+        {0x0A752, 0x0A752, UnicodeCategory_t::LU}, {0x0A753, 0x0A753, UnicodeCategory_t::LL}, {0x0A754, 0x0A754, UnicodeCategory_t::LU},
+        {0x0A755, 0x0A755, UnicodeCategory_t::LL}, {0x0A756, 0x0A756, UnicodeCategory_t::LU}, {0x0A757, 0x0A757, UnicodeCategory_t::LL},
+        {0x0A758, 0x0A758, UnicodeCategory_t::LU}, {0x0A759, 0x0A759, UnicodeCategory_t::LL}, {0x0A75A, 0x0A75A, UnicodeCategory_t::LU},
+        {0x0A75B, 0x0A75B, UnicodeCategory_t::LL}, {0x0A75C, 0x0A75C, UnicodeCategory_t::LU}, {0x0A75D, 0x0A75D, UnicodeCategory_t::LL},
+        {0x0A75E, 0x0A75E, UnicodeCategory_t::LU}, {0x0A75F, 0x0A75F, UnicodeCategory_t::LL}, {0x0A760, 0x0A760, UnicodeCategory_t::LU},
+        {0x0A761, 0x0A761, UnicodeCategory_t::LL}, {0x0A762, 0x0A762, UnicodeCategory_t::LU}, {0x0A763, 0x0A763, UnicodeCategory_t::LL},
+        {0x0A764, 0x0A764, UnicodeCategory_t::LU}, {0x0A765, 0x0A765, UnicodeCategory_t::LL}, {0x0A766, 0x0A766, UnicodeCategory_t::LU},
+        {0x0A767, 0x0A767, UnicodeCategory_t::LL}, {0x0A768, 0x0A768, UnicodeCategory_t::LU}, {0x0A769, 0x0A769, UnicodeCategory_t::LL},
+        {0x0A76A, 0x0A76A, UnicodeCategory_t::LU}, {0x0A76B, 0x0A76B, UnicodeCategory_t::LL}, {0x0A76C, 0x0A76C, UnicodeCategory_t::LU},
+        {0x0A76D, 0x0A76D, UnicodeCategory_t::LL}, {0x0A76E, 0x0A76E, UnicodeCategory_t::LU}, {0x0A76F, 0x0A76F, UnicodeCategory_t::LL},
+        {0x0A770, 0x0A770, UnicodeCategory_t::LM}, {0x0A771, 0x0A778, UnicodeCategory_t::LL}, {0x0A779, 0x0A779, UnicodeCategory_t::LU},
+        {0x0A77A, 0x0A77A, UnicodeCategory_t::LL}, {0x0A77B, 0x0A77B, UnicodeCategory_t::LU}, {0x0A77C, 0x0A77C, UnicodeCategory_t::LL},
+        {0x0A77D, 0x0A77E, UnicodeCategory_t::LU}, {0x0A77F, 0x0A77F, UnicodeCategory_t::LL}, {0x0A780, 0x0A780, UnicodeCategory_t::LU},
+        {0x0A781, 0x0A781, UnicodeCategory_t::LL}, {0x0A782, 0x0A782, UnicodeCategory_t::LU}, {0x0A783, 0x0A783, UnicodeCategory_t::LL},
+        {0x0A784, 0x0A784, UnicodeCategory_t::LU}, {0x0A785, 0x0A785, UnicodeCategory_t::LL}, {0x0A786, 0x0A786, UnicodeCategory_t::LU},
+        {0x0A787, 0x0A787, UnicodeCategory_t::LL}, {0x0A788, 0x0A788, UnicodeCategory_t::LM}, {0x0A789, 0x0A78A, UnicodeCategory_t::SK},
+        {0x0A78B, 0x0A78B, UnicodeCategory_t::LU}, {0x0A78C, 0x0A78C, UnicodeCategory_t::LL}, {0x0A78D, 0x0A78D, UnicodeCategory_t::LU},
+        {0x0A78E, 0x0A78E, UnicodeCategory_t::LL}, {0x0A78F, 0x0A78F, UnicodeCategory_t::LO}, {0x0A790, 0x0A790, UnicodeCategory_t::LU},
+        {0x0A791, 0x0A791, UnicodeCategory_t::LL}, {0x0A792, 0x0A792, UnicodeCategory_t::LU}, {0x0A793, 0x0A795, UnicodeCategory_t::LL},
+        {0x0A796, 0x0A796, UnicodeCategory_t::LU}, {0x0A797, 0x0A797, UnicodeCategory_t::LL}, {0x0A798, 0x0A798, UnicodeCategory_t::LU},
+        {0x0A799, 0x0A799, UnicodeCategory_t::LL}, {0x0A79A, 0x0A79A, UnicodeCategory_t::LU}, {0x0A79B, 0x0A79B, UnicodeCategory_t::LL},
+        {0x0A79C, 0x0A79C, UnicodeCategory_t::LU}, {0x0A79D, 0x0A79D, UnicodeCategory_t::LL}, {0x0A79E, 0x0A79E, UnicodeCategory_t::LU},
+        {0x0A79F, 0x0A79F, UnicodeCategory_t::LL}, {0x0A7A0, 0x0A7A0, UnicodeCategory_t::LU}, {0x0A7A1, 0x0A7A1, UnicodeCategory_t::LL},
+        {0x0A7A2, 0x0A7A2, UnicodeCategory_t::LU}, {0x0A7A3, 0x0A7A3, UnicodeCategory_t::LL}, {0x0A7A4, 0x0A7A4, UnicodeCategory_t::LU},
+        {0x0A7A5, 0x0A7A5, UnicodeCategory_t::LL}, {0x0A7A6, 0x0A7A6, UnicodeCategory_t::LU}, {0x0A7A7, 0x0A7A7, UnicodeCategory_t::LL},
+        {0x0A7A8, 0x0A7A8, UnicodeCategory_t::LU}, {0x0A7A9, 0x0A7A9, UnicodeCategory_t::LL}, {0x0A7AA, 0x0A7AE, UnicodeCategory_t::LU},
+        {0x0A7AF, 0x0A7AF, UnicodeCategory_t::LL}, {0x0A7B0, 0x0A7B4, UnicodeCategory_t::LU}, {0x0A7B5, 0x0A7B5, UnicodeCategory_t::LL},
+        {0x0A7B6, 0x0A7B6, UnicodeCategory_t::LU}, {0x0A7B7, 0x0A7B7, UnicodeCategory_t::LL}, {0x0A7B8, 0x0A7B8, UnicodeCategory_t::LU},
+        {0x0A7B9, 0x0A7B9, UnicodeCategory_t::LL}, {0x0A7BA, 0x0A7BA, UnicodeCategory_t::LU}, {0x0A7BB, 0x0A7BB, UnicodeCategory_t::LL},
+        {0x0A7BC, 0x0A7BC, UnicodeCategory_t::LU}, {0x0A7BD, 0x0A7BD, UnicodeCategory_t::LL}, {0x0A7BE, 0x0A7BE, UnicodeCategory_t::LU},
+        {0x0A7BF, 0x0A7BF, UnicodeCategory_t::LL}, {0x0A7C0, 0x0A7C0, UnicodeCategory_t::LU}, {0x0A7C1, 0x0A7C1, UnicodeCategory_t::LL},
+        {0x0A7C2, 0x0A7C2, UnicodeCategory_t::LU}, {0x0A7C3, 0x0A7C3, UnicodeCategory_t::LL}, {0x0A7C4, 0x0A7C7, UnicodeCategory_t::LU},
+        {0x0A7C8, 0x0A7C8, UnicodeCategory_t::LL}, {0x0A7C9, 0x0A7C9, UnicodeCategory_t::LU}, {0x0A7CA, 0x0A7CA, UnicodeCategory_t::LL},
+        {0x0A7D0, 0x0A7D0, UnicodeCategory_t::LU}, {0x0A7D1, 0x0A7D1, UnicodeCategory_t::LL}, {0x0A7D3, 0x0A7D3, UnicodeCategory_t::LL},
+        {0x0A7D5, 0x0A7D5, UnicodeCategory_t::LL}, {0x0A7D6, 0x0A7D6, UnicodeCategory_t::LU}, {0x0A7D7, 0x0A7D7, UnicodeCategory_t::LL},
+        {0x0A7D8, 0x0A7D8, UnicodeCategory_t::LU}, {0x0A7D9, 0x0A7D9, UnicodeCategory_t::LL}, {0x0A7F2, 0x0A7F4, UnicodeCategory_t::LM},
+        {0x0A7F5, 0x0A7F5, UnicodeCategory_t::LU}, {0x0A7F6, 0x0A7F6, UnicodeCategory_t::LL}, {0x0A7F7, 0x0A7F7, UnicodeCategory_t::LO},
+        {0x0A7F8, 0x0A7F9, UnicodeCategory_t::LM}, {0x0A7FA, 0x0A7FA, UnicodeCategory_t::LL}, {0x0A7FB, 0x0A801, UnicodeCategory_t::LO},
+        {0x0A802, 0x0A802, UnicodeCategory_t::MN}, {0x0A803, 0x0A805, UnicodeCategory_t::LO}, {0x0A806, 0x0A806, UnicodeCategory_t::MN},
+        {0x0A807, 0x0A80A, UnicodeCategory_t::LO}, {0x0A80B, 0x0A80B, UnicodeCategory_t::MN}, {0x0A80C, 0x0A822, UnicodeCategory_t::LO},
+        {0x0A823, 0x0A824, UnicodeCategory_t::MC}, {0x0A825, 0x0A826, UnicodeCategory_t::MN}, {0x0A827, 0x0A827, UnicodeCategory_t::MC},
+        {0x0A828, 0x0A82B, UnicodeCategory_t::SO}, {0x0A82C, 0x0A82C, UnicodeCategory_t::MN}, {0x0A830, 0x0A835, UnicodeCategory_t::NO},
+        {0x0A836, 0x0A837, UnicodeCategory_t::SO}, {0x0A838, 0x0A838, UnicodeCategory_t::SC}, {0x0A839, 0x0A839, UnicodeCategory_t::SO},
+        {0x0A840, 0x0A873, UnicodeCategory_t::LO}, {0x0A874, 0x0A877, UnicodeCategory_t::PO}, {0x0A880, 0x0A881, UnicodeCategory_t::MC},
+        {0x0A882, 0x0A8B3, UnicodeCategory_t::LO}, {0x0A8B4, 0x0A8C3, UnicodeCategory_t::MC}, {0x0A8C4, 0x0A8C5, UnicodeCategory_t::MN},
+        {0x0A8CE, 0x0A8CF, UnicodeCategory_t::PO}, {0x0A8D0, 0x0A8D9, UnicodeCategory_t::ND}, {0x0A8E0, 0x0A8F1, UnicodeCategory_t::MN},
+        {0x0A8F2, 0x0A8F7, UnicodeCategory_t::LO}, {0x0A8F8, 0x0A8FA, UnicodeCategory_t::PO}, {0x0A8FB, 0x0A8FB, UnicodeCategory_t::LO},
+        {0x0A8FC, 0x0A8FC, UnicodeCategory_t::PO}, {0x0A8FD, 0x0A8FE, UnicodeCategory_t::LO}, {0x0A8FF, 0x0A8FF, UnicodeCategory_t::MN},
+        {0x0A900, 0x0A909, UnicodeCategory_t::ND}, {0x0A90A, 0x0A925, UnicodeCategory_t::LO}, {0x0A926, 0x0A92D, UnicodeCategory_t::MN},
+        {0x0A92E, 0x0A92F, UnicodeCategory_t::PO}, {0x0A930, 0x0A946, UnicodeCategory_t::LO}, {0x0A947, 0x0A951, UnicodeCategory_t::MN},
+        {0x0A952, 0x0A953, UnicodeCategory_t::MC}, {0x0A95F, 0x0A95F, UnicodeCategory_t::PO}, {0x0A960, 0x0A97C, UnicodeCategory_t::LO},
+        {0x0A980, 0x0A982, UnicodeCategory_t::MN}, {0x0A983, 0x0A983, UnicodeCategory_t::MC}, {0x0A984, 0x0A9B2, UnicodeCategory_t::LO},
+        {0x0A9B3, 0x0A9B3, UnicodeCategory_t::MN}, {0x0A9B4, 0x0A9B5, UnicodeCategory_t::MC}, {0x0A9B6, 0x0A9B9, UnicodeCategory_t::MN},
+        {0x0A9BA, 0x0A9BB, UnicodeCategory_t::MC}, {0x0A9BC, 0x0A9BD, UnicodeCategory_t::MN}, {0x0A9BE, 0x0A9C0, UnicodeCategory_t::MC},
+        {0x0A9C1, 0x0A9CD, UnicodeCategory_t::PO}, {0x0A9CF, 0x0A9CF, UnicodeCategory_t::LM}, {0x0A9D0, 0x0A9D9, UnicodeCategory_t::ND},
+        {0x0A9DE, 0x0A9DF, UnicodeCategory_t::PO}, {0x0A9E0, 0x0A9E4, UnicodeCategory_t::LO}, {0x0A9E5, 0x0A9E5, UnicodeCategory_t::MN},
+        {0x0A9E6, 0x0A9E6, UnicodeCategory_t::LM}, {0x0A9E7, 0x0A9EF, UnicodeCategory_t::LO}, {0x0A9F0, 0x0A9F9, UnicodeCategory_t::ND},
+        {0x0A9FA, 0x0A9FE, UnicodeCategory_t::LO}, {0x0AA00, 0x0AA28, UnicodeCategory_t::LO}, {0x0AA29, 0x0AA2E, UnicodeCategory_t::MN},
+        {0x0AA2F, 0x0AA30, UnicodeCategory_t::MC}, {0x0AA31, 0x0AA32, UnicodeCategory_t::MN}, {0x0AA33, 0x0AA34, UnicodeCategory_t::MC},
+        {0x0AA35, 0x0AA36, UnicodeCategory_t::MN}, {0x0AA40, 0x0AA42, UnicodeCategory_t::LO}, {0x0AA43, 0x0AA43, UnicodeCategory_t::MN},
+        {0x0AA44, 0x0AA4B, UnicodeCategory_t::LO}, {0x0AA4C, 0x0AA4C, UnicodeCategory_t::MN}, {0x0AA4D, 0x0AA4D, UnicodeCategory_t::MC},
+        {0x0AA50, 0x0AA59, UnicodeCategory_t::ND}, {0x0AA5C, 0x0AA5F, UnicodeCategory_t::PO}, {0x0AA60, 0x0AA6F, UnicodeCategory_t::LO},
+        {0x0AA70, 0x0AA70, UnicodeCategory_t::LM}, {0x0AA71, 0x0AA76, UnicodeCategory_t::LO}, {0x0AA77, 0x0AA79, UnicodeCategory_t::SO},
+        {0x0AA7A, 0x0AA7A, UnicodeCategory_t::LO}, {0x0AA7B, 0x0AA7B, UnicodeCategory_t::MC}, {0x0AA7C, 0x0AA7C, UnicodeCategory_t::MN},
+        {0x0AA7D, 0x0AA7D, UnicodeCategory_t::MC}, {0x0AA7E, 0x0AAAF, UnicodeCategory_t::LO}, {0x0AAB0, 0x0AAB0, UnicodeCategory_t::MN},
+        {0x0AAB1, 0x0AAB1, UnicodeCategory_t::LO}, {0x0AAB2, 0x0AAB4, UnicodeCategory_t::MN}, {0x0AAB5, 0x0AAB6, UnicodeCategory_t::LO},
+        {0x0AAB7, 0x0AAB8, UnicodeCategory_t::MN}, {0x0AAB9, 0x0AABD, UnicodeCategory_t::LO}, {0x0AABE, 0x0AABF, UnicodeCategory_t::MN},
+        {0x0AAC0, 0x0AAC0, UnicodeCategory_t::LO}, {0x0AAC1, 0x0AAC1, UnicodeCategory_t::MN}, {0x0AAC2, 0x0AAC2, UnicodeCategory_t::LO},
+        {0x0AADB, 0x0AADC, UnicodeCategory_t::LO}, {0x0AADD, 0x0AADD, UnicodeCategory_t::LM}, {0x0AADE, 0x0AADF, UnicodeCategory_t::PO},
+        {0x0AAE0, 0x0AAEA, UnicodeCategory_t::LO}, {0x0AAEB, 0x0AAEB, UnicodeCategory_t::MC}, {0x0AAEC, 0x0AAED, UnicodeCategory_t::MN},
+        {0x0AAEE, 0x0AAEF, UnicodeCategory_t::MC}, {0x0AAF0, 0x0AAF1, UnicodeCategory_t::PO}, {0x0AAF2, 0x0AAF2, UnicodeCategory_t::LO},
+        {0x0AAF3, 0x0AAF4, UnicodeCategory_t::LM}, {0x0AAF5, 0x0AAF5, UnicodeCategory_t::MC}, {0x0AAF6, 0x0AAF6, UnicodeCategory_t::MN},
+        {0x0AB01, 0x0AB06, UnicodeCategory_t::LO}, {0x0AB09, 0x0AB0E, UnicodeCategory_t::LO}, {0x0AB11, 0x0AB16, UnicodeCategory_t::LO},
+        {0x0AB20, 0x0AB26, UnicodeCategory_t::LO}, {0x0AB28, 0x0AB2E, UnicodeCategory_t::LO}, {0x0AB30, 0x0AB5A, UnicodeCategory_t::LL},
+        {0x0AB5B, 0x0AB5B, UnicodeCategory_t::SK}, {0x0AB5C, 0x0AB5F, UnicodeCategory_t::LM}, {0x0AB60, 0x0AB68, UnicodeCategory_t::LL},
+        {0x0AB69, 0x0AB69, UnicodeCategory_t::LM}, {0x0AB6A, 0x0AB6B, UnicodeCategory_t::SK}, {0x0AB70, 0x0ABBF, UnicodeCategory_t::LL},
+        {0x0ABC0, 0x0ABE2, UnicodeCategory_t::LO}, {0x0ABE3, 0x0ABE4, UnicodeCategory_t::MC}, {0x0ABE5, 0x0ABE5, UnicodeCategory_t::MN},
+        {0x0ABE6, 0x0ABE7, UnicodeCategory_t::MC}, {0x0ABE8, 0x0ABE8, UnicodeCategory_t::MN}, {0x0ABE9, 0x0ABEA, UnicodeCategory_t::MC},
+        {0x0ABEB, 0x0ABEB, UnicodeCategory_t::PO}, {0x0ABEC, 0x0ABEC, UnicodeCategory_t::MC}, {0x0ABED, 0x0ABED, UnicodeCategory_t::MN},
+        {0x0ABF0, 0x0ABF9, UnicodeCategory_t::ND}, {0x0AC00, 0x0D7A3, UnicodeCategory_t::LO}, {0x0D7B0, 0x0D7C6, UnicodeCategory_t::LO},
+        {0x0D7CB, 0x0D7FB, UnicodeCategory_t::LO}, {0x0D800, 0x0DFFF, UnicodeCategory_t::CS}, {0x0E000, 0x0F8FF, UnicodeCategory_t::CO},
+        {0x0F900, 0x0FA6D, UnicodeCategory_t::LO}, {0x0FA70, 0x0FAD9, UnicodeCategory_t::LO}, {0x0FB00, 0x0FB06, UnicodeCategory_t::LL},
+        {0x0FB13, 0x0FB17, UnicodeCategory_t::LL}, {0x0FB1D, 0x0FB1D, UnicodeCategory_t::LO}, {0x0FB1E, 0x0FB1E, UnicodeCategory_t::MN},
+        {0x0FB1F, 0x0FB28, UnicodeCategory_t::LO}, {0x0FB29, 0x0FB29, UnicodeCategory_t::SM}, {0x0FB2A, 0x0FB36, UnicodeCategory_t::LO},
+        {0x0FB38, 0x0FB3C, UnicodeCategory_t::LO}, {0x0FB3E, 0x0FB3E, UnicodeCategory_t::LO}, {0x0FB40, 0x0FB41, UnicodeCategory_t::LO},
+        {0x0FB43, 0x0FB44, UnicodeCategory_t::LO}, {0x0FB46, 0x0FBB1, UnicodeCategory_t::LO}, {0x0FBB2, 0x0FBC2, UnicodeCategory_t::SK},
+        {0x0FBD3, 0x0FD3D, UnicodeCategory_t::LO}, {0x0FD3E, 0x0FD3E, UnicodeCategory_t::PE}, {0x0FD3F, 0x0FD3F, UnicodeCategory_t::PS},
+        {0x0FD40, 0x0FD4F, UnicodeCategory_t::SO}, {0x0FD50, 0x0FD8F, UnicodeCategory_t::LO}, {0x0FD92, 0x0FDC7, UnicodeCategory_t::LO},
+        {0x0FDCF, 0x0FDCF, UnicodeCategory_t::SO}, {0x0FDF0, 0x0FDFB, UnicodeCategory_t::LO}, {0x0FDFC, 0x0FDFC, UnicodeCategory_t::SC},
+        {0x0FDFD, 0x0FDFF, UnicodeCategory_t::SO}, {0x0FE00, 0x0FE0F, UnicodeCategory_t::MN}, {0x0FE10, 0x0FE16, UnicodeCategory_t::PO},
+        {0x0FE17, 0x0FE17, UnicodeCategory_t::PS}, {0x0FE18, 0x0FE18, UnicodeCategory_t::PE}, {0x0FE19, 0x0FE19, UnicodeCategory_t::PO},
+        {0x0FE20, 0x0FE2F, UnicodeCategory_t::MN}, {0x0FE30, 0x0FE30, UnicodeCategory_t::PO}, {0x0FE31, 0x0FE32, UnicodeCategory_t::PD},
+        {0x0FE33, 0x0FE34, UnicodeCategory_t::PC}, {0x0FE35, 0x0FE35, UnicodeCategory_t::PS}, {0x0FE36, 0x0FE36, UnicodeCategory_t::PE},
+        {0x0FE37, 0x0FE37, UnicodeCategory_t::PS}, {0x0FE38, 0x0FE38, UnicodeCategory_t::PE}, {0x0FE39, 0x0FE39, UnicodeCategory_t::PS},
+        {0x0FE3A, 0x0FE3A, UnicodeCategory_t::PE}, {0x0FE3B, 0x0FE3B, UnicodeCategory_t::PS}, {0x0FE3C, 0x0FE3C, UnicodeCategory_t::PE},
+        {0x0FE3D, 0x0FE3D, UnicodeCategory_t::PS}, {0x0FE3E, 0x0FE3E, UnicodeCategory_t::PE}, {0x0FE3F, 0x0FE3F, UnicodeCategory_t::PS},
+        {0x0FE40, 0x0FE40, UnicodeCategory_t::PE}, {0x0FE41, 0x0FE41, UnicodeCategory_t::PS}, {0x0FE42, 0x0FE42, UnicodeCategory_t::PE},
+        {0x0FE43, 0x0FE43, UnicodeCategory_t::PS}, {0x0FE44, 0x0FE44, UnicodeCategory_t::PE}, {0x0FE45, 0x0FE46, UnicodeCategory_t::PO},
+        {0x0FE47, 0x0FE47, UnicodeCategory_t::PS}, {0x0FE48, 0x0FE48, UnicodeCategory_t::PE}, {0x0FE49, 0x0FE4C, UnicodeCategory_t::PO},
+        {0x0FE4D, 0x0FE4F, UnicodeCategory_t::PC}, {0x0FE50, 0x0FE52, UnicodeCategory_t::PO}, {0x0FE54, 0x0FE57, UnicodeCategory_t::PO},
+        {0x0FE58, 0x0FE58, UnicodeCategory_t::PD}, {0x0FE59, 0x0FE59, UnicodeCategory_t::PS}, {0x0FE5A, 0x0FE5A, UnicodeCategory_t::PE},
+        {0x0FE5B, 0x0FE5B, UnicodeCategory_t::PS}, {0x0FE5C, 0x0FE5C, UnicodeCategory_t::PE}, {0x0FE5D, 0x0FE5D, UnicodeCategory_t::PS},
+        {0x0FE5E, 0x0FE5E, UnicodeCategory_t::PE}, {0x0FE5F, 0x0FE61, UnicodeCategory_t::PO}, {0x0FE62, 0x0FE62, UnicodeCategory_t::SM},
+        {0x0FE63, 0x0FE63, UnicodeCategory_t::PD}, {0x0FE64, 0x0FE66, UnicodeCategory_t::SM}, {0x0FE68, 0x0FE68, UnicodeCategory_t::PO},
+        {0x0FE69, 0x0FE69, UnicodeCategory_t::SC}, {0x0FE6A, 0x0FE6B, UnicodeCategory_t::PO}, {0x0FE70, 0x0FE74, UnicodeCategory_t::LO},
+        {0x0FE76, 0x0FEFC, UnicodeCategory_t::LO}, {0x0FEFF, 0x0FEFF, UnicodeCategory_t::CF}, {0x0FF01, 0x0FF03, UnicodeCategory_t::PO},
+        {0x0FF04, 0x0FF04, UnicodeCategory_t::SC}, {0x0FF05, 0x0FF07, UnicodeCategory_t::PO}, {0x0FF08, 0x0FF08, UnicodeCategory_t::PS},
+        {0x0FF09, 0x0FF09, UnicodeCategory_t::PE}, {0x0FF0A, 0x0FF0A, UnicodeCategory_t::PO}, {0x0FF0B, 0x0FF0B, UnicodeCategory_t::SM},
+        {0x0FF0C, 0x0FF0C, UnicodeCategory_t::PO}, {0x0FF0D, 0x0FF0D, UnicodeCategory_t::PD}, {0x0FF0E, 0x0FF0F, UnicodeCategory_t::PO},
+        {0x0FF10, 0x0FF19, UnicodeCategory_t::ND}, {0x0FF1A, 0x0FF1B, UnicodeCategory_t::PO}, {0x0FF1C, 0x0FF1E, UnicodeCategory_t::SM},
+        {0x0FF1F, 0x0FF20, UnicodeCategory_t::PO}, {0x0FF21, 0x0FF3A, UnicodeCategory_t::LU}, {0x0FF3B, 0x0FF3B, UnicodeCategory_t::PS},
+        {0x0FF3C, 0x0FF3C, UnicodeCategory_t::PO}, {0x0FF3D, 0x0FF3D, UnicodeCategory_t::PE}, {0x0FF3E, 0x0FF3E, UnicodeCategory_t::SK},
+        {0x0FF3F, 0x0FF3F, UnicodeCategory_t::PC}, {0x0FF40, 0x0FF40, UnicodeCategory_t::SK}, {0x0FF41, 0x0FF5A, UnicodeCategory_t::LL},
+        {0x0FF5B, 0x0FF5B, UnicodeCategory_t::PS}, {0x0FF5C, 0x0FF5C, UnicodeCategory_t::SM}, {0x0FF5D, 0x0FF5D, UnicodeCategory_t::PE},
+        {0x0FF5E, 0x0FF5E, UnicodeCategory_t::SM}, {0x0FF5F, 0x0FF5F, UnicodeCategory_t::PS}, {0x0FF60, 0x0FF60, UnicodeCategory_t::PE},
+        {0x0FF61, 0x0FF61, UnicodeCategory_t::PO}, {0x0FF62, 0x0FF62, UnicodeCategory_t::PS}, {0x0FF63, 0x0FF63, UnicodeCategory_t::PE},
+        {0x0FF64, 0x0FF65, UnicodeCategory_t::PO}, {0x0FF66, 0x0FF6F, UnicodeCategory_t::LO}, {0x0FF70, 0x0FF70, UnicodeCategory_t::LM},
+        {0x0FF71, 0x0FF9D, UnicodeCategory_t::LO}, {0x0FF9E, 0x0FF9F, UnicodeCategory_t::LM}, {0x0FFA0, 0x0FFBE, UnicodeCategory_t::LO},
+        {0x0FFC2, 0x0FFC7, UnicodeCategory_t::LO}, {0x0FFCA, 0x0FFCF, UnicodeCategory_t::LO}, {0x0FFD2, 0x0FFD7, UnicodeCategory_t::LO},
+        {0x0FFDA, 0x0FFDC, UnicodeCategory_t::LO}, {0x0FFE0, 0x0FFE1, UnicodeCategory_t::SC}, {0x0FFE2, 0x0FFE2, UnicodeCategory_t::SM},
+        {0x0FFE3, 0x0FFE3, UnicodeCategory_t::SK}, {0x0FFE4, 0x0FFE4, UnicodeCategory_t::SO}, {0x0FFE5, 0x0FFE6, UnicodeCategory_t::SC},
+        {0x0FFE8, 0x0FFE8, UnicodeCategory_t::SO}, {0x0FFE9, 0x0FFEC, UnicodeCategory_t::SM}, {0x0FFED, 0x0FFEE, UnicodeCategory_t::SO},
+        {0x0FFF9, 0x0FFFB, UnicodeCategory_t::CF}, {0x0FFFC, 0x0FFFD, UnicodeCategory_t::SO}, {0x10000, 0x1000B, UnicodeCategory_t::LO},
+        {0x1000D, 0x10026, UnicodeCategory_t::LO}, {0x10028, 0x1003A, UnicodeCategory_t::LO}, {0x1003C, 0x1003D, UnicodeCategory_t::LO},
+        {0x1003F, 0x1004D, UnicodeCategory_t::LO}, {0x10050, 0x1005D, UnicodeCategory_t::LO}, {0x10080, 0x100FA, UnicodeCategory_t::LO},
+        {0x10100, 0x10102, UnicodeCategory_t::PO}, {0x10107, 0x10133, UnicodeCategory_t::NO}, {0x10137, 0x1013F, UnicodeCategory_t::SO},
+        {0x10140, 0x10174, UnicodeCategory_t::NL}, {0x10175, 0x10178, UnicodeCategory_t::NO}, {0x10179, 0x10189, UnicodeCategory_t::SO},
+        {0x1018A, 0x1018B, UnicodeCategory_t::NO}, {0x1018C, 0x1018E, UnicodeCategory_t::SO}, {0x10190, 0x1019C, UnicodeCategory_t::SO},
+        {0x101A0, 0x101A0, UnicodeCategory_t::SO}, {0x101D0, 0x101FC, UnicodeCategory_t::SO}, {0x101FD, 0x101FD, UnicodeCategory_t::MN},
+        {0x10280, 0x1029C, UnicodeCategory_t::LO}, {0x102A0, 0x102D0, UnicodeCategory_t::LO}, {0x102E0, 0x102E0, UnicodeCategory_t::MN},
+        {0x102E1, 0x102FB, UnicodeCategory_t::NO}, {0x10300, 0x1031F, UnicodeCategory_t::LO}, {0x10320, 0x10323, UnicodeCategory_t::NO},
+        {0x1032D, 0x10340, UnicodeCategory_t::LO}, {0x10341, 0x10341, UnicodeCategory_t::NL}, {0x10342, 0x10349, UnicodeCategory_t::LO},
+        {0x1034A, 0x1034A, UnicodeCategory_t::NL}, {0x10350, 0x10375, UnicodeCategory_t::LO}, {0x10376, 0x1037A, UnicodeCategory_t::MN},
+        {0x10380, 0x1039D, UnicodeCategory_t::LO}, {0x1039F, 0x1039F, UnicodeCategory_t::PO}, {0x103A0, 0x103C3, UnicodeCategory_t::LO},
+        {0x103C8, 0x103CF, UnicodeCategory_t::LO}, {0x103D0, 0x103D0, UnicodeCategory_t::PO}, {0x103D1, 0x103D5, UnicodeCategory_t::NL},
+        {0x10400, 0x10427, UnicodeCategory_t::LU}, {0x10428, 0x1044F, UnicodeCategory_t::LL}, {0x10450, 0x1049D, UnicodeCategory_t::LO},
+        {0x104A0, 0x104A9, UnicodeCategory_t::ND}, {0x104B0, 0x104D3, UnicodeCategory_t::LU}, {0x104D8, 0x104FB, UnicodeCategory_t::LL},
+        {0x10500, 0x10527, UnicodeCategory_t::LO}, {0x10530, 0x10563, UnicodeCategory_t::LO}, {0x1056F, 0x1056F, UnicodeCategory_t::PO},
+        {0x10570, 0x1057A, UnicodeCategory_t::LU}, {0x1057C, 0x1058A, UnicodeCategory_t::LU}, {0x1058C, 0x10592, UnicodeCategory_t::LU},
+        {0x10594, 0x10595, UnicodeCategory_t::LU}, {0x10597, 0x105A1, UnicodeCategory_t::LL}, {0x105A3, 0x105B1, UnicodeCategory_t::LL},
+        {0x105B3, 0x105B9, UnicodeCategory_t::LL}, {0x105BB, 0x105BC, UnicodeCategory_t::LL}, {0x10600, 0x10736, UnicodeCategory_t::LO},
+        {0x10740, 0x10755, UnicodeCategory_t::LO}, {0x10760, 0x10767, UnicodeCategory_t::LO}, {0x10780, 0x10785, UnicodeCategory_t::LM},
+        {0x10787, 0x107B0, UnicodeCategory_t::LM}, {0x107B2, 0x107BA, UnicodeCategory_t::LM}, {0x10800, 0x10805, UnicodeCategory_t::LO},
+        {0x10808, 0x10808, UnicodeCategory_t::LO}, {0x1080A, 0x10835, UnicodeCategory_t::LO}, {0x10837, 0x10838, UnicodeCategory_t::LO},
+        {0x1083C, 0x1083C, UnicodeCategory_t::LO}, {0x1083F, 0x10855, UnicodeCategory_t::LO}, {0x10857, 0x10857, UnicodeCategory_t::PO},
+        {0x10858, 0x1085F, UnicodeCategory_t::NO}, {0x10860, 0x10876, UnicodeCategory_t::LO}, {0x10877, 0x10878, UnicodeCategory_t::SO},
+        {0x10879, 0x1087F, UnicodeCategory_t::NO}, {0x10880, 0x1089E, UnicodeCategory_t::LO}, {0x108A7, 0x108AF, UnicodeCategory_t::NO},
+        {0x108E0, 0x108F2, UnicodeCategory_t::LO}, {0x108F4, 0x108F5, UnicodeCategory_t::LO}, {0x108FB, 0x108FF, UnicodeCategory_t::NO},
+        {0x10900, 0x10915, UnicodeCategory_t::LO}, {0x10916, 0x1091B, UnicodeCategory_t::NO}, {0x1091F, 0x1091F, UnicodeCategory_t::PO},
+        {0x10920, 0x10939, UnicodeCategory_t::LO}, {0x1093F, 0x1093F, UnicodeCategory_t::PO}, {0x10980, 0x109B7, UnicodeCategory_t::LO},
+        {0x109BC, 0x109BD, UnicodeCategory_t::NO}, {0x109BE, 0x109BF, UnicodeCategory_t::LO}, {0x109C0, 0x109CF, UnicodeCategory_t::NO},
+        {0x109D2, 0x109FF, UnicodeCategory_t::NO}, {0x10A00, 0x10A00, UnicodeCategory_t::LO}, {0x10A01, 0x10A03, UnicodeCategory_t::MN},
+        {0x10A05, 0x10A06, UnicodeCategory_t::MN}, {0x10A0C, 0x10A0F, UnicodeCategory_t::MN}, {0x10A10, 0x10A13, UnicodeCategory_t::LO},
+        {0x10A15, 0x10A17, UnicodeCategory_t::LO}, {0x10A19, 0x10A35, UnicodeCategory_t::LO}, {0x10A38, 0x10A3A, UnicodeCategory_t::MN},
+        {0x10A3F, 0x10A3F, UnicodeCategory_t::MN}, {0x10A40, 0x10A48, UnicodeCategory_t::NO}, {0x10A50, 0x10A58, UnicodeCategory_t::PO},
+        {0x10A60, 0x10A7C, UnicodeCategory_t::LO}, {0x10A7D, 0x10A7E, UnicodeCategory_t::NO}, {0x10A7F, 0x10A7F, UnicodeCategory_t::PO},
+        {0x10A80, 0x10A9C, UnicodeCategory_t::LO}, {0x10A9D, 0x10A9F, UnicodeCategory_t::NO}, {0x10AC0, 0x10AC7, UnicodeCategory_t::LO},
+        {0x10AC8, 0x10AC8, UnicodeCategory_t::SO}, {0x10AC9, 0x10AE4, UnicodeCategory_t::LO}, {0x10AE5, 0x10AE6, UnicodeCategory_t::MN},
+        {0x10AEB, 0x10AEF, UnicodeCategory_t::NO}, {0x10AF0, 0x10AF6, UnicodeCategory_t::PO}, {0x10B00, 0x10B35, UnicodeCategory_t::LO},
+        {0x10B39, 0x10B3F, UnicodeCategory_t::PO}, {0x10B40, 0x10B55, UnicodeCategory_t::LO}, {0x10B58, 0x10B5F, UnicodeCategory_t::NO},
+        {0x10B60, 0x10B72, UnicodeCategory_t::LO}, {0x10B78, 0x10B7F, UnicodeCategory_t::NO}, {0x10B80, 0x10B91, UnicodeCategory_t::LO},
+        {0x10B99, 0x10B9C, UnicodeCategory_t::PO}, {0x10BA9, 0x10BAF, UnicodeCategory_t::NO}, {0x10C00, 0x10C48, UnicodeCategory_t::LO},
+        {0x10C80, 0x10CB2, UnicodeCategory_t::LU}, {0x10CC0, 0x10CF2, UnicodeCategory_t::LL}, {0x10CFA, 0x10CFF, UnicodeCategory_t::NO},
+        {0x10D00, 0x10D23, UnicodeCategory_t::LO}, {0x10D24, 0x10D27, UnicodeCategory_t::MN}, {0x10D30, 0x10D39, UnicodeCategory_t::ND},
+        {0x10E60, 0x10E7E, UnicodeCategory_t::NO}, {0x10E80, 0x10EA9, UnicodeCategory_t::LO}, {0x10EAB, 0x10EAC, UnicodeCategory_t::MN},
+        {0x10EAD, 0x10EAD, UnicodeCategory_t::PD}, {0x10EB0, 0x10EB1, UnicodeCategory_t::LO}, {0x10F00, 0x10F1C, UnicodeCategory_t::LO},
+        {0x10F1D, 0x10F26, UnicodeCategory_t::NO}, {0x10F27, 0x10F27, UnicodeCategory_t::LO}, {0x10F30, 0x10F45, UnicodeCategory_t::LO},
+        {0x10F46, 0x10F50, UnicodeCategory_t::MN}, {0x10F51, 0x10F54, UnicodeCategory_t::NO}, {0x10F55, 0x10F59, UnicodeCategory_t::PO},
+        {0x10F70, 0x10F81, UnicodeCategory_t::LO}, {0x10F82, 0x10F85, UnicodeCategory_t::MN}, {0x10F86, 0x10F89, UnicodeCategory_t::PO},
+        {0x10FB0, 0x10FC4, UnicodeCategory_t::LO}, {0x10FC5, 0x10FCB, UnicodeCategory_t::NO}, {0x10FE0, 0x10FF6, UnicodeCategory_t::LO},
+        {0x11000, 0x11000, UnicodeCategory_t::MC}, {0x11001, 0x11001, UnicodeCategory_t::MN}, {0x11002, 0x11002, UnicodeCategory_t::MC},
+        {0x11003, 0x11037, UnicodeCategory_t::LO}, {0x11038, 0x11046, UnicodeCategory_t::MN}, {0x11047, 0x1104D, UnicodeCategory_t::PO},
+        {0x11052, 0x11065, UnicodeCategory_t::NO}, {0x11066, 0x1106F, UnicodeCategory_t::ND}, {0x11070, 0x11070, UnicodeCategory_t::MN},
+        {0x11071, 0x11072, UnicodeCategory_t::LO}, {0x11073, 0x11074, UnicodeCategory_t::MN}, {0x11075, 0x11075, UnicodeCategory_t::LO},
+        {0x1107F, 0x11081, UnicodeCategory_t::MN}, {0x11082, 0x11082, UnicodeCategory_t::MC}, {0x11083, 0x110AF, UnicodeCategory_t::LO},
+        {0x110B0, 0x110B2, UnicodeCategory_t::MC}, {0x110B3, 0x110B6, UnicodeCategory_t::MN}, {0x110B7, 0x110B8, UnicodeCategory_t::MC},
+        {0x110B9, 0x110BA, UnicodeCategory_t::MN}, {0x110BB, 0x110BC, UnicodeCategory_t::PO}, {0x110BD, 0x110BD, UnicodeCategory_t::CF},
+        {0x110BE, 0x110C1, UnicodeCategory_t::PO}, {0x110C2, 0x110C2, UnicodeCategory_t::MN}, {0x110CD, 0x110CD, UnicodeCategory_t::CF},
+        {0x110D0, 0x110E8, UnicodeCategory_t::LO}, {0x110F0, 0x110F9, UnicodeCategory_t::ND}, {0x11100, 0x11102, UnicodeCategory_t::MN},
+        {0x11103, 0x11126, UnicodeCategory_t::LO}, {0x11127, 0x1112B, UnicodeCategory_t::MN}, {0x1112C, 0x1112C, UnicodeCategory_t::MC},
+        {0x1112D, 0x11134, UnicodeCategory_t::MN}, {0x11136, 0x1113F, UnicodeCategory_t::ND}, {0x11140, 0x11143, UnicodeCategory_t::PO},
+        {0x11144, 0x11144, UnicodeCategory_t::LO}, {0x11145, 0x11146, UnicodeCategory_t::MC}, {0x11147, 0x11147, UnicodeCategory_t::LO},
+        {0x11150, 0x11172, UnicodeCategory_t::LO}, {0x11173, 0x11173, UnicodeCategory_t::MN}, {0x11174, 0x11175, UnicodeCategory_t::PO},
+        {0x11176, 0x11176, UnicodeCategory_t::LO}, {0x11180, 0x11181, UnicodeCategory_t::MN}, {0x11182, 0x11182, UnicodeCategory_t::MC},
+        {0x11183, 0x111B2, UnicodeCategory_t::LO}, {0x111B3, 0x111B5, UnicodeCategory_t::MC}, {0x111B6, 0x111BE, UnicodeCategory_t::MN},
+        {0x111BF, 0x111C0, UnicodeCategory_t::MC}, {0x111C1, 0x111C4, UnicodeCategory_t::LO}, {0x111C5, 0x111C8, UnicodeCategory_t::PO},
+        {0x111C9, 0x111CC, UnicodeCategory_t::MN}, {0x111CD, 0x111CD, UnicodeCategory_t::PO}, {0x111CE, 0x111CE, UnicodeCategory_t::MC},
+        {0x111CF, 0x111CF, UnicodeCategory_t::MN}, {0x111D0, 0x111D9, UnicodeCategory_t::ND}, {0x111DA, 0x111DA, UnicodeCategory_t::LO},
+        {0x111DB, 0x111DB, UnicodeCategory_t::PO}, {0x111DC, 0x111DC, UnicodeCategory_t::LO}, {0x111DD, 0x111DF, UnicodeCategory_t::PO},
+        {0x111E1, 0x111F4, UnicodeCategory_t::NO}, {0x11200, 0x11211, UnicodeCategory_t::LO}, {0x11213, 0x1122B, UnicodeCategory_t::LO},
+        {0x1122C, 0x1122E, UnicodeCategory_t::MC}, {0x1122F, 0x11231, UnicodeCategory_t::MN}, {0x11232, 0x11233, UnicodeCategory_t::MC},
+        {0x11234, 0x11234, UnicodeCategory_t::MN}, {0x11235, 0x11235, UnicodeCategory_t::MC}, {0x11236, 0x11237, UnicodeCategory_t::MN},
+        {0x11238, 0x1123D, UnicodeCategory_t::PO}, {0x1123E, 0x1123E, UnicodeCategory_t::MN}, {0x11280, 0x11286, UnicodeCategory_t::LO},
+        {0x11288, 0x11288, UnicodeCategory_t::LO}, {0x1128A, 0x1128D, UnicodeCategory_t::LO}, {0x1128F, 0x1129D, UnicodeCategory_t::LO},
+        {0x1129F, 0x112A8, UnicodeCategory_t::LO}, {0x112A9, 0x112A9, UnicodeCategory_t::PO}, {0x112B0, 0x112DE, UnicodeCategory_t::LO},
+        {0x112DF, 0x112DF, UnicodeCategory_t::MN}, {0x112E0, 0x112E2, UnicodeCategory_t::MC}, {0x112E3, 0x112EA, UnicodeCategory_t::MN},
+        {0x112F0, 0x112F9, UnicodeCategory_t::ND}, {0x11300, 0x11301, UnicodeCategory_t::MN}, {0x11302, 0x11303, UnicodeCategory_t::MC},
+        {0x11305, 0x1130C, UnicodeCategory_t::LO}, {0x1130F, 0x11310, UnicodeCategory_t::LO}, {0x11313, 0x11328, UnicodeCategory_t::LO},
+        {0x1132A, 0x11330, UnicodeCategory_t::LO}, {0x11332, 0x11333, UnicodeCategory_t::LO}, {0x11335, 0x11339, UnicodeCategory_t::LO},
+        {0x1133B, 0x1133C, UnicodeCategory_t::MN}, {0x1133D, 0x1133D, UnicodeCategory_t::LO}, {0x1133E, 0x1133F, UnicodeCategory_t::MC},
+        {0x11340, 0x11340, UnicodeCategory_t::MN}, {0x11341, 0x11344, UnicodeCategory_t::MC}, {0x11347, 0x11348, UnicodeCategory_t::MC},
+        {0x1134B, 0x1134D, UnicodeCategory_t::MC}, {0x11350, 0x11350, UnicodeCategory_t::LO}, {0x11357, 0x11357, UnicodeCategory_t::MC},
+        {0x1135D, 0x11361, UnicodeCategory_t::LO}, {0x11362, 0x11363, UnicodeCategory_t::MC}, {0x11366, 0x1136C, UnicodeCategory_t::MN},
+        {0x11370, 0x11374, UnicodeCategory_t::MN}, {0x11400, 0x11434, UnicodeCategory_t::LO}, {0x11435, 0x11437, UnicodeCategory_t::MC},
+        {0x11438, 0x1143F, UnicodeCategory_t::MN}, {0x11440, 0x11441, UnicodeCategory_t::MC}, {0x11442, 0x11444, UnicodeCategory_t::MN},
+        {0x11445, 0x11445, UnicodeCategory_t::MC}, {0x11446, 0x11446, UnicodeCategory_t::MN}, {0x11447, 0x1144A, UnicodeCategory_t::LO},
+        {0x1144B, 0x1144F, UnicodeCategory_t::PO}, {0x11450, 0x11459, UnicodeCategory_t::ND}, {0x1145A, 0x1145B, UnicodeCategory_t::PO},
+        {0x1145D, 0x1145D, UnicodeCategory_t::PO}, {0x1145E, 0x1145E, UnicodeCategory_t::MN}, {0x1145F, 0x11461, UnicodeCategory_t::LO},
+        {0x11480, 0x114AF, UnicodeCategory_t::LO}, {0x114B0, 0x114B2, UnicodeCategory_t::MC}, {0x114B3, 0x114B8, UnicodeCategory_t::MN},
+        {0x114B9, 0x114B9, UnicodeCategory_t::MC}, {0x114BA, 0x114BA, UnicodeCategory_t::MN}, {0x114BB, 0x114BE, UnicodeCategory_t::MC},
+        {0x114BF, 0x114C0, UnicodeCategory_t::MN}, {0x114C1, 0x114C1, UnicodeCategory_t::MC}, {0x114C2, 0x114C3, UnicodeCategory_t::MN},
+        {0x114C4, 0x114C5, UnicodeCategory_t::LO}, {0x114C6, 0x114C6, UnicodeCategory_t::PO}, {0x114C7, 0x114C7, UnicodeCategory_t::LO},
+        {0x114D0, 0x114D9, UnicodeCategory_t::ND}, {0x11580, 0x115AE, UnicodeCategory_t::LO}, {0x115AF, 0x115B1, UnicodeCategory_t::MC},
+        {0x115B2, 0x115B5, UnicodeCategory_t::MN}, {0x115B8, 0x115BB, UnicodeCategory_t::MC}, {0x115BC, 0x115BD, UnicodeCategory_t::MN},
+        {0x115BE, 0x115BE, UnicodeCategory_t::MC}, {0x115BF, 0x115C0, UnicodeCategory_t::MN}, {0x115C1, 0x115D7, UnicodeCategory_t::PO},
+        {0x115D8, 0x115DB, UnicodeCategory_t::LO}, {0x115DC, 0x115DD, UnicodeCategory_t::MN}, {0x11600, 0x1162F, UnicodeCategory_t::LO},
+        {0x11630, 0x11632, UnicodeCategory_t::MC}, {0x11633, 0x1163A, UnicodeCategory_t::MN}, {0x1163B, 0x1163C, UnicodeCategory_t::MC},
+        {0x1163D, 0x1163D, UnicodeCategory_t::MN}, {0x1163E, 0x1163E, UnicodeCategory_t::MC}, {0x1163F, 0x11640, UnicodeCategory_t::MN},
+        {0x11641, 0x11643, UnicodeCategory_t::PO}, {0x11644, 0x11644, UnicodeCategory_t::LO}, {0x11650, 0x11659, UnicodeCategory_t::ND},
+        {0x11660, 0x1166C, UnicodeCategory_t::PO}, {0x11680, 0x116AA, UnicodeCategory_t::LO}, {0x116AB, 0x116AB, UnicodeCategory_t::MN},
+        {0x116AC, 0x116AC, UnicodeCategory_t::MC}, {0x116AD, 0x116AD, UnicodeCategory_t::MN}, {0x116AE, 0x116AF, UnicodeCategory_t::MC},
+        {0x116B0, 0x116B5, UnicodeCategory_t::MN}, {0x116B6, 0x116B6, UnicodeCategory_t::MC}, {0x116B7, 0x116B7, UnicodeCategory_t::MN},
+        {0x116B8, 0x116B8, UnicodeCategory_t::LO}, {0x116B9, 0x116B9, UnicodeCategory_t::PO}, {0x116C0, 0x116C9, UnicodeCategory_t::ND},
+        {0x11700, 0x1171A, UnicodeCategory_t::LO}, {0x1171D, 0x1171F, UnicodeCategory_t::MN}, {0x11720, 0x11721, UnicodeCategory_t::MC},
+        {0x11722, 0x11725, UnicodeCategory_t::MN}, {0x11726, 0x11726, UnicodeCategory_t::MC}, {0x11727, 0x1172B, UnicodeCategory_t::MN},
+        {0x11730, 0x11739, UnicodeCategory_t::ND}, {0x1173A, 0x1173B, UnicodeCategory_t::NO}, {0x1173C, 0x1173E, UnicodeCategory_t::PO},
+        {0x1173F, 0x1173F, UnicodeCategory_t::SO}, {0x11740, 0x11746, UnicodeCategory_t::LO}, {0x11800, 0x1182B, UnicodeCategory_t::LO},
+        {0x1182C, 0x1182E, UnicodeCategory_t::MC}, {0x1182F, 0x11837, UnicodeCategory_t::MN}, {0x11838, 0x11838, UnicodeCategory_t::MC},
+        {0x11839, 0x1183A, UnicodeCategory_t::MN}, {0x1183B, 0x1183B, UnicodeCategory_t::PO}, {0x118A0, 0x118BF, UnicodeCategory_t::LU},
+        {0x118C0, 0x118DF, UnicodeCategory_t::LL}, {0x118E0, 0x118E9, UnicodeCategory_t::ND}, {0x118EA, 0x118F2, UnicodeCategory_t::NO},
+        {0x118FF, 0x11906, UnicodeCategory_t::LO}, {0x11909, 0x11909, UnicodeCategory_t::LO}, {0x1190C, 0x11913, UnicodeCategory_t::LO},
+        {0x11915, 0x11916, UnicodeCategory_t::LO}, {0x11918, 0x1192F, UnicodeCategory_t::LO}, {0x11930, 0x11935, UnicodeCategory_t::MC},
+        {0x11937, 0x11938, UnicodeCategory_t::MC}, {0x1193B, 0x1193C, UnicodeCategory_t::MN}, {0x1193D, 0x1193D, UnicodeCategory_t::MC},
+        {0x1193E, 0x1193E, UnicodeCategory_t::MN}, {0x1193F, 0x1193F, UnicodeCategory_t::LO}, {0x11940, 0x11940, UnicodeCategory_t::MC},
+        {0x11941, 0x11941, UnicodeCategory_t::LO}, {0x11942, 0x11942, UnicodeCategory_t::MC}, {0x11943, 0x11943, UnicodeCategory_t::MN},
+        {0x11944, 0x11946, UnicodeCategory_t::PO}, {0x11950, 0x11959, UnicodeCategory_t::ND}, {0x119A0, 0x119A7, UnicodeCategory_t::LO},
+        {0x119AA, 0x119D0, UnicodeCategory_t::LO}, {0x119D1, 0x119D3, UnicodeCategory_t::MC}, {0x119D4, 0x119D7, UnicodeCategory_t::MN},
+        {0x119DA, 0x119DB, UnicodeCategory_t::MN}, {0x119DC, 0x119DF, UnicodeCategory_t::MC}, {0x119E0, 0x119E0, UnicodeCategory_t::MN},
+        {0x119E1, 0x119E1, UnicodeCategory_t::LO}, {0x119E2, 0x119E2, UnicodeCategory_t::PO}, {0x119E3, 0x119E3, UnicodeCategory_t::LO},
+        {0x119E4, 0x119E4, UnicodeCategory_t::MC}, {0x11A00, 0x11A00, UnicodeCategory_t::LO}, {0x11A01, 0x11A0A, UnicodeCategory_t::MN},
+        {0x11A0B, 0x11A32, UnicodeCategory_t::LO}, {0x11A33, 0x11A38, UnicodeCategory_t::MN}, {0x11A39, 0x11A39, UnicodeCategory_t::MC},
+        {0x11A3A, 0x11A3A, UnicodeCategory_t::LO}, {0x11A3B, 0x11A3E, UnicodeCategory_t::MN}, {0x11A3F, 0x11A46, UnicodeCategory_t::PO},
+        {0x11A47, 0x11A47, UnicodeCategory_t::MN}, {0x11A50, 0x11A50, UnicodeCategory_t::LO}, {0x11A51, 0x11A56, UnicodeCategory_t::MN},
+        {0x11A57, 0x11A58, UnicodeCategory_t::MC}, {0x11A59, 0x11A5B, UnicodeCategory_t::MN}, {0x11A5C, 0x11A89, UnicodeCategory_t::LO},
+        {0x11A8A, 0x11A96, UnicodeCategory_t::MN}, {0x11A97, 0x11A97, UnicodeCategory_t::MC}, {0x11A98, 0x11A99, UnicodeCategory_t::MN},
+        {0x11A9A, 0x11A9C, UnicodeCategory_t::PO}, {0x11A9D, 0x11A9D, UnicodeCategory_t::LO}, {0x11A9E, 0x11AA2, UnicodeCategory_t::PO},
+        {0x11AB0, 0x11AF8, UnicodeCategory_t::LO}, {0x11C00, 0x11C08, UnicodeCategory_t::LO}, {0x11C0A, 0x11C2E, UnicodeCategory_t::LO},
+        {0x11C2F, 0x11C2F, UnicodeCategory_t::MC}, {0x11C30, 0x11C36, UnicodeCategory_t::MN}, {0x11C38, 0x11C3D, UnicodeCategory_t::MN},
+        {0x11C3E, 0x11C3E, UnicodeCategory_t::MC}, {0x11C3F, 0x11C3F, UnicodeCategory_t::MN}, {0x11C40, 0x11C40, UnicodeCategory_t::LO},
+        {0x11C41, 0x11C45, UnicodeCategory_t::PO}, {0x11C50, 0x11C59, UnicodeCategory_t::ND}, {0x11C5A, 0x11C6C, UnicodeCategory_t::NO},
+        {0x11C70, 0x11C71, UnicodeCategory_t::PO}, {0x11C72, 0x11C8F, UnicodeCategory_t::LO}, {0x11C92, 0x11CA7, UnicodeCategory_t::MN},
+        {0x11CA9, 0x11CA9, UnicodeCategory_t::MC}, {0x11CAA, 0x11CB0, UnicodeCategory_t::MN}, {0x11CB1, 0x11CB1, UnicodeCategory_t::MC},
+        {0x11CB2, 0x11CB3, UnicodeCategory_t::MN}, {0x11CB4, 0x11CB4, UnicodeCategory_t::MC}, {0x11CB5, 0x11CB6, UnicodeCategory_t::MN},
+        {0x11D00, 0x11D06, UnicodeCategory_t::LO}, {0x11D08, 0x11D09, UnicodeCategory_t::LO}, {0x11D0B, 0x11D30, UnicodeCategory_t::LO},
+        {0x11D31, 0x11D36, UnicodeCategory_t::MN}, {0x11D3A, 0x11D3A, UnicodeCategory_t::MN}, {0x11D3C, 0x11D3D, UnicodeCategory_t::MN},
+        {0x11D3F, 0x11D45, UnicodeCategory_t::MN}, {0x11D46, 0x11D46, UnicodeCategory_t::LO}, {0x11D47, 0x11D47, UnicodeCategory_t::MN},
+        {0x11D50, 0x11D59, UnicodeCategory_t::ND}, {0x11D60, 0x11D65, UnicodeCategory_t::LO}, {0x11D67, 0x11D68, UnicodeCategory_t::LO},
+        {0x11D6A, 0x11D89, UnicodeCategory_t::LO}, {0x11D8A, 0x11D8E, UnicodeCategory_t::MC}, {0x11D90, 0x11D91, UnicodeCategory_t::MN},
+        {0x11D93, 0x11D94, UnicodeCategory_t::MC}, {0x11D95, 0x11D95, UnicodeCategory_t::MN}, {0x11D96, 0x11D96, UnicodeCategory_t::MC},
+        {0x11D97, 0x11D97, UnicodeCategory_t::MN}, {0x11D98, 0x11D98, UnicodeCategory_t::LO}, {0x11DA0, 0x11DA9, UnicodeCategory_t::ND},
+        {0x11EE0, 0x11EF2, UnicodeCategory_t::LO}, {0x11EF3, 0x11EF4, UnicodeCategory_t::MN}, {0x11EF5, 0x11EF6, UnicodeCategory_t::MC},
+        {0x11EF7, 0x11EF8, UnicodeCategory_t::PO}, {0x11FB0, 0x11FB0, UnicodeCategory_t::LO}, {0x11FC0, 0x11FD4, UnicodeCategory_t::NO},
+        {0x11FD5, 0x11FDC, UnicodeCategory_t::SO}, {0x11FDD, 0x11FE0, UnicodeCategory_t::SC}, {0x11FE1, 0x11FF1, UnicodeCategory_t::SO},
+        {0x11FFF, 0x11FFF, UnicodeCategory_t::PO}, {0x12000, 0x12399, UnicodeCategory_t::LO}, {0x12400, 0x1246E, UnicodeCategory_t::NL},
+        {0x12470, 0x12474, UnicodeCategory_t::PO}, {0x12480, 0x12543, UnicodeCategory_t::LO}, {0x12F90, 0x12FF0, UnicodeCategory_t::LO},
+        {0x12FF1, 0x12FF2, UnicodeCategory_t::PO}, {0x13000, 0x1342E, UnicodeCategory_t::LO}, {0x13430, 0x13438, UnicodeCategory_t::CF},
+        {0x14400, 0x14646, UnicodeCategory_t::LO}, {0x16800, 0x16A38, UnicodeCategory_t::LO}, {0x16A40, 0x16A5E, UnicodeCategory_t::LO},
+        {0x16A60, 0x16A69, UnicodeCategory_t::ND}, {0x16A6E, 0x16A6F, UnicodeCategory_t::PO}, {0x16A70, 0x16ABE, UnicodeCategory_t::LO},
+        {0x16AC0, 0x16AC9, UnicodeCategory_t::ND}, {0x16AD0, 0x16AED, UnicodeCategory_t::LO}, {0x16AF0, 0x16AF4, UnicodeCategory_t::MN},
+        {0x16AF5, 0x16AF5, UnicodeCategory_t::PO}, {0x16B00, 0x16B2F, UnicodeCategory_t::LO}, {0x16B30, 0x16B36, UnicodeCategory_t::MN},
+        {0x16B37, 0x16B3B, UnicodeCategory_t::PO}, {0x16B3C, 0x16B3F, UnicodeCategory_t::SO}, {0x16B40, 0x16B43, UnicodeCategory_t::LM},
+        {0x16B44, 0x16B44, UnicodeCategory_t::PO}, {0x16B45, 0x16B45, UnicodeCategory_t::SO}, {0x16B50, 0x16B59, UnicodeCategory_t::ND},
+        {0x16B5B, 0x16B61, UnicodeCategory_t::NO}, {0x16B63, 0x16B77, UnicodeCategory_t::LO}, {0x16B7D, 0x16B8F, UnicodeCategory_t::LO},
+        {0x16E40, 0x16E5F, UnicodeCategory_t::LU}, {0x16E60, 0x16E7F, UnicodeCategory_t::LL}, {0x16E80, 0x16E96, UnicodeCategory_t::NO},
+        {0x16E97, 0x16E9A, UnicodeCategory_t::PO}, {0x16F00, 0x16F4A, UnicodeCategory_t::LO}, {0x16F4F, 0x16F4F, UnicodeCategory_t::MN},
+        {0x16F50, 0x16F50, UnicodeCategory_t::LO}, {0x16F51, 0x16F87, UnicodeCategory_t::MC}, {0x16F8F, 0x16F92, UnicodeCategory_t::MN},
+        {0x16F93, 0x16F9F, UnicodeCategory_t::LM}, {0x16FE0, 0x16FE1, UnicodeCategory_t::LM}, {0x16FE2, 0x16FE2, UnicodeCategory_t::PO},
+        {0x16FE3, 0x16FE3, UnicodeCategory_t::LM}, {0x16FE4, 0x16FE4, UnicodeCategory_t::MN}, {0x16FF0, 0x16FF1, UnicodeCategory_t::MC},
+        {0x17000, 0x187F7, UnicodeCategory_t::LO}, {0x18800, 0x18CD5, UnicodeCategory_t::LO}, {0x18D00, 0x18D08, UnicodeCategory_t::LO},
+        {0x1AFF0, 0x1AFF3, UnicodeCategory_t::LM}, {0x1AFF5, 0x1AFFB, UnicodeCategory_t::LM}, {0x1AFFD, 0x1AFFE, UnicodeCategory_t::LM},
+        {0x1B000, 0x1B122, UnicodeCategory_t::LO}, {0x1B150, 0x1B152, UnicodeCategory_t::LO}, {0x1B164, 0x1B167, UnicodeCategory_t::LO},
+        {0x1B170, 0x1B2FB, UnicodeCategory_t::LO}, {0x1BC00, 0x1BC6A, UnicodeCategory_t::LO}, {0x1BC70, 0x1BC7C, UnicodeCategory_t::LO},
+        {0x1BC80, 0x1BC88, UnicodeCategory_t::LO}, {0x1BC90, 0x1BC99, UnicodeCategory_t::LO}, {0x1BC9C, 0x1BC9C, UnicodeCategory_t::SO},
+        {0x1BC9D, 0x1BC9E, UnicodeCategory_t::MN}, {0x1BC9F, 0x1BC9F, UnicodeCategory_t::PO}, {0x1BCA0, 0x1BCA3, UnicodeCategory_t::CF},
+        {0x1CF00, 0x1CF2D, UnicodeCategory_t::MN}, {0x1CF30, 0x1CF46, UnicodeCategory_t::MN}, {0x1CF50, 0x1CFC3, UnicodeCategory_t::SO},
+        {0x1D000, 0x1D0F5, UnicodeCategory_t::SO}, {0x1D100, 0x1D126, UnicodeCategory_t::SO}, {0x1D129, 0x1D164, UnicodeCategory_t::SO},
+        {0x1D165, 0x1D166, UnicodeCategory_t::MC}, {0x1D167, 0x1D169, UnicodeCategory_t::MN}, {0x1D16A, 0x1D16C, UnicodeCategory_t::SO},
+        {0x1D16D, 0x1D172, UnicodeCategory_t::MC}, {0x1D173, 0x1D17A, UnicodeCategory_t::CF}, {0x1D17B, 0x1D182, UnicodeCategory_t::MN},
+        {0x1D183, 0x1D184, UnicodeCategory_t::SO}, {0x1D185, 0x1D18B, UnicodeCategory_t::MN}, {0x1D18C, 0x1D1A9, UnicodeCategory_t::SO},
+        {0x1D1AA, 0x1D1AD, UnicodeCategory_t::MN}, {0x1D1AE, 0x1D1EA, UnicodeCategory_t::SO}, {0x1D200, 0x1D241, UnicodeCategory_t::SO},
+        {0x1D242, 0x1D244, UnicodeCategory_t::MN}, {0x1D245, 0x1D245, UnicodeCategory_t::SO}, {0x1D2E0, 0x1D2F3, UnicodeCategory_t::NO},
+        {0x1D300, 0x1D356, UnicodeCategory_t::SO}, {0x1D360, 0x1D378, UnicodeCategory_t::NO}, {0x1D400, 0x1D419, UnicodeCategory_t::LU},
+        {0x1D41A, 0x1D433, UnicodeCategory_t::LL}, {0x1D434, 0x1D44D, UnicodeCategory_t::LU}, {0x1D44E, 0x1D454, UnicodeCategory_t::LL},
+        {0x1D456, 0x1D467, UnicodeCategory_t::LL}, {0x1D468, 0x1D481, UnicodeCategory_t::LU}, {0x1D482, 0x1D49B, UnicodeCategory_t::LL},
+        {0x1D49C, 0x1D49C, UnicodeCategory_t::LU}, {0x1D49E, 0x1D49F, UnicodeCategory_t::LU}, {0x1D4A2, 0x1D4A2, UnicodeCategory_t::LU},
+        {0x1D4A5, 0x1D4A6, UnicodeCategory_t::LU}, {0x1D4A9, 0x1D4AC, UnicodeCategory_t::LU}, {0x1D4AE, 0x1D4B5, UnicodeCategory_t::LU},
+        {0x1D4B6, 0x1D4B9, UnicodeCategory_t::LL}, {0x1D4BB, 0x1D4BB, UnicodeCategory_t::LL}, {0x1D4BD, 0x1D4C3, UnicodeCategory_t::LL},
+        {0x1D4C5, 0x1D4CF, UnicodeCategory_t::LL}, {0x1D4D0, 0x1D4E9, UnicodeCategory_t::LU}, {0x1D4EA, 0x1D503, UnicodeCategory_t::LL},
+        {0x1D504, 0x1D505, UnicodeCategory_t::LU}, {0x1D507, 0x1D50A, UnicodeCategory_t::LU}, {0x1D50D, 0x1D514, UnicodeCategory_t::LU},
+        {0x1D516, 0x1D51C, UnicodeCategory_t::LU}, {0x1D51E, 0x1D537, UnicodeCategory_t::LL}, {0x1D538, 0x1D539, UnicodeCategory_t::LU},
+        {0x1D53B, 0x1D53E, UnicodeCategory_t::LU}, {0x1D540, 0x1D544, UnicodeCategory_t::LU}, {0x1D546, 0x1D546, UnicodeCategory_t::LU},
+        {0x1D54A, 0x1D550, UnicodeCategory_t::LU}, {0x1D552, 0x1D56B, UnicodeCategory_t::LL}, {0x1D56C, 0x1D585, UnicodeCategory_t::LU},
+        {0x1D586, 0x1D59F, UnicodeCategory_t::LL}, {0x1D5A0, 0x1D5B9, UnicodeCategory_t::LU}, {0x1D5BA, 0x1D5D3, UnicodeCategory_t::LL},
+        {0x1D5D4, 0x1D5ED, UnicodeCategory_t::LU}, {0x1D5EE, 0x1D607, UnicodeCategory_t::LL}, {0x1D608, 0x1D621, UnicodeCategory_t::LU},
+        {0x1D622, 0x1D63B, UnicodeCategory_t::LL}, {0x1D63C, 0x1D655, UnicodeCategory_t::LU}, {0x1D656, 0x1D66F, UnicodeCategory_t::LL},
+        {0x1D670, 0x1D689, UnicodeCategory_t::LU}, {0x1D68A, 0x1D6A5, UnicodeCategory_t::LL}, {0x1D6A8, 0x1D6C0, UnicodeCategory_t::LU},
+        {0x1D6C1, 0x1D6C1, UnicodeCategory_t::SM}, {0x1D6C2, 0x1D6DA, UnicodeCategory_t::LL}, {0x1D6DB, 0x1D6DB, UnicodeCategory_t::SM},
+        {0x1D6DC, 0x1D6E1, UnicodeCategory_t::LL}, {0x1D6E2, 0x1D6FA, UnicodeCategory_t::LU}, {0x1D6FB, 0x1D6FB, UnicodeCategory_t::SM},
+        {0x1D6FC, 0x1D714, UnicodeCategory_t::LL}, {0x1D715, 0x1D715, UnicodeCategory_t::SM}, {0x1D716, 0x1D71B, UnicodeCategory_t::LL},
+        {0x1D71C, 0x1D734, UnicodeCategory_t::LU}, {0x1D735, 0x1D735, UnicodeCategory_t::SM}, {0x1D736, 0x1D74E, UnicodeCategory_t::LL},
+        {0x1D74F, 0x1D74F, UnicodeCategory_t::SM}, {0x1D750, 0x1D755, UnicodeCategory_t::LL}, {0x1D756, 0x1D76E, UnicodeCategory_t::LU},
+        {0x1D76F, 0x1D76F, UnicodeCategory_t::SM}, {0x1D770, 0x1D788, UnicodeCategory_t::LL}, {0x1D789, 0x1D789, UnicodeCategory_t::SM},
+        {0x1D78A, 0x1D78F, UnicodeCategory_t::LL}, {0x1D790, 0x1D7A8, UnicodeCategory_t::LU}, {0x1D7A9, 0x1D7A9, UnicodeCategory_t::SM},
+        {0x1D7AA, 0x1D7C2, UnicodeCategory_t::LL}, {0x1D7C3, 0x1D7C3, UnicodeCategory_t::SM}, {0x1D7C4, 0x1D7C9, UnicodeCategory_t::LL},
+        {0x1D7CA, 0x1D7CA, UnicodeCategory_t::LU}, {0x1D7CB, 0x1D7CB, UnicodeCategory_t::LL}, {0x1D7CE, 0x1D7FF, UnicodeCategory_t::ND},
+        {0x1D800, 0x1D9FF, UnicodeCategory_t::SO}, {0x1DA00, 0x1DA36, UnicodeCategory_t::MN}, {0x1DA37, 0x1DA3A, UnicodeCategory_t::SO},
+        {0x1DA3B, 0x1DA6C, UnicodeCategory_t::MN}, {0x1DA6D, 0x1DA74, UnicodeCategory_t::SO}, {0x1DA75, 0x1DA75, UnicodeCategory_t::MN},
+        {0x1DA76, 0x1DA83, UnicodeCategory_t::SO}, {0x1DA84, 0x1DA84, UnicodeCategory_t::MN}, {0x1DA85, 0x1DA86, UnicodeCategory_t::SO},
+        {0x1DA87, 0x1DA8B, UnicodeCategory_t::PO}, {0x1DA9B, 0x1DA9F, UnicodeCategory_t::MN}, {0x1DAA1, 0x1DAAF, UnicodeCategory_t::MN},
+        {0x1DF00, 0x1DF09, UnicodeCategory_t::LL}, {0x1DF0A, 0x1DF0A, UnicodeCategory_t::LO}, {0x1DF0B, 0x1DF1E, UnicodeCategory_t::LL},
+        {0x1E000, 0x1E006, UnicodeCategory_t::MN}, {0x1E008, 0x1E018, UnicodeCategory_t::MN}, {0x1E01B, 0x1E021, UnicodeCategory_t::MN},
+        {0x1E023, 0x1E024, UnicodeCategory_t::MN}, {0x1E026, 0x1E02A, UnicodeCategory_t::MN}, {0x1E100, 0x1E12C, UnicodeCategory_t::LO},
+        {0x1E130, 0x1E136, UnicodeCategory_t::MN}, {0x1E137, 0x1E13D, UnicodeCategory_t::LM}, {0x1E140, 0x1E149, UnicodeCategory_t::ND},
+        {0x1E14E, 0x1E14E, UnicodeCategory_t::LO}, {0x1E14F, 0x1E14F, UnicodeCategory_t::SO}, {0x1E290, 0x1E2AD, UnicodeCategory_t::LO},
+        {0x1E2AE, 0x1E2AE, UnicodeCategory_t::MN}, {0x1E2C0, 0x1E2EB, UnicodeCategory_t::LO}, {0x1E2EC, 0x1E2EF, UnicodeCategory_t::MN},
+        {0x1E2F0, 0x1E2F9, UnicodeCategory_t::ND}, {0x1E2FF, 0x1E2FF, UnicodeCategory_t::SC}, {0x1E7E0, 0x1E7E6, UnicodeCategory_t::LO},
+        {0x1E7E8, 0x1E7EB, UnicodeCategory_t::LO}, {0x1E7ED, 0x1E7EE, UnicodeCategory_t::LO}, {0x1E7F0, 0x1E7FE, UnicodeCategory_t::LO},
+        {0x1E800, 0x1E8C4, UnicodeCategory_t::LO}, {0x1E8C7, 0x1E8CF, UnicodeCategory_t::NO}, {0x1E8D0, 0x1E8D6, UnicodeCategory_t::MN},
+        {0x1E900, 0x1E921, UnicodeCategory_t::LU}, {0x1E922, 0x1E943, UnicodeCategory_t::LL}, {0x1E944, 0x1E94A, UnicodeCategory_t::MN},
+        {0x1E94B, 0x1E94B, UnicodeCategory_t::LM}, {0x1E950, 0x1E959, UnicodeCategory_t::ND}, {0x1E95E, 0x1E95F, UnicodeCategory_t::PO},
+        {0x1EC71, 0x1ECAB, UnicodeCategory_t::NO}, {0x1ECAC, 0x1ECAC, UnicodeCategory_t::SO}, {0x1ECAD, 0x1ECAF, UnicodeCategory_t::NO},
+        {0x1ECB0, 0x1ECB0, UnicodeCategory_t::SC}, {0x1ECB1, 0x1ECB4, UnicodeCategory_t::NO}, {0x1ED01, 0x1ED2D, UnicodeCategory_t::NO},
+        {0x1ED2E, 0x1ED2E, UnicodeCategory_t::SO}, {0x1ED2F, 0x1ED3D, UnicodeCategory_t::NO}, {0x1EE00, 0x1EE03, UnicodeCategory_t::LO},
+        {0x1EE05, 0x1EE1F, UnicodeCategory_t::LO}, {0x1EE21, 0x1EE22, UnicodeCategory_t::LO}, {0x1EE24, 0x1EE24, UnicodeCategory_t::LO},
+        {0x1EE27, 0x1EE27, UnicodeCategory_t::LO}, {0x1EE29, 0x1EE32, UnicodeCategory_t::LO}, {0x1EE34, 0x1EE37, UnicodeCategory_t::LO},
+        {0x1EE39, 0x1EE39, UnicodeCategory_t::LO}, {0x1EE3B, 0x1EE3B, UnicodeCategory_t::LO}, {0x1EE42, 0x1EE42, UnicodeCategory_t::LO},
+        {0x1EE47, 0x1EE47, UnicodeCategory_t::LO}, {0x1EE49, 0x1EE49, UnicodeCategory_t::LO}, {0x1EE4B, 0x1EE4B, UnicodeCategory_t::LO},
+        {0x1EE4D, 0x1EE4F, UnicodeCategory_t::LO}, {0x1EE51, 0x1EE52, UnicodeCategory_t::LO}, {0x1EE54, 0x1EE54, UnicodeCategory_t::LO},
+        {0x1EE57, 0x1EE57, UnicodeCategory_t::LO}, {0x1EE59, 0x1EE59, UnicodeCategory_t::LO}, {0x1EE5B, 0x1EE5B, UnicodeCategory_t::LO},
+        {0x1EE5D, 0x1EE5D, UnicodeCategory_t::LO}, {0x1EE5F, 0x1EE5F, UnicodeCategory_t::LO}, {0x1EE61, 0x1EE62, UnicodeCategory_t::LO},
+        {0x1EE64, 0x1EE64, UnicodeCategory_t::LO}, {0x1EE67, 0x1EE6A, UnicodeCategory_t::LO}, {0x1EE6C, 0x1EE72, UnicodeCategory_t::LO},
+        {0x1EE74, 0x1EE77, UnicodeCategory_t::LO}, {0x1EE79, 0x1EE7C, UnicodeCategory_t::LO}, {0x1EE7E, 0x1EE7E, UnicodeCategory_t::LO},
+        {0x1EE80, 0x1EE89, UnicodeCategory_t::LO}, {0x1EE8B, 0x1EE9B, UnicodeCategory_t::LO}, {0x1EEA1, 0x1EEA3, UnicodeCategory_t::LO},
+        {0x1EEA5, 0x1EEA9, UnicodeCategory_t::LO}, {0x1EEAB, 0x1EEBB, UnicodeCategory_t::LO}, {0x1EEF0, 0x1EEF1, UnicodeCategory_t::SM},
+        {0x1F000, 0x1F02B, UnicodeCategory_t::SO}, {0x1F030, 0x1F093, UnicodeCategory_t::SO}, {0x1F0A0, 0x1F0AE, UnicodeCategory_t::SO},
+        {0x1F0B1, 0x1F0BF, UnicodeCategory_t::SO}, {0x1F0C1, 0x1F0CF, UnicodeCategory_t::SO}, {0x1F0D1, 0x1F0F5, UnicodeCategory_t::SO},
+        {0x1F100, 0x1F10C, UnicodeCategory_t::NO}, {0x1F10D, 0x1F1AD, UnicodeCategory_t::SO}, {0x1F1E6, 0x1F202, UnicodeCategory_t::SO},
+        {0x1F210, 0x1F23B, UnicodeCategory_t::SO}, {0x1F240, 0x1F248, UnicodeCategory_t::SO}, {0x1F250, 0x1F251, UnicodeCategory_t::SO},
+        {0x1F260, 0x1F265, UnicodeCategory_t::SO}, {0x1F300, 0x1F3FA, UnicodeCategory_t::SO}, {0x1F3FB, 0x1F3FF, UnicodeCategory_t::SK},
+        {0x1F400, 0x1F6D7, UnicodeCategory_t::SO}, {0x1F6DD, 0x1F6EC, UnicodeCategory_t::SO}, {0x1F6F0, 0x1F6FC, UnicodeCategory_t::SO},
+        {0x1F700, 0x1F773, UnicodeCategory_t::SO}, {0x1F780, 0x1F7D8, UnicodeCategory_t::SO}, {0x1F7E0, 0x1F7EB, UnicodeCategory_t::SO},
+        {0x1F7F0, 0x1F7F0, UnicodeCategory_t::SO}, {0x1F800, 0x1F80B, UnicodeCategory_t::SO}, {0x1F810, 0x1F847, UnicodeCategory_t::SO},
+        {0x1F850, 0x1F859, UnicodeCategory_t::SO}, {0x1F860, 0x1F887, UnicodeCategory_t::SO}, {0x1F890, 0x1F8AD, UnicodeCategory_t::SO},
+        {0x1F8B0, 0x1F8B1, UnicodeCategory_t::SO}, {0x1F900, 0x1FA53, UnicodeCategory_t::SO}, {0x1FA60, 0x1FA6D, UnicodeCategory_t::SO},
+        {0x1FA70, 0x1FA74, UnicodeCategory_t::SO}, {0x1FA78, 0x1FA7C, UnicodeCategory_t::SO}, {0x1FA80, 0x1FA86, UnicodeCategory_t::SO},
+        {0x1FA90, 0x1FAAC, UnicodeCategory_t::SO}, {0x1FAB0, 0x1FABA, UnicodeCategory_t::SO}, {0x1FAC0, 0x1FAC5, UnicodeCategory_t::SO},
+        {0x1FAD0, 0x1FAD9, UnicodeCategory_t::SO}, {0x1FAE0, 0x1FAE7, UnicodeCategory_t::SO}, {0x1FAF0, 0x1FAF6, UnicodeCategory_t::SO},
+        {0x1FB00, 0x1FB92, UnicodeCategory_t::SO}, {0x1FB94, 0x1FBCA, UnicodeCategory_t::SO}, {0x1FBF0, 0x1FBF9, UnicodeCategory_t::ND},
+        {0x20000, 0x2A6DF, UnicodeCategory_t::LO}, {0x2A700, 0x2B738, UnicodeCategory_t::LO}, {0x2B740, 0x2B81D, UnicodeCategory_t::LO},
+        {0x2B820, 0x2CEA1, UnicodeCategory_t::LO}, {0x2CEB0, 0x2EBE0, UnicodeCategory_t::LO}, {0x2F800, 0x2FA1D, UnicodeCategory_t::LO},
+        {0x30000, 0x3134A, UnicodeCategory_t::LO}, {0xE0001, 0xE0001, UnicodeCategory_t::CF}, {0xE0020, 0xE007F, UnicodeCategory_t::CF},
+        {0xE0100, 0xE01EF, UnicodeCategory_t::MN}, {0xF0000, 0xFFFFD, UnicodeCategory_t::CO}, {0x100000, 0x10FFFD, UnicodeCategory_t::CO},
+    };
+
+    const std::size_t unicode_category_table_size{sizeof(unicode_category_table) / sizeof(unicode_category_table[0])};
+
+    const char unicode_version[]{"14.0.0"};
+}
@@ -0,0 +1,95 @@
+/** The table of the general category of Unicode.
+    \file unicode_category.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_SRC_UNICODE_CATEGORY_H_
+#define TPHRASE_SRC_UNICODE_CATEGORY_H_
+
+#include <cstddef>
+
+namespace tphrase {
+    /** The general category of Unicode. */
+    enum class UnicodeCategory_t : unsigned char {
+        CN, /**< Unassigned */
+        LU, /**< Uppercase_Letter */
+        LL, /**< Lowercase_Letter */
+        LT, /**< Titlecase_Letter */
+        LM, /**< Modifier_Letter */
+        LO, /**< Other_Letter */
+        MN, /**< Nonspacing_Mark */
+        MC, /**< Spacing_Mark */
+        ME, /**< Enclosing_Mark */
+        ND, /**< Decimal_Number */
+        NL, /**< Letter_Number */
+        NO, /**< Other_Number */
+        PC, /**< Connector_Punctuation */
+        PD, /**< Dash_Punctuation */
+        PS, /**< Open_Punctuation */
+        PE, /**< Close_Punctuation */
+        PI, /**< Initial_Punctuation */
+        PF, /**< Final_Punctuation */
+        PO, /**< Other_Punctuation */
+        SM, /**< Math_Symbol */
+        SC, /**< Currency_Symbol */
+        SK, /**< Modifier_Symbol */
+        SO, /**< Other_Symbol */
+        ZS, /**< Space_Separator */
+        ZL, /**< Line_Separator */
+        ZP, /**< Paragraph_Separator */
+        CC, /**< Control */
+        CF, /**< Format */
+        CS, /**< Surrogate */
+        CO, /**< Private_Use */
+    };
+
+    /** A range of the code points that have the same general category. */
+    struct UnicodeCategoryRange_t {
+        char32_t first; /**< The first code point in the range. */
+        char32_t last; /**< The last code point in the range. */
+        UnicodeCategory_t category; /**< The general category of the code points in the range. */
+    };
+
+    /** The ranges of the assigned code points in ascending order.
+        \note The code point that is not in the table is unassigned (CN).
+    */
+    extern const UnicodeCategoryRange_t unicode_category_table[];
+    /** The number of the elements in unicode_category_table. */
+    extern const std::size_t unicode_category_table_size;
+    /** The version of the Unicode Character Database from which unicode_category_table is made. */
+    extern const char unicode_version[];
+}
+
+#endif // TPHRASE_SRC_UNICODE_CATEGORY_H_
@@ -0,0 +1,120 @@
+/** The utility functions for UTF-8.
+    \file utf8.h
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#ifndef TPHRASE_SRC_UTF8_H_
+#define TPHRASE_SRC_UTF8_H_
+
+#include <cstddef>
+#include <string>
+
+namespace tphrase {
+    /** The offset to the code point representing an invalid byte in UTF-8.
+        \note An invalid byte b is decoded into the lone surrogate U+DC00 + b, in the same way as the "surrogateescape" in Python.
+    */
+    constexpr char32_t INVALID_UTF8_OFFSET{0xDC00};
+
+    /** Decode a code point in a UTF-8 string.
+        \param [in] s The UTF-8 string.
+        \param [in] pos The position of the code point in s. It must be less than s.size().
+        \param [out] len The number of the bytes of the code point.
+        \return The code point.
+        \note An invalid byte is decoded into a code point (INVALID_UTF8_OFFSET + the byte) and len is 1.
+    */
+    inline char32_t decode_utf8(const std::string &s, const std::size_t pos, std::size_t &len)
+    {
+        const unsigned char b0{static_cast<unsigned char>(s[pos])};
+        if (b0 < 0x80) {
+            len = 1;
+            return b0;
+        }
+        std::size_t n;
+        char32_t c;
+        char32_t min;
+        if (b0 >= 0xC2 && b0 <= 0xDF) {
+            n = 2;
+            c = b0 & 0x1F;
+            min = 0x80;
+        } else if (b0 >= 0xE0 && b0 <= 0xEF) {
+            n = 3;
+            c = b0 & 0x0F;
+            min = 0x800;
+        } else if (b0 >= 0xF0 && b0 <= 0xF4) {
+            n = 4;
+            c = b0 & 0x07;
+            min = 0x10000;
+        } else {
+            len = 1;
+            return INVALID_UTF8_OFFSET + b0;
+        }
+        if (s.size() - pos < n) {
+            len = 1;
+            return INVALID_UTF8_OFFSET + b0;
+        }
+        for (std::size_t i = 1; i < n; ++i) {
+            const unsigned char b{static_cast<unsigned char>(s[pos + i])};
+            if ((b & 0xC0) != 0x80) {
+                len = 1;
+                return INVALID_UTF8_OFFSET + b0;
+            }
+            c = (c << 6) | (b & 0x3F);
+        }
+        if (c < min || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) {
+            len = 1;
+            return INVALID_UTF8_OFFSET + b0;
+        }
+        len = n;
+        return c;
+    }
+
+    /** Is a string valid in UTF-8?
+        \param [in] s The string.
+        \return true if s has no invalid byte in UTF-8.
+    */
+    inline bool is_valid_utf8(const std::string &s)
+    {
+        std::size_t len;
+        for (std::size_t i = 0; i < s.size(); i += len) {
+            const char32_t c{decode_utf8(s, i, len)};
+            if (len == 1 && c >= INVALID_UTF8_OFFSET + 0x80) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+#endif // TPHRASE_SRC_UTF8_H_
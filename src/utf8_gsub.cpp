@@ -0,0 +1,217 @@
+/** The gsub function creator for UTF-8.
+    \file utf8_gsub.cpp
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tphrase/utf8_gsub.h"
+#include "Utf8Regex.h"
+#include "utf8.h"
+
+namespace {
+    /** The gsub with the regular expression for UTF-8. */
+    class Utf8Gsub {
+    public:
+        Utf8Gsub() = delete;
+        /** The constructor.
+            \param [in] pattern Pattern parameter for gsub.
+            \param [in] repl Replacement parameter for gsub.
+            \param [in] in_global Global parameter for gsub.
+            \throw std::runtime_error if the pattern is invalid.
+        */
+        Utf8Gsub(const std::string &pattern, const std::string &repl, const bool in_global)
+            : re{pattern}, parts{}, global{in_global}
+        {
+            parse_replacement(repl);
+        }
+
+        /** Substitute a string.
+            \param [in] s The source string.
+            \return Substituted string.
+        */
+        std::string gsub(const std::string &s) const
+        {
+            std::string r;
+            std::vector<std::size_t> captures;
+            tphrase::Utf8Regex::Workspace_t ws;
+            std::size_t emitted{0};
+            std::size_t pos{0};
+            while (pos <= s.size() && re.search(s, pos, captures, ws)) {
+                const std::size_t match_start{captures[0]};
+                const std::size_t match_end{captures[1]};
+                r.append(s, emitted, match_start - emitted);
+                expand(s, captures, r);
+                emitted = match_end;
+                if (!global) {
+                    break;
+                }
+                if (match_start == match_end) {
+                    // Skip a code point after the empty match.
+                    if (match_end >= s.size()) {
+                        break;
+                    }
+                    std::size_t len;
+                    tphrase::decode_utf8(s, match_end, len);
+                    pos = match_end + len;
+                } else {
+                    pos = match_end;
+                }
+            }
+            r.append(s, emitted, std::string::npos);
+            return r;
+        }
+
+    private:
+        /** The part of the replacement. */
+        struct Part_t {
+            /** The kind of the part. */
+            enum class Kind_t {
+                STRING, /**< The literal string. */
+                GROUP, /**< The captured group. ("$&" is the group 0.) */
+                PREFIX, /**< The string before the match. ("$`") */
+                SUFFIX, /**< The string after the match. ("$'") */
+            };
+            Kind_t kind; /**< The kind of the part. */
+            std::string s; /**< The literal string. */
+            std::size_t group; /**< The number of the group. */
+        };
+
+        /** Parse the replacement in the ECMAScript format.
+            \param [in] repl Replacement parameter for gsub.
+        */
+        void parse_replacement(const std::string &repl)
+        {
+            const std::size_t m{re.get_group_number()};
+            std::string literal;
+            const auto add = [&](const Part_t::Kind_t kind, const std::size_t group) {
+                if (!literal.empty()) {
+                    parts.push_back(Part_t{Part_t::Kind_t::STRING, std::move(literal), 0});
+                    literal.clear();
+                }
+                parts.push_back(Part_t{kind, std::string{}, group});
+            };
+            const auto is_digit = [&](const std::size_t i) {
+                return i < repl.size() && repl[i] >= '0' && repl[i] <= '9';
+            };
+            std::size_t i{0};
+            while (i < repl.size()) {
+                if (repl[i] != '$' || i + 1 == repl.size()) {
+                    literal += repl[i];
+                    ++i;
+                    continue;
+                }
+                const char c{repl[i + 1]};
+                if (c == '$') {
+                    literal += '$';
+                    i += 2;
+                } else if (c == '&') {
+                    add(Part_t::Kind_t::GROUP, 0);
+                    i += 2;
+                } else if (c == '`') {
+                    add(Part_t::Kind_t::PREFIX, 0);
+                    i += 2;
+                } else if (c == '\'') {
+                    add(Part_t::Kind_t::SUFFIX, 0);
+                    i += 2;
+                } else if (is_digit(i + 1)) {
+                    const std::size_t n{static_cast<std::size_t>(c - '0')};
+                    if (is_digit(i + 2) && n * 10 + (repl[i + 2] - '0') >= 1 && n * 10 + (repl[i + 2] - '0') <= m) {
+                        add(Part_t::Kind_t::GROUP, n * 10 + (repl[i + 2] - '0'));
+                        i += 3;
+                    } else if (n >= 1 && n <= m) {
+                        add(Part_t::Kind_t::GROUP, n);
+                        i += 2;
+                    } else {
+                        literal += '$';
+                        ++i;
+                    }
+                } else {
+                    literal += '$';
+                    ++i;
+                }
+            }
+            if (!literal.empty()) {
+                parts.push_back(Part_t{Part_t::Kind_t::STRING, std::move(literal), 0});
+            }
+        }
+
+        /** Expand the replacement.
+            \param [in] s The source string.
+            \param [in] captures The captures of the match.
+            \param [inout] r The string to which the replacement is appended.
+        */
+        void expand(const std::string &s, const std::vector<std::size_t> &captures, std::string &r) const
+        {
+            for (const auto &part : parts) {
+                switch (part.kind) {
+                case Part_t::Kind_t::STRING:
+                    r += part.s;
+                    break;
+                case Part_t::Kind_t::GROUP:
+                    if (captures[part.group * 2] != tphrase::Utf8Regex::NPOS
+                        && captures[part.group * 2 + 1] != tphrase::Utf8Regex::NPOS) {
+                        r.append(s, captures[part.group * 2], captures[part.group * 2 + 1] - captures[part.group * 2]);
+                    }
+                    break;
+                case Part_t::Kind_t::PREFIX:
+                    r.append(s, 0, captures[0]);
+                    break;
+                case Part_t::Kind_t::SUFFIX:
+                    r.append(s, captures[1], std::string::npos);
+                    break;
+                }
+            }
+        }
+
+        tphrase::Utf8Regex re; /**< The regular expression. */
+        std::vector<Part_t> parts; /**< The parts of the replacement. */
+        bool global; /**< Global parameter for gsub. */
+    };
+}
+
+namespace tphrase {
+    GsubFunc_t create_utf8_gsub(const std::string &pattern, const std::string &repl, const bool global)
+    {
+        // It may throw a std::runtime_error at creating because the parser catches it.
+        const std::shared_ptr<const Utf8Gsub> g{std::make_shared<const Utf8Gsub>(pattern, repl, global)};
+        return [g](const std::string &s) {
+            return g->gsub(s);
+        };
+    }
+}
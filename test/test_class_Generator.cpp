@@ -32,12 +32,19 @@
    limitations under the License.
 */
 
+#include <cstdint>
+#include <cstring>
 #include <ios>
 #include <iterator>
+#include <memory>
 #include <sstream>
+#include <stdexcept>
+#include <string>
 #include <utility>
 
 #include "tphrase/Generator.h"
+#include "tphrase/GeneratorImage.h"
+#include "tphrase/utf8_gsub.h"
 
 #include "UnitTest.h"
 #include "unit_test_utility.h"
@@ -65,6 +72,16 @@ namespace {
                 && weight == a.weight;
         }
     };
+
+    std::size_t number_of_created_gsub{0};
+
+    tphrase::GsubFunc_t counting_gsub_creator(const std::string &pattern,
+                                              const std::string &repl,
+                                              bool)
+    {
+        ++number_of_created_gsub;
+        return [=](const std::string &s) { return s + pattern + repl; };
+    }
 }
 
 std::size_t test_class_Generator()
@@ -336,6 +353,24 @@ std::size_t test_class_Generator()
             && n20 == PhraseNumber_t{0, 0, 0};
     });
 
+    ut.set_test("Copy Constructor (weight of a nonterminal is kept)", [&]() {
+        const tphrase::Syntax syntax{"main = {A}\nA 5 = a | b\n"};
+        const tphrase::Syntax syntax_copy{syntax};
+        tphrase::Generator ph1{syntax};
+        const tphrase::Generator ph2{syntax_copy};
+        const tphrase::Generator ph3{tphrase::Syntax{syntax}};
+        const tphrase::Generator ph4{ph1};
+        tphrase::Generator ph5;
+        ph5.add(syntax);
+        ph1.add("main = c\n");
+        return ph1.get_weight() == 6
+            && ph2.get_weight() == 5
+            && ph3.get_weight() == 5
+            && ph4.get_weight() == 5
+            && ph5.get_weight() == 5
+            && ph2.get_combination_number() == 2;
+    });
+
     ut.set_test("Move Constructor#1", [&]() {
         tphrase::Generator ph1{R"(
             main = {= X | Y | Z } | {A} | {B}
@@ -936,6 +971,26 @@ std::size_t test_class_Generator()
             && PhraseNumber_t{ph} == PhraseNumber_t{3, 15, 15};
     });
 
+    ut.set_test("Add syntax with a local start condition", [&]() {
+        tphrase::Syntax syntax{"main = {_X}\n_X = x\n"};
+        syntax.add(tphrase::Syntax{"main2 = {_X}\n_X = y\n"}); // The second _X is renamed to _X@1.
+        const tphrase::Generator ph1{syntax, "_X"};
+        const tphrase::Generator ph2{syntax, "_X@1"};
+        tphrase::Generator ph3;
+        const auto id3{ph3.add(syntax, "_X")};
+        const auto id4{ph3.add(syntax, "main")};
+        return ph1.get_number_of_syntax() == 0
+            && ph1.get_error_message().size() == 1
+            && ph1.get_error_message()[0] == "The nonterminal \"_X\" doesn't exist."
+            && ph2.get_number_of_syntax() == 0
+            && ph2.get_error_message().size() == 1
+            && ph2.get_error_message()[0] == "The nonterminal \"_X@1\" doesn't exist."
+            && !id3
+            && id4
+            && ph3.get_number_of_syntax() == 1
+            && ph3.generate() == "x";
+    });
+
     ut.set_test("Add via R-Value Syntax (a pair of input iterators)#1", [&]() {
         tphrase::Generator ph{R"(
             main = {= X | Y | Z } | {A} | {B}
@@ -1206,5 +1261,452 @@ std::size_t test_class_Generator()
             && ph.get_combination_number() == 1;
     });
 
+    ut.set_test("Configuration", [&]() {
+        tphrase::Config_t config;
+        config.gsub_creator = [](const std::string &,
+                                 const std::string &,
+                                 bool) {
+            return [](const std::string&) { return std::string{"123"}; };
+        };
+        config.random_creator = []() {
+            return get_sequence_random_func({0.9});
+        };
+        tphrase::Syntax syntax{config};
+        syntax.add(R"(
+            main = {A} | {B}
+            A = abc ~ /x/y/
+            B = def
+        )");
+        tphrase::Generator ph{syntax};
+        tphrase::Config_t config_a{config};
+        config_a.random_creator = []() {
+            return get_sequence_random_func({0.1});
+        };
+        tphrase::Syntax syntax_a{config_a};
+        syntax_a.add(R"(
+            main = {A} | {B}
+            A = abc ~ /x/y/
+            B = def
+        )");
+        tphrase::Generator ph_a{syntax_a};
+        tphrase::Generator::set_random_function(get_sequence_random_func({0.1}));
+        auto r = ph.generate();
+        auto r_a = ph_a.generate();
+        tphrase::Generator ph2{tphrase::Syntax{R"(
+            main = {A} | {B}
+            A = abc ~ /x/y/
+            B = def
+        )"}};
+        auto r2 = ph2.generate();
+        return r == "def"
+            && r_a == "123"
+            && r2 == "abc"
+            && ph.get_error_message().empty()
+            && ph_a.get_error_message().empty()
+            && ph2.get_error_message().empty()
+            && static_cast<bool>(ph.get_config().gsub_creator)
+            && !ph2.get_config().gsub_creator;
+    });
+
+    ut.set_test("Configuration without Syntax", [&]() {
+        tphrase::Config_t config;
+        config.random_creator = []() {
+            return get_sequence_random_func({0.9, 0.9});
+        };
+        tphrase::Generator ph{config};
+        ph.add(tphrase::Syntax{"main = abc | def"});
+        auto r1 = ph.generate();
+        tphrase::Generator::set_random_function(get_sequence_random_func({0.1}));
+        auto r2 = ph.generate();
+        return r1 == "def"
+            && r2 == "def"
+            && ph.get_error_message().empty();
+    });
+
+    ut.set_test("Gsub Cache", [&]() {
+        tphrase::Generator::set_gsub_function_creator(counting_gsub_creator);
+        tphrase::Generator::clear_gsub_cache();
+        number_of_created_gsub = 0;
+        tphrase::Generator ph1{R"(
+            main = abc ~ /x/1/ ~ /y/2/
+        )"};
+        tphrase::Generator ph2{R"(
+            main = def ~ /x/1/ ~ /y/2/g ~ /x/1/
+        )"};
+        const auto stats1{tphrase::Generator::get_gsub_cache_stats()};
+        tphrase::Generator::set_gsub_cache_capacity(1);
+        const auto stats2{tphrase::Generator::get_gsub_cache_stats()};
+        tphrase::Generator::set_gsub_cache_capacity(0);
+        tphrase::Generator ph3{R"(
+            main = ghi ~ /x/1/
+        )"};
+        const auto stats3{tphrase::Generator::get_gsub_cache_stats()};
+        tphrase::Generator::set_gsub_cache_capacity(1024);
+        tphrase::Generator::clear_gsub_cache();
+        return ph1.generate() == "abcx1y2"
+            && ph2.generate() == "defx1y2x1"
+            && ph3.generate() == "ghix1"
+            && number_of_created_gsub == 4
+            && stats1.hits == 2
+            && stats1.misses == 3
+            && stats1.uncached == 0
+            && stats1.size == 3
+            && stats1.capacity == 1024
+            && stats2.size == 1
+            && stats2.evictions == 2
+            && stats2.capacity == 1
+            && stats3.size == 0
+            && stats3.uncached == 1;
+    });
+
+    ut.set_test("Lazy Gsub", [&]() {
+        tphrase::Generator::clear_gsub_cache();
+        number_of_created_gsub = 0;
+        tphrase::Config_t config;
+        config.gsub_creator = counting_gsub_creator;
+        config.lazy_gsub = true;
+        tphrase::Syntax syntax{config};
+        syntax.add(R"(
+            main = {A} | {B}
+            A = a ~ /x/1/
+            B = b ~ /y/2/
+        )");
+        tphrase::Generator ph{syntax};
+        const std::size_t n0{number_of_created_gsub};
+        auto r1 = ph.generate();
+        auto r2 = ph.generate();
+        const std::size_t n1{number_of_created_gsub};
+        tphrase::Generator::clear_gsub_cache();
+        return n0 == 0
+            && n1 == 1
+            && r1 == "ax1"
+            && r2 == "ax1"
+            && syntax.get_error_message().empty()
+            && ph.get_error_message().empty();
+    });
+
+    ut.set_test("Lazy Gsub with Error", [&]() {
+        tphrase::Config_t config;
+        config.gsub_creator = [](const std::string &,
+                                 const std::string &,
+                                 bool) -> tphrase::GsubFunc_t {
+            throw std::runtime_error{"error"};
+        };
+        config.lazy_gsub = true;
+        tphrase::Syntax syntax{config};
+        syntax.add(R"(
+            main = abc ~ /x/y/
+        )");
+        tphrase::Generator ph{syntax};
+        auto r = ph.generate();
+        return r == "Gsub error: error"
+            && syntax.get_error_message().empty()
+            && ph.get_error_message().empty();
+    });
+
+    ut.set_test("Update", [&]() {
+        tphrase::Syntax syntax;
+        syntax.update("main = {A}\nA = a\nB = b ~ /b/B/\n");
+        tphrase::Generator ph;
+        const auto id{ph.add(syntax)};
+        syntax.update("main = {A}\nA = {B} | c\nB = b ~ /b/B/\n");
+        const bool good1 = ph.update(id, syntax);
+        const std::size_t comb{ph.get_combination_number()};
+        tphrase::Generator::set_random_function(get_sequence_random_func({0.1}));
+        auto r1 = ph.generate();
+        syntax.update("A = {B} | c\nB = b ~ /b/B/\n");
+        const bool good2 = ph.update(id, syntax);
+        return good1
+            && comb == 2
+            && r1 == "B"
+            && !good2
+            && ph.get_number_of_syntax() == 0
+            && ph.get_error_message().size() == 1
+            && ph.get_error_message()[0] == "The nonterminal \"main\" doesn't exist.";
+    });
+
+    ut.set_test("Update a copy", [&]() {
+        tphrase::Syntax syntax;
+        syntax.update("main = {A}\nA = a\n");
+        tphrase::Generator ph1;
+        const auto id{ph1.add(syntax)};
+        tphrase::Syntax syntax_copy{syntax};
+        syntax_copy.update("main = {A}\nA = b | c\n");
+        tphrase::Generator ph2{ph1};
+        const bool good{ph2.update(id, syntax_copy)};
+        tphrase::Generator ph3{ph2};
+        ph3.remove(id);
+        tphrase::Generator::set_random_function(get_sequence_random_func({0.1}));
+        auto r1 = ph1.generate();
+        auto r2 = ph2.generate();
+        return good
+            && r1 == "a"
+            && r2 == "b"
+            && ph1.get_combination_number() == 1
+            && ph2.get_combination_number() == 2
+            && ph3.get_number_of_syntax() == 0
+            && ph2.get_number_of_syntax() == 1
+            && tphrase::Generator{syntax}.get_combination_number() == 1;
+    });
+
+    ut.set_test("Link a library", [&]() {
+        auto library = std::make_shared<const tphrase::SyntaxLibrary>(tphrase::Syntax{"COLOR = red | blue\nNUM = {DIGIT}{DIGIT}\nDIGIT = 1 | 2\n"});
+        auto bad_library = std::make_shared<const tphrase::SyntaxLibrary>(tphrase::Syntax{"X = {Y}\nY = {X}\n"});
+        tphrase::Syntax syntax1{"main = {NUM} {COLOR}\n"};
+        const bool linked1{syntax1.link(library)};
+        tphrase::Syntax syntax2{"main = {COLOR}\nCOLOR = green\n"};
+        syntax2.link(library);
+        tphrase::Syntax syntax3{"main = {X}\n"};
+        const bool linked3{syntax3.link(bad_library)};
+        syntax1.update("main = {COLOR} {NUM}\n");
+        tphrase::Generator ph1{syntax1};
+        tphrase::Generator ph2{syntax2};
+        std::stringstream ss;
+        const bool saved{ph1.save(ss)};
+        tphrase::Generator ph3;
+        const bool loaded{ph3.load(ss)};
+        tphrase::Generator::set_random_function(get_sequence_random_func({0.6, 0.1, 0.6}));
+        auto r1 = ph1.generate();
+        tphrase::Generator::set_random_function(get_sequence_random_func({0.6, 0.1, 0.6}));
+        auto r3 = ph3.generate();
+        return linked1
+            && !linked3
+            && library->get_error_message().empty()
+            && bad_library->get_error_message().size() == 1
+            && syntax3.get_error_message().size() == 1
+            && r1 == "blue 12"
+            && ph1.get_combination_number() == 8
+            && ph2.generate() == "green"
+            && saved
+            && loaded
+            && r3 == "blue 12"
+            && ph3.get_combination_number() == 8;
+    });
+
+    ut.set_test("Compact", [&]() {
+        const std::string vocabulary{"COLOR = red | blue | {= dark | light } gray\nNUM = {DIGIT}{DIGIT} ~ /1/one/\nDIGIT = 1 | 2\nUNUSED = x\n"};
+        tphrase::Generator ph;
+        for (int i = 0; i < 8; ++i) {
+            ph.add(tphrase::Syntax{"main = " + std::to_string(i) + " {COLOR} {NUM}\n" + vocabulary});
+        }
+        ph.add(tphrase::Syntax{"main = {COLOR} {NUM}\nCOLOR = green\nNUM = {DIGIT}\nDIGIT = 3\n"});
+        ph.add(tphrase::Syntax{"main = {DIGIT} {NUM}\nNUM = 4\n"});
+        const tphrase::Generator original{ph};
+        const std::size_t released{ph.compact()};
+        const std::size_t released_again{ph.compact()};
+        std::stringstream ss;
+        const bool saved{ph.save(ss)};
+        tphrase::Generator loaded;
+        const bool good_load{loaded.load(ss)};
+        bool same{true};
+        for (double r = 0.01; r < 1.0; r += 0.07) {
+            tphrase::Generator::set_random_function(get_sequence_random_func({r, 1.0 - r, r, 0.5, r}));
+            const auto expected = original.generate();
+            tphrase::Generator::set_random_function(get_sequence_random_func({r, 1.0 - r, r, 0.5, r}));
+            const auto compacted = ph.generate();
+            tphrase::Generator::set_random_function(get_sequence_random_func({r, 1.0 - r, r, 0.5, r}));
+            same = same && expected == compacted && expected == loaded.generate();
+        }
+        tphrase::Generator::set_random_function(get_sequence_random_func({0.999, 0.0}));
+        const auto external = ph.generate();
+        // The production rules with the same gsub parameters aren't shared if the gsub functions are created by the different creators.
+        const std::string two_e_acute{"main = {A}\nA = \xC3\xA9\xC3\xA9 ~ /./X/g\n"};
+        tphrase::Config_t config;
+        config.gsub_creator = tphrase::create_utf8_gsub;
+        tphrase::Syntax utf8_syntax{config};
+        utf8_syntax.add(two_e_acute);
+        tphrase::Generator mixed;
+        const auto utf8_id{mixed.add(utf8_syntax)};
+        mixed.add(tphrase::Syntax{two_e_acute});
+        mixed.compact();
+        mixed.remove(utf8_id);
+        const auto bytewise = mixed.generate();
+        return released > 0
+            && released_again < released
+            && same
+            && saved
+            && good_load
+            && external == "DIGIT 4"
+            && PhraseNumber_t{ph} == PhraseNumber_t{original}
+            && PhraseNumber_t{loaded} == PhraseNumber_t{original}
+            && bytewise == "XXXX";
+    });
+
+    ut.set_test("Save and Load", [&]() {
+        tphrase::Config_t config;
+        config.gsub_creator = tphrase::create_utf8_gsub;
+        tphrase::Syntax syntax1{config};
+        syntax1.add(R"(
+            main = {A} | {_B} {= x | y } ~ /x/X/ ~ /y/Y/ ~ /z/Z/
+            A 3 = a | "b" 2 ~ /[ab]+/c/g ~ /q/Q/
+            _B := p | q | r
+        )");
+        tphrase::Syntax syntax2{config};
+        syntax2.add("main = s | t ~ /u/U/");
+        tphrase::Syntax syntax3{config};
+        syntax3.add("main = {C}\nC = c");
+        tphrase::Generator ph1{config};
+        ph1.add(syntax1);
+        const auto id2{ph1.add(syntax2)};
+        const auto id3{ph1.add(syntax3)};
+        ph1.remove(id2);
+        std::stringstream ss;
+        const bool saved{ph1.save(ss)};
+        tphrase::Generator ph2{config};
+        const bool loaded{ph2.load(ss)};
+        const std::vector<double> seq{0.05, 0.15, 0.25, 0.35, 0.45, 0.55, 0.65, 0.75, 0.85, 0.95};
+        std::vector<std::string> r1;
+        tphrase::Generator::set_random_function(get_sequence_random_func(seq));
+        for (std::size_t i = 0; i < 20; ++i) {
+            r1.emplace_back(ph1.generate());
+        }
+        std::vector<std::string> r2;
+        tphrase::Generator::set_random_function(get_sequence_random_func(seq));
+        for (std::size_t i = 0; i < 20; ++i) {
+            r2.emplace_back(ph2.generate());
+        }
+        return saved
+            && loaded
+            && PhraseNumber_t{ph1} == PhraseNumber_t{ph2}
+            && r1 == r2
+            && ph1.get_eliminated_gsub_report() == ph2.get_eliminated_gsub_report()
+            && ph2.get_eliminated_gsub_report().size() == 2
+            && ph2.remove(id3)
+            && ph2.get_number_of_syntax() == 1
+            && ph2.get_error_message().empty();
+    });
+
+    ut.set_test("Load a broken snapshot", [&]() {
+        tphrase::Generator ph1{"main = a | b ~ /a/A/"};
+        std::stringstream ss1;
+        ph1.save(ss1);
+        const std::string snapshot{ss1.str()};
+        tphrase::Generator ph2{"main = c"};
+        std::istringstream ss2{snapshot.substr(0, snapshot.size() - 1)};
+        const bool good1{ph2.load(ss2)};
+        std::istringstream ss3{"main = a"};
+        const bool good2{ph2.load(ss3)};
+        std::stringstream ss4;
+        tphrase::Syntax{"main = a"}.save(ss4);
+        const bool good3{ph2.load(ss4)};
+        return !good1
+            && !good2
+            && !good3
+            && ph2.get_number_of_syntax() == 0
+            && ph2.generate() == "nil"
+            && ph2.get_error_message().size() == 3
+            && ph2.get_error_message()[0] == "The snapshot is truncated."
+            && ph2.get_error_message()[1] == "The data is not a snapshot of TPhrase."
+            && ph2.get_error_message()[2] == "The snapshot is not for Generator.";
+    });
+
+    ut.set_test("Load a corrupted snapshot", [&]() {
+        tphrase::Generator ph1{"main = {A1}\nA1 = {A2}\nA2 = x\n"};
+        std::stringstream ss1;
+        ph1.save(ss1);
+        const std::string snapshot1{ss1.str()};
+        // A1 refers to itself, or A1 is assigned twice.
+        bool recursion_detected{true};
+        std::size_t num_replaced{0};
+        for (std::size_t pos = snapshot1.find("A2"); pos != std::string::npos; pos = snapshot1.find("A2", pos + 1)) {
+            std::string corrupted{snapshot1};
+            corrupted[pos + 1] = '1';
+            std::istringstream ss{corrupted};
+            tphrase::Generator ph2;
+            recursion_detected = recursion_detected
+                && !ph2.load(ss)
+                && ph2.generate() == "nil"
+                && ph2.get_error_message().size() == 1
+                && ph2.get_error_message()[0] == "The snapshot is broken.";
+            ++num_replaced;
+        }
+        tphrase::Generator ph3{"main = {A1} | {A2} 2 | {= x | y } ~ /x/X/\nA1 = {A2} ~ /a/b/g\nA2 = a | b\n"};
+        std::stringstream ss3;
+        ph3.save(ss3);
+        const std::string snapshot{ss3.str()};
+        // Any corrupted snapshot is loaded without a crash, or an error is reported.
+        bool no_crash{true};
+        for (std::size_t pos = 0; pos < snapshot.size(); ++pos) {
+            for (const unsigned char mask : {0x01, 0x80, 0xFF}) {
+                std::string corrupted{snapshot};
+                corrupted[pos] = static_cast<char>(corrupted[pos] ^ mask);
+                std::istringstream ss{corrupted};
+                tphrase::Generator ph2;
+                if (ph2.load(ss)) {
+                    ph2.generate();
+                    no_crash = no_crash && ph2.get_error_message().empty();
+                } else {
+                    no_crash = no_crash && ph2.get_error_message().size() == 1;
+                }
+            }
+        }
+        return num_replaced == 2
+            && recursion_detected
+            && no_crash;
+    });
+
+    ut.set_test("Image", [&]() {
+        tphrase::Config_t config;
+        config.gsub_creator = tphrase::create_utf8_gsub;
+        tphrase::Generator ph{config};
+        ph.add(R"(
+            main = {A} | {_B} {= x | y } ~ /x/X/ ~ /y/Y/ ~ /z/Z/
+            A 3 = a | "b" 2 {EXT} ~ /[ab]+/c/g ~ /q/Q/
+            _B := p | q | r | {A}
+        )");
+        ph.add("main = s | t ~ /u/U/");
+        ph.add("main = {C}\nC = c");
+        std::stringstream ss;
+        const bool saved{ph.save_image(ss)};
+        const std::string s{ss.str()};
+        std::vector<std::uint64_t> buf((s.size() + 7) / 8);
+        std::memcpy(buf.data(), s.data(), s.size());
+        const char *begin{reinterpret_cast<const char *>(buf.data())};
+        tphrase::GeneratorImage image{begin, begin + s.size(), config};
+        const tphrase::ExtContext_t ext{{"EXT", "e"}};
+        const std::vector<double> seq{0.05, 0.15, 0.25, 0.35, 0.45, 0.55, 0.65, 0.75, 0.85, 0.95};
+        std::vector<std::string> r1;
+        tphrase::Generator::set_random_function(get_sequence_random_func(seq));
+        for (std::size_t i = 0; i < 20; ++i) {
+            r1.emplace_back(ph.generate(ext));
+        }
+        std::vector<std::string> r2;
+        tphrase::Generator::set_random_function(get_sequence_random_func(seq));
+        for (std::size_t i = 0; i < 20; ++i) {
+            r2.emplace_back(image.generate(ext));
+        }
+        return saved
+            && image.get_error_message().empty()
+            && r1 == r2
+            && image.get_number_of_syntax() == ph.get_number_of_syntax()
+            && image.get_combination_number() == ph.get_combination_number()
+            && image.get_weight() == ph.get_weight();
+    });
+
+    ut.set_test("Broken image", [&]() {
+        tphrase::Generator ph{"main = a | b ~ /a/A/"};
+        std::stringstream ss;
+        ph.save_image(ss);
+        const std::string s{ss.str()};
+        const std::string truncated{s.substr(0, s.size() - 8)};
+        tphrase::GeneratorImage image1{truncated.data(), truncated.data() + truncated.size()};
+        std::string broken{s};
+        ++broken[32]; // the offset of the phrase record
+        tphrase::GeneratorImage image2{broken.data(), broken.data() + broken.size()};
+        std::string other{"main = a"};
+        tphrase::GeneratorImage image3{other.data(), other.data() + other.size()};
+        const auto image4 = tphrase::GeneratorImage::from_file("not_existing.image");
+        return image1.get_error_message().size() == 1
+            && image1.get_error_message()[0] == "The image is truncated."
+            && image1.generate() == "nil"
+            && image2.get_error_message().size() == 1
+            && image2.get_error_message()[0] == "The image is broken."
+            && image2.get_number_of_syntax() == 0
+            && image3.get_error_message().size() == 1
+            && image3.get_error_message()[0] == "The data is not an image of TPhrase."
+            && image4.get_error_message().size() == 1
+            && image4.get_error_message()[0] == "not_existing.image: The file can't be opened.";
+    });
+
     return ut.run();
 }
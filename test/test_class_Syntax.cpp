@@ -32,6 +32,8 @@
    limitations under the License.
 */
 
+#include <cstdio>
+#include <fstream>
 #include <ios>
 #include <iterator>
 #include <sstream>
@@ -466,6 +468,122 @@ std::size_t test_class_Syntax()
             && good;
     });
 
+    ut.set_test("Add a file", [&]() {
+        const char *path{"test_class_Syntax_add_file.txt"};
+        {
+            std::ofstream f{path, std::ios_base::binary};
+            f << "main = {A} | {B}\nA = A1 | A2\nB = B1 | B2 ~ ///\n";
+        }
+        tphrase::Syntax syntax{"A = X"};
+        const bool good = syntax.add_file(path);
+        tphrase::Syntax created{tphrase::Syntax::from_file(path)};
+        std::remove(path);
+        return syntax.get_error_message().size() == 1
+            && syntax.get_error_message()[0] == "test_class_Syntax_add_file.txt: Line#3, Column#16: A nonempty pattern is expected."
+            && created.get_error_message() == syntax.get_error_message()
+            && !good;
+    });
+
+    ut.set_test("Add a file with overwriting", [&]() {
+        const char *path{"test_class_Syntax_add_file.txt"};
+        {
+            std::ofstream f{path, std::ios_base::binary};
+            f << "main = {A}\nA = A1";
+        }
+        tphrase::Syntax syntax{"A = X"};
+        const bool good = syntax.add_file(path);
+        std::remove(path);
+        tphrase::Generator ph{syntax};
+        auto r = ph.generate();
+        return r == "nil"
+            && syntax.get_error_message().size() == 1
+            && syntax.get_error_message()[0] == "test_class_Syntax_add_file.txt: The nonterminal \"A\" is already defined."
+            && good;
+    });
+
+    ut.set_test("Add a nonexistent file", [&]() {
+        tphrase::Syntax syntax{tphrase::Syntax::from_file("test_class_Syntax_nonexistent.txt")};
+        return syntax.get_error_message().size() == 1
+            && syntax.get_error_message()[0] == "test_class_Syntax_nonexistent.txt: The file can't be opened.";
+    });
+
+    ut.set_test("Update", [&]() {
+        tphrase::Generator::clear_gsub_cache();
+        std::size_t created{0};
+        tphrase::Config_t config;
+        config.gsub_creator = [&created](const std::string &pattern,
+                                         const std::string &repl,
+                                         bool) -> tphrase::GsubFunc_t {
+            ++created;
+            return [=](const std::string &s) { return s + pattern + repl; };
+        };
+        tphrase::Syntax syntax{config};
+        const bool good1 = syntax.update("main = {A} | {B}\nA = a ~ /x/1/\nB = b ~ /y/2/\n");
+        const std::size_t n1{created};
+        const bool good2 = syntax.update("main = {A} | {B}\nA = a ~ /x/1/\nB = c ~ /z/3/\n");
+        const std::size_t n2{created};
+        tphrase::Generator::clear_gsub_cache();
+        tphrase::Generator ph{syntax};
+        tphrase::Generator::set_random_function(get_sequence_random_func({0.1, 0.6}));
+        auto r1 = ph.generate();
+        auto r2 = ph.generate();
+        return good1
+            && good2
+            && n1 == 2
+            && n2 == 3
+            && r1 == "ax1"
+            && r2 == "cz3"
+            && syntax.get_error_message().empty()
+            && ph.get_error_message().empty();
+    });
+
+    ut.set_test("Update with errors", [&]() {
+        tphrase::Syntax syntax;
+        const bool good1 = syntax.update("main = {A}\nA = a\n");
+        const bool good2 = syntax.update("main = {A}\nA = a |\n");
+        const bool same_err{syntax.get_error_message() == tphrase::Syntax{"main = {A}\nA = a |\n"}.get_error_message()};
+        const bool good3 = syntax.update("main = {A}\nA = b\n");
+        tphrase::Generator ph{syntax};
+        auto r = ph.generate();
+        return good1
+            && !good2
+            && same_err
+            && good3
+            && r == "b"
+            && syntax.get_error_message().empty();
+    });
+
+    ut.set_test("Save and Load", [&]() {
+        tphrase::Syntax syntax1{R"(
+            main = {A} {_B} ~ /a/A/
+            A = a | {:= b | c }
+            _B = d
+        )"};
+        std::stringstream ss;
+        const bool saved{syntax1.save(ss)};
+        tphrase::Syntax syntax2;
+        const bool loaded{syntax2.load(ss)};
+        tphrase::Generator ph1{syntax1};
+        tphrase::Generator ph2{syntax2};
+        tphrase::Generator::set_random_function(get_sequence_random_func({0.1, 0.5, 0.9}));
+        auto r1 = ph1.generate();
+        auto r2 = ph1.generate();
+        tphrase::Generator::set_random_function(get_sequence_random_func({0.1, 0.5, 0.9}));
+        auto r3 = ph2.generate();
+        auto r4 = ph2.generate();
+        std::istringstream ss_broken{"TPhrase"};
+        const bool loaded_broken{syntax2.load(ss_broken)};
+        return saved
+            && loaded
+            && r1 == r3
+            && r2 == r4
+            && ph1.get_combination_number() == ph2.get_combination_number()
+            && !loaded_broken
+            && tphrase::Generator{syntax2}.generate() == "nil"
+            && syntax2.get_error_message().size() == 1
+            && syntax2.get_error_message()[0] == "The data is not a snapshot of TPhrase.";
+    });
+
     ut.set_test("clear_error", [&]() {
         tphrase::Syntax syntax{R"(
             main = {:= A | B | C } | {B} | {C} |
@@ -498,5 +616,69 @@ std::size_t test_class_Syntax()
             && ph.get_error_message()[0].find("The nonterminal \"main\" doesn't exist.") != std::string::npos;
     });
 
+    ut.set_test("Parse each assignment", [&]() {
+        const std::string src{
+            "_L = l\n"
+            "A = a{_L}\n"
+            "B = b | | c\n"
+            "C = c\n"
+            "D = d{_M}\n"
+            "_M = m\n"
+            "main = {A} {C}\n"};
+        std::vector<std::string> names;
+        tphrase::Syntax shard;
+        std::vector<std::string> err_msg;
+        const bool good1{tphrase::Syntax::parse_each(src.begin(), src.end(), [&](const std::string &nonterminal, tphrase::Syntax &&assignment) {
+            names.emplace_back(nonterminal);
+            if (nonterminal != "C") {
+                shard.add(std::move(assignment));
+            }
+            return true;
+        }, err_msg)};
+        shard.add("C = x");
+        std::istringstream is{src};
+        std::size_t n{0};
+        const bool good2{tphrase::Syntax::parse_each(is, [&](const std::string &, tphrase::Syntax &&) {
+            ++n;
+            return false;
+        }, err_msg)};
+        tphrase::Generator ph{shard};
+        return !good1
+            && good2
+            && names == std::vector<std::string>{"A", "C", "main"}
+            && err_msg.size() == 2
+            && err_msg[0] == "Line#3, Column#9: A text is expected."
+            && err_msg[1] == "The local nonterminal \"_M\" is not found."
+            && n == 1
+            && ph.generate() == "al x"
+            && ph.get_error_message().empty();
+    });
+
+    ut.set_test("Assignments outliving their parse", [&]() {
+        const std::string src{
+            "main = {A} {B}\n"
+            "A = {= a1 | a1} {= x | x}\n"
+            "B = {= b1 | b1} | {= b2 | b2}\n"};
+        std::vector<tphrase::Syntax> assignments;
+        std::vector<std::string> err_msg;
+        const bool good{tphrase::Syntax::parse_each(src.begin(), src.end(), [&](const std::string &, tphrase::Syntax &&assignment) {
+            assignments.emplace_back(std::move(assignment));
+            return true;
+        }, err_msg)};
+        tphrase::Syntax copied{assignments[2]};
+        tphrase::Syntax merged;
+        merged.add(assignments[0]);
+        merged.add(std::move(assignments[1]));
+        assignments.clear();
+        merged.add(std::move(copied));
+        tphrase::Generator ph{merged};
+        merged = tphrase::Syntax{};
+        const auto s = ph.generate();
+        return good
+            && (s == "a1 x b1" || s == "a1 x b2")
+            && ph.get_error_message().empty()
+            && ph.get_combination_number() == 16;
+    });
+
     return ut.run();
 }
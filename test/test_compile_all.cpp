@@ -0,0 +1,123 @@
+/* test for compile_all
+
+   Copyright © 2024 OOTA, Masato
+
+   This file is part of TPhrase.
+
+   TPhrase is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   TPhrase is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+   OR
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use TPhrase except in compliance with the License.
+   You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tphrase/Generator.h"
+#include "tphrase/compile_all.h"
+
+#include "UnitTest.h"
+#include "unit_test_utility.h"
+
+std::size_t test_compile_all()
+{
+    UnitTest ut("compile_all");
+
+    auto stub_random{get_sequence_random_func({})};
+
+    ut.set_enter_function([&]() {
+        tphrase::Generator::set_random_function(stub_random);
+    });
+    ut.set_leave_function([&]() {
+        return true;
+    });
+
+
+    ut.set_test("Syntaxes in the input order", [&]() {
+        std::vector<std::string> sources;
+        for (int i = 0; i < 100; ++i) {
+            sources.emplace_back("main = {A} ~ /a/b/\nA = a" + std::to_string(i));
+        }
+        sources[37] = "main = |";
+        const std::vector<tphrase::Syntax> syntaxes{tphrase::compile_all(sources, 4)};
+        bool good{syntaxes.size() == 100};
+        for (std::size_t i = 0; good && i < syntaxes.size(); ++i) {
+            if (i == 37) {
+                good = syntaxes[i].get_error_message().size() == 1
+                    && syntaxes[i].get_error_message()[0] == "Line#1, Column#8: A text is expected.";
+            } else {
+                tphrase::Generator ph{syntaxes[i]};
+                good = syntaxes[i].get_error_message().empty()
+                    && ph.generate() == "b" + std::to_string(i);
+            }
+        }
+        return good;
+    });
+
+    ut.set_test("Generators in the input order", [&]() {
+        std::vector<std::string> sources;
+        for (int i = 0; i < 100; ++i) {
+            sources.emplace_back("main = {A}\nA = a" + std::to_string(i) + " | b");
+        }
+        sources[59] = "main = {A}\nA = {main}";
+        std::vector<tphrase::Generator> generators{tphrase::compile_all_generators(sources, 0)};
+        bool good{generators.size() == 100};
+        for (std::size_t i = 0; good && i < generators.size(); ++i) {
+            if (i == 59) {
+                good = generators[i].get_error_message().size() == 1
+                    && generators[i].get_error_message()[0] == "Recursive expansion of \"main\" is detected.";
+            } else {
+                good = generators[i].get_error_message().empty()
+                    && generators[i].generate() == "a" + std::to_string(i)
+                    && generators[i].get_combination_number() == 2;
+            }
+        }
+        return good;
+    });
+
+    ut.set_test("Configuration", [&]() {
+        tphrase::Config_t config;
+        config.gsub_creator = [](const std::string &pattern, const std::string &repl, bool) -> tphrase::GsubFunc_t {
+            if (pattern == "bad") {
+                throw std::runtime_error{"bad pattern"};
+            }
+            return [repl](const std::string &) {
+                return repl;
+            };
+        };
+        const std::vector<std::string> sources{"main = a ~ /x/y/", "main = a ~ /bad/y/", ""};
+        std::vector<tphrase::Generator> generators{tphrase::compile_all_generators(sources, 3, config)};
+        return generators.size() == 3
+            && generators[0].generate() == "y"
+            && generators[1].get_error_message().size() == 1
+            && generators[1].get_error_message()[0] == "Line#1, Column#19: Gsub error: bad pattern"
+            && generators[2].get_error_message().size() == 1
+            && tphrase::compile_all({}, 4).empty();
+    });
+
+    return ut.run();
+}
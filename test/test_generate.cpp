@@ -35,6 +35,7 @@
 #include <cstddef>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "tphrase/Generator.h"
 
@@ -316,6 +317,38 @@ std::size_t test_generate()
             && ph.get_error_message().empty();
     });
 
+    ut.set_test("Literal Gsub Chain", [&]() {
+        tphrase::Generator ph(R"(
+            main = gabapatagbpt ~
+                   /ga/ガ/g ~
+                   /ba/バ/g ~
+                   /pa/パ/g ~
+                   /ta/タ/g ~
+                   /g/グ/g ~
+                   /b/ブ/g ~
+                   /p/プ/g ~
+                   /t/トゥ/g
+        )");
+        return ph.generate() == "ガバパタグブプトゥ"
+            && ph.get_error_message().empty();
+    });
+
+    ut.set_test("Literal Gsub Chain Depending on the Order", [&]() {
+        tphrase::Generator ph(R"(
+            main = abcab ~ /b/x/g ~ /ab/y/g ~ /xc/z/g ~ /a/b/
+        )");
+        return ph.generate() == "bzax"
+            && ph.get_error_message().empty();
+    });
+
+    ut.set_test("Literal Gsub with Escaped Character", [&]() {
+        tphrase::Generator ph(R"(
+            main = "a.b.c$" ~ /\./-/g ~ /c\$/$$/
+        )");
+        return ph.generate() == "a-b-$"
+            && ph.get_error_message().empty();
+    });
+
     ut.set_test("Expansion, External Context, and Gsub", [&]() {
         tphrase::Generator ph(R"(
             main = {A} {B} {C} ~ /head/HEAD/ ~ /tail/TAIL/ ~ /body/BODY/
@@ -463,6 +496,65 @@ std::size_t test_generate()
             && ph.get_error_message().empty();
     });
 
+    ut.set_test("Gsub Skipped by Required Literal", [&]() {
+        tphrase::Config_t config;
+        config.lazy_gsub = true;
+        tphrase::Generator::clear_gsub_cache();
+        tphrase::Syntax syntax{config};
+        syntax.add(R"(
+            main = {A} {B}
+            A = a banana ~ /^an? ([aeiou])/an $1/
+            B = an egg ~ /^an? ([aeiou])/an $1/ ~ /x+y/z/
+        )");
+        tphrase::Generator ph{syntax};
+        auto r = ph.generate();
+        const auto stats{tphrase::Generator::get_gsub_cache_stats()};
+        tphrase::Generator::clear_gsub_cache();
+        tphrase::Generator ph2{R"(
+            main = {A} {B}
+            A = X ~ /b{1,}{0,1}X/Z/g
+            B = a ~ /(?=a)c+*/Z/g
+        )"};
+        return r == "a banana an egg"
+            && ph2.generate() == "Z Za"
+            && ph2.get_error_message().empty()
+            && stats.misses == 1
+            && syntax.get_error_message().empty()
+            && ph.get_error_message().empty();
+    });
+
+    ut.set_test("Eliminated Gsubs", [&]() {
+        tphrase::Syntax syntax(R"(
+            main = {A} {B} ~ /q/Q/
+            A = abc ~ /x+/y/g ~ /b/x/ ~ /x/z/ ~ /y/Y/
+            B = {ext} ~ /x/X/
+        )");
+        tphrase::Generator ph(syntax);
+        const auto report{ph.get_eliminated_gsub_report()};
+        const std::vector<std::string> expected{
+            R"(The gsub with the pattern "x+" in "A" is eliminated because it can't match.)",
+            R"(The gsub with the pattern "y" in "A" is eliminated because it can't match.)",
+        };
+        tphrase::Generator ph2{ph};
+        return ph.generate({{"ext", "q"}}) == "azc Q"
+            && report == expected
+            && ph2.get_eliminated_gsub_report() == expected
+            && ph2.generate({{"ext", "xq"}}) == "azc XQ"
+            && syntax.get_error_message().empty()
+            && ph.get_error_message().empty();
+    });
+
+    ut.set_test("Gsubs with Stacked Quantifiers Aren't Eliminated", [&]() {
+        tphrase::Generator ph(R"(
+            main = {A} {B}
+            A = X ~ /b{1,}{0,1}X/Z/g
+            B = a ~ /(?=a)c+*/Z/g
+        )");
+        return ph.generate() == "Z Za"
+            && ph.get_eliminated_gsub_report().empty()
+            && ph.get_error_message().empty();
+    });
+
     ut.set_test("Don't Overwrite Local Nonterminal", [&]() {
         tphrase::Syntax sub(R"(
             _sub = A
@@ -504,6 +596,36 @@ std::size_t test_generate()
             && ph2.get_error_message().empty();
     });
 
+    ut.set_test("Local Nonterminal with the Same Name", [&]() {
+        tphrase::Syntax sub1(R"(
+            sub1 = {_local}
+            _local = 1
+        )");
+        tphrase::Syntax sub2(R"(
+            sub2 = {_local}
+            _local = 2
+        )");
+        tphrase::Syntax main(R"(
+            main = {sub1}{sub2}{_local}
+            _local = 3
+        )");
+        main.add(sub1);
+        main.add(sub2);
+        tphrase::Generator ph(main);
+        return ph.generate() == "123"
+            && main.get_error_message().empty()
+            && ph.get_error_message().empty();
+    });
+
+    ut.set_test("Local Nonterminal in Anonymous Rule", [&]() {
+        tphrase::Generator ph(R"(
+            main = {= a{_local} }
+            _local = 1
+        )");
+        return ph.generate() == "a1"
+            && ph.get_error_message().empty();
+    });
+
     ut.set_test("Sharing Rule", [&]() {
         tphrase::Generator ph(R"(
             main = {A} | {B} | {C}
@@ -37,9 +37,11 @@
 extern std::size_t test_class_Generator();
 extern std::size_t test_class_InputIterator();
 extern std::size_t test_class_Syntax();
+extern std::size_t test_compile_all();
 extern std::size_t test_error_utils();
 extern std::size_t test_generate();
 extern std::size_t test_parse();
+extern std::size_t test_utf8_gsub();
 
 int main()
 {
@@ -47,8 +49,10 @@ int main()
     r += test_class_Generator();
     r += test_class_InputIterator();
     r += test_class_Syntax();
+    r += test_compile_all();
     r += test_error_utils();
     r += test_generate();
     r += test_parse();
+    r += test_utf8_gsub();
     return r == 0 ? 0 : 1;
 }
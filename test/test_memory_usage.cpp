@@ -0,0 +1,255 @@
+/* test for the memory usage
+
+   Copyright © 2024 OOTA, Masato
+
+   This file is part of TPhrase.
+
+   TPhrase is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   TPhrase is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+   OR
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use TPhrase except in compliance with the License.
+   You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tphrase/Generator.h"
+
+#include "UnitTest.h"
+
+// The global operator new and delete are replaced to count the live bytes, so the tests are separated from the other unit tests, which keep the checks of the sanitizers on them.
+namespace {
+    std::atomic<std::size_t> allocated_bytes{0};
+    // The size of the allocation is stored before the memory, keeping the alignment of malloc().
+    constexpr std::size_t header_size = alignof(std::max_align_t) > sizeof(std::size_t) ? alignof(std::max_align_t) : sizeof(std::size_t);
+
+    void *allocate_counted(std::size_t size) noexcept
+    {
+        char *block = static_cast<char *>(std::malloc(header_size + size));
+        if (block == nullptr) {
+            return nullptr;
+        }
+        *reinterpret_cast<std::size_t *>(block) = size;
+        allocated_bytes += size;
+        return block + header_size;
+    }
+
+    void deallocate_counted(void *p) noexcept
+    {
+        if (p != nullptr) {
+            char *block = static_cast<char *>(p) - header_size;
+            allocated_bytes -= *reinterpret_cast<std::size_t *>(block);
+            std::free(block);
+        }
+    }
+
+    // The number of the bytes allocated by the global operator new and not deallocated yet.
+    std::size_t get_allocated_bytes()
+    {
+        return allocated_bytes;
+    }
+}
+
+void *operator new(std::size_t size)
+{
+    void *p = allocate_counted(size);
+    if (p == nullptr) {
+        throw std::bad_alloc{};
+    }
+    return p;
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    return allocate_counted(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    return allocate_counted(size);
+}
+
+void operator delete(void *p) noexcept
+{
+    deallocate_counted(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    deallocate_counted(p);
+}
+
+void operator delete(void *p, const std::nothrow_t &) noexcept
+{
+    deallocate_counted(p);
+}
+
+void operator delete[](void *p, const std::nothrow_t &) noexcept
+{
+    deallocate_counted(p);
+}
+
+int main()
+{
+    UnitTest ut("memory usage");
+
+    ut.set_test("Memory usage", [&]() {
+        std::string src{"main = {N0}\n"};
+        for (int i = 0; i < 200; ++i) {
+            src += "N" + std::to_string(i) + " = the " + std::to_string(i) + "th text {N" + std::to_string(i + 1)
+                + "} | a longer literal text that is not stored in a string object | {= x | y }\n";
+        }
+        src += "N200 = end\n";
+        const tphrase::Generator ph1{src}; // The symbols are interned.
+        const std::size_t before{get_allocated_bytes()};
+        const tphrase::Generator ph2{src};
+        const std::size_t allocated{get_allocated_bytes() - before};
+        const tphrase::MemoryUsage_t usage{ph2.memory_usage()};
+        tphrase::Syntax syntax;
+        syntax.update(src);
+        const tphrase::MemoryUsage_t syntax_usage{syntax.memory_usage()};
+        const tphrase::Generator ph3{"main = a ~ /[ab]+/c/g\n"};
+        const tphrase::MemoryUsage_t gsub_usage{ph3.memory_usage()};
+        tphrase::Generator ph4;
+        for (int i = 0; i < 4; ++i) {
+            ph4.add(tphrase::Syntax{src});
+        }
+        const tphrase::MemoryUsage_t usage4{ph4.memory_usage()};
+        const std::size_t released{ph4.compact()};
+        const tphrase::MemoryUsage_t compacted{ph4.memory_usage()};
+        return usage.total() > allocated * 0.9
+            && usage.total() < allocated * 1.1
+            && usage.assignments > 0
+            && usage.rules > 0
+            && usage.texts > 0
+            && usage.parts > 0
+            && usage.literals > 0
+            && usage.weights > 0
+            && usage.gsubs == 0
+            && usage.error_messages == 0
+            && syntax_usage.others > src.size()
+            && gsub_usage.gsubs > 1024
+            && released > usage4.total() / 2
+            && compacted.total() == usage4.total() - released;
+    });
+
+    ut.set_test("Memory of parse_each", [&]() {
+        std::string src;
+        for (int i = 0; i < 10000; ++i) {
+            src += "A" + std::to_string(i) + " = the " + std::to_string(i) + "th text | {= x | y } ~ /x/X/\n";
+        }
+        const tphrase::Syntax whole{src}; // The symbols are interned.
+        const std::size_t before{get_allocated_bytes()};
+        std::size_t peak{0};
+        std::size_t held{0};
+        {
+            tphrase::Syntax first;
+            bool is_first{true};
+            std::vector<std::string> err_msg;
+            tphrase::Syntax::parse_each(src.cbegin(), src.cend(), [&](const std::string &, tphrase::Syntax &&assignment) {
+                if (is_first) {
+                    first = std::move(assignment);
+                    is_first = false;
+                }
+                const std::size_t allocated{get_allocated_bytes() - before};
+                peak = allocated > peak ? allocated : peak;
+                return true;
+            }, err_msg);
+            held = get_allocated_bytes() - before;
+        }
+        // Only the first assignment is kept.
+        return peak < 64 * 1024
+            && held < 16 * 1024;
+    });
+
+    ut.set_test("Memory of the incremental updates", [&]() {
+        const int num_assignments{200};
+        std::vector<std::string> lines;
+        std::string main{"main = {N0}"};
+        for (int i = 0; i < num_assignments; ++i) {
+            lines.emplace_back("N" + std::to_string(i) + " = the text | {= x | y }\n");
+            if (i > 0) {
+                main += " | {N" + std::to_string(i) + "}";
+            }
+        }
+        main += "\n";
+        const auto join = [&]() {
+            std::string src{main};
+            for (const auto &line : lines) {
+                src += line;
+            }
+            return src;
+        };
+        tphrase::Syntax syntax;
+        syntax.update(join());
+        tphrase::Generator ph;
+        const auto id = ph.add(syntax);
+        bool good{true};
+        std::size_t warmed_up{0};
+        for (int n = 0; n < 2000; ++n) {
+            const int i{n % num_assignments};
+            lines[i] = "N" + std::to_string(i) + " = the text " + std::to_string(n) + " | {= x | y }\n";
+            good = good && syntax.update(join()) && ph.update(id, syntax);
+            if (n == 0) {
+                warmed_up = get_allocated_bytes();
+            }
+        }
+        // The replaced production rules are released.
+        return good
+            && get_allocated_bytes() < warmed_up + 64 * 1024;
+    });
+
+    ut.set_test("Memory of the symbols", [&]() {
+        const std::size_t before{get_allocated_bytes()};
+        {
+            std::string src;
+            for (int i = 0; i < 10000; ++i) {
+                src += "_L" + std::to_string(i) + " = x\nS" + std::to_string(i) + " = {_L" + std::to_string(i) + "}\n";
+            }
+            std::vector<std::string> err_msg;
+            tphrase::Syntax::parse_each(src.cbegin(), src.cend(), [](const std::string &, tphrase::Syntax &&) {
+                return true;
+            }, err_msg);
+            tphrase::Syntax renamed;
+            for (int i = 0; i < 100; ++i) {
+                renamed.add("R" + std::to_string(i) + " = {_X}\n_X = x\n"); // _X is renamed to _X@1, _X@2, ...
+            }
+        }
+        // The names are released from the symbol table.
+        return get_allocated_bytes() < before + 4 * 1024;
+    });
+
+    return ut.run() == 0 ? 0 : 1;
+}
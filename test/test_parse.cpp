@@ -33,6 +33,8 @@
 */
 
 #include <cstddef>
+#include <iterator>
+#include <sstream>
 #include <string>
 
 #include "tphrase/Generator.h"
@@ -502,5 +504,72 @@ Hello World.)");
             && err_msg[0].find("The end of the comment is expected.") != std::string::npos;
     });
 
+    ut.set_test("Same Errors from Contiguous and Non-contiguous Source", [&]() {
+        const std::string src{
+            "main = \"{A}\" | {= x ~ /a/b/ } | c\n"
+            "A = a b\tc {*comment*} | d ~ /a\nb/c/ x\n"
+            "B = \"ab\nc\" 2 | {(}e{)} {*x} f\n"
+            "C = x | | y\n"
+            "D := e {F}g{\n"};
+        std::istringstream s{src};
+        tphrase::Syntax contiguous{src};
+        tphrase::Syntax stream{std::istreambuf_iterator<char>{s},
+                               std::istreambuf_iterator<char>{}};
+        const std::vector<std::string> expected{
+            "Line#3, Column#6: The end of the text or \"\\n\" is expected.",
+            "Line#6, Column#9: A text is expected.",
+            "Line#8, Column#1: The end of the brace expansion is expected.",
+        };
+        return contiguous.get_error_message() == expected
+            && stream.get_error_message() == expected;
+    });
+
+    ut.set_test("Long Runs from Contiguous and Non-contiguous Source", [&]() {
+        const std::string src{
+            "main = {A} | {B} | {C}\n"
+            "A = abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ {*\n"
+            "    a long comment that has a newline\n"
+            "    and another one, that is longer than 32 characters. }\n"
+            "B = \"quoted text with a newline\n and an expansion {A}, it's longer than 32 characters.\"\n"
+            "C = c ~ /c/a long replacement that has a newline\nand another one, longer than 32 characters/\n"};
+        const std::string error_src{src + "D = abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ | | e\n"};
+        std::istringstream s{error_src};
+        tphrase::Syntax contiguous{error_src};
+        tphrase::Syntax stream{std::istreambuf_iterator<char>{s},
+                               std::istreambuf_iterator<char>{}};
+        const std::vector<std::string> expected{
+            "Line#9, Column#70: A text is expected.",
+        };
+        tphrase::Generator ph{src};
+        tphrase::Generator::set_random_function(get_sequence_random_func({0.0, 0.4, 0.9}));
+        const std::string r1{ph.generate()};
+        const std::string r2{ph.generate()};
+        const std::string r3{ph.generate()};
+        return contiguous.get_error_message() == expected
+            && stream.get_error_message() == expected
+            && ph.get_error_message().empty()
+            && r1 == "abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+            && r2 == "quoted text with a newline\n and an expansion abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ, it's longer than 32 characters."
+            && r3 == "a long replacement that has a newline\nand another one, longer than 32 characters";
+    });
+
+    ut.set_test("Many Errors", [&]() {
+        std::string src;
+        for (std::size_t i = 0; i < 100; ++i) {
+            src += "A = a | | b\n";
+            src += "B : c\n";
+            src += "C = x }\n";
+            src += "D" + std::to_string(i) + " = d ~ /x//\n";
+        }
+        src += "main = {D0}\n";
+        tphrase::Syntax syntax{src};
+        const auto &err_msg{syntax.get_error_message()};
+        return err_msg.size() == 300
+            && err_msg[0] == "Line#1, Column#9: A text is expected."
+            && err_msg[1] == "Line#2, Column#4: \"=\" is expected."
+            && err_msg[2] == "Line#3, Column#7: The end of the text or \"\\n\" is expected."
+            && err_msg[299] == "Line#399, Column#7: The end of the text or \"\\n\" is expected.";
+    });
+
     return ut.run();
 }
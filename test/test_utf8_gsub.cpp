@@ -0,0 +1,187 @@
+/* test for utf8_gsub
+
+   Copyright © 2024 OOTA, Masato
+
+   This file is part of TPhrase.
+
+   TPhrase is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   TPhrase is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+   OR
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use TPhrase except in compliance with the License.
+   You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#include "tphrase/Generator.h"
+#include "tphrase/utf8_gsub.h"
+
+#include "UnitTest.h"
+
+namespace {
+    /** Substitute a string by create_utf8_gsub().
+        \param [in] pattern Pattern parameter for gsub.
+        \param [in] repl Replacement parameter for gsub.
+        \param [in] global Global parameter for gsub.
+        \param [in] s The source string.
+        \return Substituted string.
+    */
+    std::string gsub(const std::string &pattern, const std::string &repl, const bool global, const std::string &s)
+    {
+        return tphrase::create_utf8_gsub(pattern, repl, global)(s);
+    }
+
+    /** Is a pattern rejected by create_utf8_gsub()?
+        \param [in] pattern Pattern parameter for gsub.
+        \return true if create_utf8_gsub() throws std::runtime_error.
+    */
+    bool is_rejected(const std::string &pattern)
+    {
+        try {
+            tphrase::create_utf8_gsub(pattern, "", false);
+        } catch (const std::runtime_error &) {
+            return true;
+        }
+        return false;
+    }
+}
+
+std::size_t test_utf8_gsub()
+{
+    UnitTest ut("utf8_gsub");
+
+    auto default_gsub{tphrase::Generator::get_gsub_function_creator()};
+
+    ut.set_enter_function([&]() {
+    });
+    ut.set_leave_function([&]() {
+        tphrase::Generator::set_gsub_function_creator(default_gsub);
+        return true;
+    });
+
+    ut.set_test("Dot Matches a Code Point", [&]() {
+        return gsub("^.", "[$&]", false, "ありがとう") == "[あ]りがとう"
+            && gsub(".$", "[$&]", false, "Спасибо") == "Спасиб[о]"
+            && gsub(".", "-", true, "aяア😀") == "----";
+    });
+
+    ut.set_test("Character Class Matches a Code Point", [&]() {
+        return gsub("[а-я]+", "<$&>", true, "Это test строка") == "Э<то> test <строка>"
+            && gsub("[^ア-ン]", "_", true, "アイxウ") == "アイ_ウ"
+            && gsub("[ぁ-ゖ]{2}", "*", true, "ひらがなカタカナ") == "**カタカナ";
+    });
+
+    ut.set_test("General Category", [&]() {
+        return gsub("\\p{Lu}", "_", true, "Hello Мир") == "_ello _ир"
+            && gsub("\\p{L}+", "W", true, "كتاب، 本 and 3") == "W، W W 3"
+            && gsub("\\P{L}+", "", true, "a1, b-2") == "ab"
+            && gsub("\\p{Nd}", "#", true, "x٣4") == "x##"
+            && gsub("\\p{gc=Ll}", "l", true, "aBя") == "lBl"
+            && gsub("[\\p{Lu}\\d]", "!", true, "aB1Я") == "a!!!";
+    });
+
+    ut.set_test("Quantifier and Alternation", [&]() {
+        return gsub("(ab)+?c|x*", "[$&]", true, "ababcx") == "[ababc][x][]"
+            && gsub("a{2,3}", "-", true, "aaaaaaa") == "--a"
+            && gsub("の|を", "", true, "本を読むのが好き") == "本読むが好き";
+    });
+
+    ut.set_test("Replacement", [&]() {
+        return gsub("(\\w+) (\\w+)", "$2 $1", false, "hello world") == "world hello"
+            && gsub("b", "[$`|$'|$$|$&]", false, "abc") == "a[a|c|$|b]c"
+            && gsub("(a)", "$2$01$10", false, "a") == "$2aa0";
+    });
+
+    ut.set_test("Empty Match", [&]() {
+        return gsub("x*", "-", true, "aя") == "-a-я-"
+            && gsub("a*", "-", true, "aab") == "--b-"
+            && gsub("x*", "-", false, "ab") == "-ab";
+    });
+
+    ut.set_test("Assertions", [&]() {
+        return gsub("\\ba\\b", "an", true, "a apple, a cat") == "an apple, an cat"
+            && gsub("^ア|ア$", "-", true, "アアア") == "-ア-"
+            && gsub("\\Bb", "B", true, "bab b") == "baB b";
+    });
+
+    ut.set_test("Escape Sequences", [&]() {
+        return gsub("\\u3042\\u{1F600}", "ok", false, "あ😀") == "ok"
+            && gsub("\\x41\\t", "B", false, "A\t") == "B"
+            && gsub("\\.\\*", "!", true, "a.*b") == "a!b"
+            && gsub("\\s+", " ", true, "a\t　b") == "a b";
+    });
+
+    ut.set_test("Invalid Byte in UTF-8", [&]() {
+        return gsub(".", "-", true, "a\xFF\xE3\x81") == "----"
+            && gsub("\xFF", "x", true, "a\xFF" "b") == "axb";
+    });
+
+    ut.set_test("Invalid or Unsupported Pattern", [&]() {
+        return is_rejected("(a")
+            && is_rejected("a)")
+            && is_rejected("[a")
+            && is_rejected("*a")
+            && is_rejected("a{3,2}")
+            && is_rejected("[z-a]")
+            && is_rejected("(a)\\1")
+            && is_rejected("(?=a)")
+            && is_rejected("\\p{Unknown}")
+            && !is_rejected("a{,2}")
+            && !is_rejected("]}");
+    });
+
+    ut.set_test("Gsub Creator for Generator", [&]() {
+        tphrase::Generator::set_gsub_function_creator(tphrase::create_utf8_gsub);
+        tphrase::Generator ph{R"(
+            main = {noun} ~ /^\p{Ll}/大/ ~ /(.)$/[$1]/
+            noun = яблоко
+        )"};
+        auto r = ph.generate();
+        return r == "大блок[о]"
+            && ph.get_error_message().empty();
+    });
+
+    ut.set_test("Literal Gsub Chain with UTF-8 Gsub Creator", [&]() {
+        tphrase::Generator::set_gsub_function_creator(tphrase::create_utf8_gsub);
+        tphrase::Generator ph{R"(
+            main = ガバパ ~ /ガ/ga/g ~ /バ/ba/g ~ /パ/pa/g
+        )"};
+        auto r = ph.generate();
+        return r == "gabapa"
+            && ph.get_error_message().empty();
+    });
+
+    ut.set_test("Gsub Error with UTF-8 Gsub Creator", [&]() {
+        tphrase::Generator::set_gsub_function_creator(tphrase::create_utf8_gsub);
+        tphrase::Generator ph{R"(
+            main = abc ~ /(a)\1/x/
+        )"};
+        return ph.get_error_message().size() == 1
+            && ph.get_error_message()[0].find("Gsub error: Backreference is not supported.") != std::string::npos;
+    });
+
+    return ut.run();
+}
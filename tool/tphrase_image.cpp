@@ -0,0 +1,155 @@
+/** The build-time compiler of phrase syntaxes into a generator image.
+    \file tphrase_image.cpp
+    \author OOTA, Masato
+    \copyright Copyright © 2024 OOTA, Masato
+    \par License GPL-3.0-or-later or Apache-2.0
+    \parblock
+      This file is part of TPhrase.
+
+      TPhrase is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      TPhrase is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with TPhrase.  If not, see <http://www.gnu.org/licenses/>.
+
+      OR
+
+      Licensed under the Apache License, Version 2.0 (the "License");
+      you may not use TPhrase except in compliance with the License.
+      You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+      Unless required by applicable law or agreed to in writing, software
+      distributed under the License is distributed on an "AS IS" BASIS,
+      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+      See the License for the specific language governing permissions and
+      limitations under the License.
+    \endparblock
+*/
+
+/* Usage: tphrase-image [-e] [-u] NAME OUTPUT SYNTAX_FILE...
+
+   It compiles the phrase syntaxes in SYNTAX_FILEs into a generator image,
+   and writes a C++ source file OUTPUT that defines the image as constant data:
+
+       extern const unsigned char NAME[];
+       extern const std::size_t NAME_size;
+
+   Each file is added as a phrase syntax. If some errors are detected, it
+   writes the error messages into stderr, and exits with failure status
+   without writing OUTPUT, so the build fails on the errors.
+
+   -e  Equalize the chance to select each phrase syntax.
+   -u  Use tphrase::create_utf8_gsub() to check the gsub patterns.
+*/
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "tphrase/Generator.h"
+#include "tphrase/utf8_gsub.h"
+
+namespace {
+    /** Show the usage.
+        \param [in] program The name of the program.
+        \return The exit status.
+    */
+    int usage(const char *program)
+    {
+        std::cerr << "Usage: " << program << " [-e] [-u] NAME OUTPUT SYNTAX_FILE..." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    /** Is the string a valid C++ identifier?
+        \param [in] s The string.
+        \return true if s is an identifier.
+    */
+    bool is_identifier(const std::string &s)
+    {
+        if (s.empty() || (s[0] >= '0' && s[0] <= '9')) {
+            return false;
+        }
+        for (auto c : s) {
+            if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_')) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** Write the image as a C++ source.
+        \param [inout] os The output stream.
+        \param [in] name The name of the array.
+        \param [in] image The image.
+    */
+    void write_source(std::ostream &os, const std::string &name, const std::string &image)
+    {
+        static const char hex[]{"0123456789abcdef"};
+        os << "// Generated by tphrase-image. Don't edit.\n"
+           << "#include <cstddef>\n"
+           << "\n"
+           << "alignas(8) extern const unsigned char " << name << "[] = {";
+        for (std::size_t i = 0; i < image.size(); ++i) {
+            const unsigned char c{static_cast<unsigned char>(image[i])};
+            os << (i % 12 == 0 ? "\n    " : " ") << "0x" << hex[c >> 4] << hex[c & 0xf] << ',';
+        }
+        os << "\n};\n"
+           << "extern const std::size_t " << name << "_size = " << image.size() << ";\n";
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int i{1};
+    bool equalized_chance{false};
+    tphrase::Config_t config;
+    for (; i < argc && argv[i][0] == '-'; ++i) {
+        if (std::strcmp(argv[i], "-e") == 0) {
+            equalized_chance = true;
+        } else if (std::strcmp(argv[i], "-u") == 0) {
+            config.gsub_creator = tphrase::create_utf8_gsub;
+        } else {
+            return usage(argv[0]);
+        }
+    }
+    if (argc - i < 3 || !is_identifier(argv[i])) {
+        return usage(argv[0]);
+    }
+    const std::string name{argv[i]};
+    const std::string output{argv[i + 1]};
+
+    tphrase::Generator generator{config};
+    for (i += 2; i < argc; ++i) {
+        generator.add(tphrase::Syntax::from_file(argv[i], config));
+    }
+    generator.equalize_chance(equalized_chance);
+    if (!generator.get_error_message().empty()) {
+        for (const auto &msg : generator.get_error_message()) {
+            std::cerr << msg << std::endl;
+        }
+        return EXIT_FAILURE;
+    }
+
+    std::ostringstream image;
+    generator.save_image(image);
+    std::ofstream os{output};
+    write_source(os, name, image.str());
+    os.close();
+    if (!os) {
+        std::cerr << output << ": The file can't be written." << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}